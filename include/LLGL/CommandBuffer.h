@@ -469,6 +469,27 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         */
         virtual void EndQuery(QueryHeap& queryHeap, std::uint32_t query = 0) = 0;
 
+        /**
+        \brief Writes the results of the specified queries into a buffer on the GPU timeline, i.e. without a CPU round-trip.
+        \param[in] queryHeap Specifies the query heap whose results are to be resolved.
+        This query heap must not have been created with the \c renderCondition member set to \c true.
+        \param[in] firstQuery Specifies the zero-based index of the first query within the heap.
+        This must be in the half-open range <code>[0, QueryHeapDescriptor::numQueries)</code>.
+        \param[in] numQueries Specifies the number of queries to resolve.
+        This must be less than or equal to <code>QueryHeapDescriptor::numQueries - firstQuery</code>.
+        \param[in] dstBuffer Specifies the destination buffer the results are written to.
+        \param[in] dstOffset Specifies the offset (in bytes) of the first result within the destination buffer.
+        \remarks Each result is written as 64-bit unsigned integer, and each result of type QueryType::PipelineStatistics is written as QueryPipelineStatistics structure.
+        Hence, the destination buffer range is <code>numQueries * sizeof(std::uint64_t)</code> or <code>numQueries * sizeof(QueryPipelineStatistics)</code> bytes.
+        This must be called outside of a query block for the specified queries.
+        \remarks Direct3D 11 cannot write query data on the GPU timeline. Its renderer waits for the results and uploads them instead,
+        and throws an exception if the command buffer was created with CommandBufferFlags::DeferredSubmit.
+        The Metal renderer does not support query heaps and always throws an exception.
+        \see CommandQueue::QueryResult
+        \see QueryHeapRing
+        */
+        virtual void ResolveQueries(QueryHeap& queryHeap, std::uint32_t firstQuery, std::uint32_t numQueries, Buffer& dstBuffer, std::uint64_t dstOffset) = 0;
+
         /**
         \brief Begins conditional rendering with the specified query object.
         \param[in] queryHeap Specifies the query heap.
@@ -59,6 +59,17 @@ struct CommandBufferFlags
         \see CommandQueue::Submit(CommandBuffer&)
         */
         MultiSubmit     = (1 << 1),
+
+        /**
+        \brief Specifies that the encoded commands can be optimized once the encoding has ended.
+        \remarks This is only a hint and mainly intended for command buffers that are also created with the MultiSubmit flag,
+        since the optimization pass is performed only once in CommandBuffer::End but each submission will benefit from it.
+        Only render systems that emulate command buffers make use of this flag (currently only the OpenGL backend).
+        Redundant state changes are removed and consecutive draw commands over adjacent vertex or index ranges may be merged into a single draw command,
+        which will affect the values of the primitive ID in the shader (i.e. \c gl_PrimitiveID in GLSL or \c SV_PrimitiveID in HLSL).
+        \see CommandBuffer::End
+        */
+        OptimizeCommands = (1 << 2),
     };
 };
 
@@ -180,6 +191,44 @@ struct OpenGLDependentStateDescriptor
     i.e. CCW becomes CW, and CW becomes CCW.
     */
     bool invertFrontFace = false;
+
+    /**
+    \brief Specifies whether consecutive indexed draw commands are batched into a single multi-draw command. By default false.
+    \remarks If this is true, consecutive calls to CommandBuffer::DrawIndexed and CommandBuffer::DrawIndexedInstanced
+    without any other command in between are submitted with a single call to \c glMultiDrawElementsIndirect
+    (if \c GL_ARB_multi_draw_indirect is supported) or \c glMultiDrawElementsBaseVertex.
+    For immediate command buffers, the batched draw commands are submitted on the next command that is not batched or on CommandBuffer::End.
+    Hence, resources that are modified outside of the command buffer (e.g. with RenderSystem::WriteBuffer) must not be modified while a batch is pending.
+    */
+    bool batchIndexedDraws = false;
+
+    /**
+    \brief Specifies whether texture, sampler, constant buffer, and storage buffer bindings are deferred until the next draw or dispatch command. By default false.
+    \remarks If this is true, the bindings of CommandBuffer::SetTexture, CommandBuffer::SetSampler, CommandBuffer::SetConstantBuffer etc. and of resource heaps
+    are only recorded, and all slots whose binding has actually changed are bound right before the next draw or dispatch command,
+    with one \c glBindTextures, \c glBindSamplers, or \c glBindBuffersBase call for each contiguous range of slots (if \c GL_ARB_multi_bind is supported).
+    */
+    bool lazyResourceBindings = false;
+
+    /**
+    \brief Specifies whether memory barriers for shader storage buffer writes are inserted automatically. By default false.
+    \remarks If this is true, the buffers that are bound with CommandBuffer::SetRWStorageBuffer or as read-write storage buffers in a resource heap
+    are considered to be written by each draw and dispatch command. Before a subsequent command reads one of these buffers,
+    a \c glMemoryBarrier call with only the barrier bits for the dependent accesses is inserted,
+    e.g. \c GL_COMMAND_BARRIER_BIT if the buffer is used as indirect argument buffer, or \c GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT if it is used as vertex buffer.
+    Consecutive indexed draw commands that are batched (see batchIndexedDraws) are treated as a single command.
+    \note Image load/store is not tracked, and transform feedback buffers do not require memory barriers.
+    */
+    bool automaticMemoryBarriers = false;
+
+    /**
+    \brief Specifies whether the memory barriers for shader storage buffer writes are reported to the log. By default false.
+    \remarks If this is true, the shader storage buffer writes are tracked as with automaticMemoryBarriers.
+    If automaticMemoryBarriers is false, a warning is reported for each access that depends on shader writes without a memory barrier.
+    Otherwise, each inserted memory barrier is reported as a performance message together with the buffer that caused it.
+    \see Log::SetReportCallback
+    */
+    bool reportMemoryBarriers = false;
 };
 
 /**
@@ -18,6 +18,7 @@
 #include "ColorRGB.h"
 #include "ColorRGBA.h"
 #include "RenderSystem.h"
+#include "QueryHeapRing.h"
 #include "Log.h"
 #include "IndirectArguments.h"
 #include "ImageFlags.h"
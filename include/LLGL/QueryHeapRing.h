@@ -0,0 +1,118 @@
+/*
+ * QueryHeapRing.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_QUERY_HEAP_RING_H
+#define LLGL_QUERY_HEAP_RING_H
+
+
+#include "NonCopyable.h"
+#include "QueryHeapFlags.h"
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+class RenderSystem;
+class CommandQueue;
+class QueryHeap;
+
+/**
+\brief Ring of query heaps to retrieve query results with a latency of several frames but without stalls.
+\remarks Each frame records its queries into the next query heap of the ring,
+and the results that have been recorded into the same query heap <code>numFrames</code> frames ago are retrieved before the heap is recorded again.
+By then, the GPU has usually finished these queries, so neither the CPU nor the GPU has to wait for the results.
+Here is a usage example:
+\code
+LLGL::QueryHeapDescriptor queryHeapDesc;
+queryHeapDesc.type = LLGL::QueryType::TimeElapsed;
+LLGL::QueryHeapRing timerQueries(*myRenderer, queryHeapDesc, 3);
+// for each frame ...
+auto& queryHeap = timerQueries.NextFrame();
+std::uint64_t elapsedTime = 0;
+if (timerQueries.QueryResult(*myCmdQueue, 0, 1, &elapsedTime, sizeof(elapsedTime)))
+{
+    // elapsed time of frame 'timerQueries.GetResultFrame()' ...
+}
+myCmdBuffer->BeginQuery(queryHeap);
+// draw scene ...
+myCmdBuffer->EndQuery(queryHeap);
+\endcode
+\see CommandBuffer::ResolveQueries
+\see CommandQueue::QueryResult
+*/
+class LLGL_EXPORT QueryHeapRing : public NonCopyable
+{
+
+    public:
+
+        /**
+        \brief Creates all query heaps of the ring.
+        \param[in] renderSystem Specifies the render system that creates and releases the query heaps.
+        \param[in] desc Specifies the descriptor for each query heap.
+        \param[in] numFrames Specifies the number of query heaps, i.e. the number of frames until the results are retrieved. This is clamped to at least 1. By default 3.
+        */
+        QueryHeapRing(RenderSystem& renderSystem, const QueryHeapDescriptor& desc, std::uint32_t numFrames = 3);
+
+        //! Releases all query heaps of the ring.
+        ~QueryHeapRing();
+
+        /**
+        \brief Advances to the next frame and returns the query heap to record the queries of this frame.
+        \remarks The results that have previously been recorded into this query heap can be retrieved with QueryResult before the heap is recorded again.
+        */
+        QueryHeap& NextFrame();
+
+        /**
+        \brief Retrieves the results that have been recorded into the current query heap <code>GetLatency()</code> frames ago.
+        \return True if the results are available. Otherwise, that frame has either not been recorded or the results are not ready yet,
+        in which case the output data is not modified and this function does not wait.
+        \see CommandQueue::QueryResult
+        */
+        bool QueryResult(CommandQueue& commandQueue, std::uint32_t firstQuery, std::uint32_t numQueries, void* data, std::size_t dataSize);
+
+        //! Returns the query heap of the current frame.
+        QueryHeap& GetCurrentQueryHeap() const;
+
+        //! Returns the index of the current frame, starting with 0 for the first call to NextFrame.
+        inline std::uint64_t GetFrame() const
+        {
+            return (frame_ > 0 ? frame_ - 1 : 0);
+        }
+
+        //! Returns the index of the frame whose results are retrieved by QueryResult.
+        inline std::uint64_t GetResultFrame() const
+        {
+            return (GetFrame() >= GetLatency() ? GetFrame() - GetLatency() : 0);
+        }
+
+        //! Returns the number of frames between recording the queries and retrieving their results.
+        inline std::uint32_t GetLatency() const
+        {
+            return static_cast<std::uint32_t>(queryHeaps_.size());
+        }
+
+    private:
+
+        RenderSystem&           renderSystem_;
+        std::vector<QueryHeap*> queryHeaps_;
+        std::uint64_t           frame_          = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -98,6 +98,28 @@ class LLGL_EXPORT RenderContext : public RenderTarget
         */
         virtual Format QueryDepthStencilFormat() const = 0;
 
+        /**
+        \brief Returns the index of the current frame within the frames in flight, i.e. a value in the range <code>[0, maxFramesInFlight)</code>.
+        \remarks This index is advanced by each call to Present and can be used to select the region of a streaming buffer that is written in the current frame.
+        The default implementation returns 0, which is also the case if the number of frames in flight is not limited,
+        or if the render system cannot limit them (e.g. OpenGL without \c GL_ARB_sync).
+        \note With RenderSystemConfiguration::dedicatedRenderThread, this index is advanced on the calling thread,
+        which can be a few frames ahead of the render thread. Buffer updates and mappings are still safe,
+        because they are executed by the render thread after it has waited for the respective frame.
+        A pointer from RenderSystem::MapBuffer must not be kept across calls to Present, though.
+        \see RenderContextDescriptor::maxFramesInFlight
+        */
+        virtual std::uint32_t GetCurrentFrame() const;
+
+        /**
+        \brief Queries the resource binding statistics of the previous frame, i.e. the frame before the last call to Present.
+        \param[out] stats Specifies the output statistics.
+        \return True if the statistics are available. The default implementation returns false.
+        \remarks This is only supported by the OpenGL render system, and only bindings that were deferred are counted.
+        \see OpenGLDependentStateDescriptor::lazyResourceBindings
+        */
+        virtual bool QueryResourceBindingStatistics(ResourceBindingStatistics& stats) const;
+
         /**
         \brief Returns the surface which is used to present the content on the screen.
         \remarks On desktop platforms, this can be statically casted to 'LLGL::Window&',
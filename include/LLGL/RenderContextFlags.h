@@ -150,6 +150,20 @@ struct ProfileOpenGLDescriptor
     int                     minorVersion    = -1;
 };
 
+/**
+\brief Resource binding statistics of a frame.
+\see RenderContext::QueryResourceBindingStatistics
+\see OpenGLDependentStateDescriptor::lazyResourceBindings
+*/
+struct ResourceBindingStatistics
+{
+    //! Number of texture, sampler, and buffer slots that were bound.
+    std::uint32_t numBindRequests   = 0;
+
+    //! Number of bind calls that were issued to the rendering API for these slots.
+    std::uint32_t numBindCalls      = 0;
+};
+
 //! Render context descriptor structure.
 struct RenderContextDescriptor
 {
@@ -165,6 +179,17 @@ struct RenderContextDescriptor
     //! OpenGL profile descriptor (to switch between compatability or core profile).
     ProfileOpenGLDescriptor profileOpenGL;
 
+    /**
+    \brief Specifies the maximum number of frames the CPU can be ahead of the GPU. By default 0.
+    \remarks If this is greater than zero, RenderContext::Present blocks until the GPU has finished the frame
+    that was presented \c maxFramesInFlight frames earlier. This keeps the input latency predictable,
+    and dynamic buffers can be partitioned into one region per frame in flight without being overwritten while the GPU still reads them.
+    If this is zero, the number of frames in flight is only limited by the driver.
+    \note Only supported by the OpenGL render system (requires \c GL_ARB_sync).
+    \see RenderContext::GetCurrentFrame
+    */
+    std::uint32_t           maxFramesInFlight   = 0;
+
     //! Debuging callback function object.
     DebugCallback           debugCallback;
 };
@@ -14,6 +14,7 @@
 #include "CommandQueue.h"
 #include "CommandBufferExt.h"
 #include "RenderSystemFlags.h"
+#include "ImageFlags.h"
 #include "RenderingProfiler.h"
 #include "RenderingDebugger.h"
 
@@ -276,6 +277,31 @@ class LLGL_EXPORT RenderSystem : public NonCopyable
         */
         virtual void UnmapBuffer(Buffer& buffer) = 0;
 
+        /**
+        \brief Maps a range of the specified buffer from GPU to CPU memory space.
+        \param[in] buffer Specifies the buffer which is to be mapped.
+        \param[in] offset Specifies the offset (in bytes) of the range which is to be mapped.
+        \param[in] size Specifies the size (in bytes) of the range which is to be mapped.
+        \param[in] flags Specifies the mapping flags. This must contain at least MapBufferFlags::Read or MapBufferFlags::Write.
+        \return Raw pointer to the beginning of the mapped range, or null if the buffer could not be mapped.
+        \remarks The buffer must be unmapped with UnmapBuffer.
+        The default implementation maps the entire buffer with MapBuffer and ignores all flags except MapBufferFlags::Read, MapBufferFlags::Write, and MapBufferFlags::InvalidateBuffer.
+        \see MapBufferFlags
+        \see FlushMappedBufferRange
+        \see UnmapBuffer
+        */
+        virtual void* MapBufferRange(Buffer& buffer, std::uint64_t offset, std::uint64_t size, long flags);
+
+        /**
+        \brief Makes modifications of a sub-range of a mapped buffer range visible to the GPU.
+        \param[in] buffer Specifies the buffer which has been mapped with the MapBufferFlags::FlushExplicit flag.
+        \param[in] offset Specifies the offset (in bytes) relative to the beginning of the mapped range.
+        \param[in] size Specifies the size (in bytes) of the range which is to be flushed.
+        \remarks The default implementation does nothing.
+        \see MapBufferRange
+        */
+        virtual void FlushMappedBufferRange(Buffer& buffer, std::uint64_t offset, std::uint64_t size);
+
         /* ----- Textures ----- */
 
         /**
@@ -336,6 +362,14 @@ class LLGL_EXPORT RenderSystem : public NonCopyable
         */
         virtual void ReadTexture(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc) = 0;
 
+        /**
+        \brief Returns true if the initial image data of the specified texture has been uploaded, i.e. the texture can be used.
+        \remarks This can only be false for textures that have been created with the MiscFlags::AsyncUpload flag.
+        The default implementation always returns true.
+        \see MiscFlags::AsyncUpload
+        */
+        virtual bool IsTextureResident(const Texture& texture);
+
         /**
         \brief Generates all MIP-maps for the specified texture.
         \param[in,out] texture Specifies the texture whose MIP-maps are to be generated.
@@ -368,6 +402,60 @@ class LLGL_EXPORT RenderSystem : public NonCopyable
             std::uint32_t   numArrayLayers  = 1
         ) = 0;
 
+        /**
+        \brief Begins to read the image data from the specified texture asynchronously.
+        \param[in] texture Specifies the texture object to read from.
+        \param[in] mipLevel Specifies the MIP-map level to read from.
+        \param[in] format Specifies the output image format.
+        \param[in] dataType Specifies the output image data type.
+        \return Non-zero ticket that identifies the readback. Each ticket must be released with ReleaseReadback.
+        \remarks In contrast to ReadTexture, this function does not stall the pipeline.
+        The image data is copied into intermediate memory by the GPU and can be accessed with MapReadback as soon as QueryReadback returns true.
+        The default implementation reads the texture synchronously with ReadTexture, i.e. the readback is complete when this function returns.
+        \code
+        // Begin readback in frame N
+        auto ticket = myRenderSystem->ReadTextureAsync(*myTexture, 0, LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8);
+
+        // Poll in a later frame
+        if (myRenderSystem->QueryReadback(ticket)) {
+            std::size_t dataSize = 0;
+            auto data = myRenderSystem->MapReadback(ticket, dataSize);
+            // Process image data ...
+            myRenderSystem->ReleaseReadback(ticket);
+        }
+        \endcode
+        \see QueryReadback
+        \see MapReadback
+        \see ReleaseReadback
+        */
+        virtual std::uint64_t ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel, ImageFormat format, DataType dataType);
+
+        /**
+        \brief Queries whether the specified texture readback has been completed.
+        \param[in] ticket Specifies the ticket that was returned by ReadTextureAsync.
+        \param[in] wait Specifies whether to block until the readback is complete. By default false.
+        \return True if the image data is available. Otherwise, MapReadback would block.
+        \see ReadTextureAsync
+        */
+        virtual bool QueryReadback(std::uint64_t ticket, bool wait = false);
+
+        /**
+        \brief Maps the image data of the specified texture readback into CPU memory space.
+        \param[in] ticket Specifies the ticket that was returned by ReadTextureAsync.
+        \param[out] dataSize Specifies the output size (in bytes) of the image data.
+        \return Pointer to the image data, or null if the ticket is invalid. This function blocks until the readback is complete.
+        \remarks The pointer remains valid until the ticket is released with ReleaseReadback.
+        \see ReadTextureAsync
+        */
+        virtual const void* MapReadback(std::uint64_t ticket, std::size_t& dataSize);
+
+        /**
+        \brief Releases the specified texture readback and its intermediate memory.
+        \param[in] ticket Specifies the ticket that was returned by ReadTextureAsync. After this call, the ticket must no longer be used.
+        \see ReadTextureAsync
+        */
+        virtual void ReleaseReadback(std::uint64_t ticket);
+
         /* ----- Samplers ---- */
 
         /**
@@ -445,6 +533,19 @@ class LLGL_EXPORT RenderSystem : public NonCopyable
         */
         virtual ShaderProgram* CreateShaderProgram(const ShaderProgramDescriptor& desc) = 0;
 
+        /**
+        \brief Creates multiple shader programs at once.
+        \param[in] numShaderPrograms Specifies the number of shader programs that are to be created.
+        \param[in] descs Pointer to an array of shader program descriptors. This must contain at least 'numShaderPrograms' elements.
+        \param[out] shaderPrograms Pointer to an array that receives the new shader programs. This must contain at least 'numShaderPrograms' elements.
+        \remarks Unlike calling CreateShaderProgram for each descriptor, this allows the render system to issue all link commands before any of them is waited for,
+        so a driver with a multi-threaded shader compiler (e.g. GL_KHR_parallel_shader_compile) can link all shader programs concurrently.
+        Whether the linking was successful must still be checked for each shader program with the \c HasErrors function.
+        The default implementation calls CreateShaderProgram for each descriptor.
+        \see CreateShaderProgram
+        */
+        virtual void CreateShaderPrograms(std::uint32_t numShaderPrograms, const ShaderProgramDescriptor* descs, ShaderProgram** shaderPrograms);
+
         //! Releases the specified Shader object. After this call, the specified object must no longer be used.
         virtual void Release(Shader& shader) = 0;
 
@@ -493,6 +594,15 @@ class LLGL_EXPORT RenderSystem : public NonCopyable
         //! Releases the specified ComputePipeline object. After this call, the specified object must no longer be used.
         virtual void Release(ComputePipeline& computePipeline) = 0;
 
+        /**
+        \brief Queries the statistics of the cache for pipeline states that are shared between graphics pipelines.
+        \param[out] stats Specifies the output statistics.
+        \return True if the render system shares pipeline states between graphics pipelines. Otherwise, the output parameter is not modified.
+        \remarks This is only supported by the OpenGL renderer.
+        \see PipelineStateCacheStatistics
+        */
+        virtual bool QueryPipelineStateCacheStatistics(PipelineStateCacheStatistics& stats) const;
+
         /* ----- Queries ----- */
 
         //! Creates a new query heap.
@@ -152,6 +152,56 @@ enum class CPUAccess
 };
 
 
+/* ----- Flags ----- */
+
+/**
+\brief Buffer range mapping flags enumeration.
+\see RenderSystem::MapBufferRange
+*/
+struct MapBufferFlags
+{
+    enum
+    {
+        /**
+        \brief CPU read access to the mapped range.
+        \remarks The respective buffer must have been created with the CPUAccessFlags::Read flag.
+        */
+        Read                = (1 << 0),
+
+        /**
+        \brief CPU write access to the mapped range.
+        \remarks The respective buffer must have been created with the CPUAccessFlags::Write flag.
+        */
+        Write               = (1 << 1),
+
+        /**
+        \brief The previous content of the mapped range can be discarded.
+        \remarks This must not be combined with the MapBufferFlags::Read flag.
+        */
+        InvalidateRange     = (1 << 2),
+
+        /**
+        \brief The previous content of the entire buffer can be discarded.
+        \remarks This must not be combined with the MapBufferFlags::Read flag.
+        */
+        InvalidateBuffer    = (1 << 3),
+
+        /**
+        \brief Modifications of the mapped range are only made visible to the GPU with RenderSystem::FlushMappedBufferRange.
+        \remarks This must be combined with the MapBufferFlags::Write flag. Ranges that are not flushed before the buffer is unmapped are undefined.
+        */
+        FlushExplicit       = (1 << 4),
+
+        /**
+        \brief The render system does not synchronize the mapping with pending GPU operations on the buffer.
+        \remarks The client is responsible to not modify any range the GPU is still reading from, e.g. by using a Fence.
+        \note Only supported with: OpenGL. Ignored by other render systems.
+        */
+        Unsynchronized      = (1 << 5),
+    };
+};
+
+
 /* ----- Structures ----- */
 
 //! Structure of image initialization for textures without initial image data.
@@ -187,7 +237,51 @@ struct RenderSystemConfiguration
     to convert the image data into the respective hardware texture format. OpenGL does this automatically.
     \see Constants::maxThreadCount
     */
-    std::size_t         threadCount         = Constants::maxThreadCount;
+    std::size_t         threadCount             = Constants::maxThreadCount;
+
+    /**
+    \brief Specifies whether the OpenGL render system executes all GL commands on a dedicated render thread. By default false.
+    \remarks If enabled, the GL context is owned by an internal render thread and command buffers are always recorded as deferred command buffers.
+    Submitting a command buffer copies its commands into a lock-free command ring and returns immediately, and so does RenderContext::Present
+    unless too many frames are already queued. All other functions that access the GL context are forwarded to the render thread and block until they have been executed.
+    Secondary command buffers are executed by reference, i.e. they must not be re-recorded while a submitted primary command buffer refers to them.
+    ShaderProgram::LockShaderUniform always returns null in this mode.
+    \note Only supported with OpenGL. This must be set before the first render context is created.
+    */
+    bool                dedicatedRenderThread   = false;
+
+    /**
+    \brief Specifies the directory of the on-disk shader program cache. By default empty, i.e. the cache is disabled.
+    \remarks If specified, linked shader programs are stored as driver-specific binaries within this directory,
+    and subsequent runs load them instead of linking the shader programs again. Each binary is identified by the source code of its shaders
+    and the vendor, renderer, and version of the driver. If a binary is missing or rejected by the driver, the shader program is linked from source.
+    The number of cache hits and misses is reported via Log::PostReport when the render system is unloaded.
+    \note Only supported with OpenGL (requires GL_ARB_get_program_binary). The directory must already exist.
+    */
+    std::string         programCacheDirectory;
+
+    /**
+    \brief Specifies whether graphics shader programs are combined from separately linked shaders. By default false.
+    \remarks If enabled, each shader is linked into its own separable program the first time it is used by a shader program,
+    and a shader program only combines these programs into a program pipeline object. Hence, shader programs that share the same shaders don't link them again.
+    A vertex shader is linked once for each distinct list of vertex formats, since the vertex formats determine the vertex attribute locations.
+    The shaders must be written for separable programs, e.g. GLSL vertex, tessellation, and geometry shaders must redeclare the built-in output block \c gl_PerVertex.
+    For such shader programs, ShaderProgram::LockShaderUniform always returns null,
+    and ShaderProgram::BindConstantBuffer and ShaderProgram::BindStorageBuffer affect all shader programs that share the same shader.
+    Compute shader programs are linked as usual, and separable programs are not stored in the on-disk program cache (see programCacheDirectory).
+    \note Only supported with OpenGL (requires GL_ARB_separate_shader_objects). Otherwise, this member is ignored.
+    */
+    bool                separableShaderPrograms = false;
+
+    /**
+    \brief Specifies whether render contexts are created without a window or display server. By default false.
+    \remarks If enabled, each render context renders into an off-screen surface with the resolution of its video mode,
+    which is useful for automated tests and server-side rendering. RenderContext::Present only flushes the GL command queue in this mode,
+    and the surface of the render context is a Window that is never shown and does not receive any events.
+    \note Only supported with OpenGL on Linux (requires the CMake option LLGL_GL_ENABLE_EGL and an EGL config with pbuffer support).
+    A headless render context is also created automatically if no surface is specified and the DISPLAY environment variable is not set.
+    */
+    bool                headlessRenderContexts  = false;
 };
 
 /**
@@ -663,6 +757,32 @@ struct RenderingCapabilities
     RenderingLimits                 limits;
 };
 
+/**
+\brief Statistics of the cache for the depth-stencil, rasterizer, and blend states that are shared between graphics pipelines.
+\remarks This can be used to evaluate how many pipeline states are shared between graphics pipelines.
+\see RenderSystem::QueryPipelineStateCacheStatistics
+*/
+struct PipelineStateCacheStatistics
+{
+    //! Number of unique depth-stencil states in the cache.
+    std::size_t numDepthStencilStates   = 0;
+
+    //! Number of unique rasterizer states in the cache.
+    std::size_t numRasterizerStates     = 0;
+
+    //! Number of unique blend states in the cache.
+    std::size_t numBlendStates          = 0;
+
+    //! Number of lookups for all state types, i.e. one lookup per state type and graphics pipeline.
+    std::size_t numLookups              = 0;
+
+    //! Number of lookups that returned an existing state.
+    std::size_t numHits                 = 0;
+
+    //! Number of states that compared unequal despite an equal hash.
+    std::size_t numHashCollisions       = 0;
+};
+
 
 /* ----- Functions ----- */
 
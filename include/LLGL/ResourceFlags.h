@@ -184,6 +184,16 @@ struct MiscFlags
         \remarks This can only be used with multi-sampled Texture resources (i.e. TextureType::Texture2DMS, TextureType::Texture2DMSArray).
         */
         FixedSamples = (1 << 1),
+
+        /**
+        \brief Texture resource is initialized asynchronously.
+        \remarks With this flag, RenderSystem::CreateTexture returns immediately and the initial image data is uploaded in the background.
+        The texture must not be used until RenderSystem::IsTextureResident returns true for it.
+        If the render system does not support asynchronous uploads, the texture is initialized immediately.
+        \note Only supported with OpenGL on Windows, Linux, and macOS (a shared GL context is created on a loader thread). Compressed and multi-sampled textures are always initialized immediately.
+        \see RenderSystem::IsTextureResident
+        */
+        AsyncUpload = (1 << 2),
     };
 };
 
@@ -28,6 +28,13 @@ class LLGL_EXPORT ShaderUniform : public NonCopyable
 
     public:
 
+        /**
+        \brief Returns the location of the specified uniform, or -1 if the shader program has no such active uniform.
+        \remarks Use this to resolve uniform names once, and pass the returned location to the setter functions in hot code paths,
+        e.g. for per-draw uniform updates. The locations of all active uniforms (including each element of uniform arrays) remain valid for the lifetime of the shader program.
+        */
+        virtual UniformLocation GetUniformLocation(const char* name) = 0;
+
         /**
         \brief Sets an integral scalar uniform.
         \remarks This can be used to set the binding slot for samplers, like in the following GLSL example:
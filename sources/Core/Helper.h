@@ -55,6 +55,13 @@ void InitMemory(T& data)
     ::memset(&data, 0, sizeof(T));
 }
 
+// Combines the hash of the specified value with the hash 'seed' (same as boost::hash_combine).
+template <typename T>
+void HashCombine(std::size_t& seed, const T& value)
+{
+    seed ^= std::hash<T>{}(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
 // Fills the specified container with 'value' (using std::fill).
 template <class Container, class T>
 void Fill(Container& cont, const T& value)
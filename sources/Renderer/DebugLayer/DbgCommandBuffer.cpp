@@ -572,6 +572,42 @@ void DbgCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t query)
     instance.EndQuery(queryHeapDbg.instance, query);
 }
 
+void DbgCommandBuffer::ResolveQueries(QueryHeap& queryHeap, std::uint32_t firstQuery, std::uint32_t numQueries, Buffer& dstBuffer, std::uint64_t dstOffset)
+{
+    auto& queryHeapDbg = LLGL_CAST(DbgQueryHeap&, queryHeap);
+    auto& dstBufferDbg = LLGL_CAST(DbgBuffer&, dstBuffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        AssertRecording();
+
+        if (queryHeapDbg.desc.renderCondition)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot resolve queries that are used as render condition");
+
+        if (numQueries == 0)
+            LLGL_DBG_WARN(WarningType::PointlessOperation, "no queries are resolved");
+        else if (ValidateQueryIndex(queryHeapDbg, firstQuery) && ValidateQueryIndex(queryHeapDbg, firstQuery + numQueries - 1))
+        {
+            for (std::uint32_t i = 0; i < numQueries; ++i)
+            {
+                if (queryHeapDbg.states[firstQuery + i] == DbgQueryHeap::State::Busy)
+                    LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot resolve query that has not ended");
+            }
+        }
+
+        /* Validate destination buffer range for 64-bit results */
+        const auto resultSize = static_cast<std::uint64_t>(
+            queryHeapDbg.GetType() == QueryType::PipelineStatistics
+                ? sizeof(QueryPipelineStatistics)
+                : sizeof(std::uint64_t)
+        );
+        ValidateBufferRange(dstBufferDbg, dstOffset, resultSize * numQueries);
+    }
+
+    instance.ResolveQueries(queryHeapDbg.instance, firstQuery, numQueries, dstBufferDbg.instance, dstOffset);
+}
+
 void DbgCommandBuffer::BeginRenderCondition(QueryHeap& queryHeap, std::uint32_t query, const RenderConditionMode mode)
 {
     auto& queryHeapDbg = LLGL_CAST(DbgQueryHeap&, queryHeap);
@@ -117,6 +117,8 @@ class DbgCommandBuffer : public CommandBufferExt
         void BeginQuery(QueryHeap& queryHeap, std::uint32_t query = 0) override;
         void EndQuery(QueryHeap& queryHeap, std::uint32_t query = 0) override;
 
+        void ResolveQueries(QueryHeap& queryHeap, std::uint32_t firstQuery, std::uint32_t numQueries, Buffer& dstBuffer, std::uint64_t dstOffset) override;
+
         void BeginRenderCondition(QueryHeap& queryHeap, std::uint32_t query = 0, const RenderConditionMode mode = RenderConditionMode::Wait) override;
         void EndRenderCondition() override;
 
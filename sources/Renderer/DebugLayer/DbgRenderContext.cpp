@@ -33,6 +33,16 @@ Format DbgRenderContext::QueryDepthStencilFormat() const
     return instance.QueryDepthStencilFormat();
 }
 
+std::uint32_t DbgRenderContext::GetCurrentFrame() const
+{
+    return instance.GetCurrentFrame();
+}
+
+bool DbgRenderContext::QueryResourceBindingStatistics(ResourceBindingStatistics& stats) const
+{
+    return instance.QueryResourceBindingStatistics(stats);
+}
+
 const RenderPass* DbgRenderContext::GetRenderPass() const
 {
     return instance.GetRenderPass();
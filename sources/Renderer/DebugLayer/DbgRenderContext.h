@@ -32,6 +32,10 @@ class DbgRenderContext : public RenderContext
         Format QueryColorFormat() const override;
         Format QueryDepthStencilFormat() const override;
 
+        std::uint32_t GetCurrentFrame() const override;
+
+        bool QueryResourceBindingStatistics(ResourceBindingStatistics& stats) const override;
+
         const RenderPass* GetRenderPass() const override;
 
         /* ----- Debugging members ----- */
@@ -231,6 +231,42 @@ void DbgRenderSystem::UnmapBuffer(Buffer& buffer)
     bufferDbg.mapped = false;
 }
 
+void* DbgRenderSystem::MapBufferRange(Buffer& buffer, std::uint64_t offset, std::uint64_t size, long flags)
+{
+    auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        ValidateMapBufferFlags(flags, bufferDbg.desc.cpuAccessFlags);
+        ValidateBufferBoundary(bufferDbg.desc.size, offset, size);
+        ValidateBufferMapping(bufferDbg, true);
+    }
+
+    auto result = instance_->MapBufferRange(bufferDbg.instance, offset, size, flags);
+
+    bufferDbg.mapped = true;
+
+    if (profiler_)
+        profiler_->frameProfile.bufferMappings++;
+
+    return result;
+}
+
+void DbgRenderSystem::FlushMappedBufferRange(Buffer& buffer, std::uint64_t offset, std::uint64_t size)
+{
+    auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        if (!bufferDbg.mapped)
+            LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot flush range of buffer that was not previously mapped to CPU local memory");
+    }
+
+    instance_->FlushMappedBufferRange(bufferDbg.instance, offset, size);
+}
+
 /* ----- Textures ----- */
 
 Texture* DbgRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc)
@@ -293,6 +329,12 @@ void DbgRenderSystem::ReadTexture(const Texture& texture, std::uint32_t mipLevel
     instance_->ReadTexture(textureDbg.instance, mipLevel, imageDesc);
 }
 
+bool DbgRenderSystem::IsTextureResident(const Texture& texture)
+{
+    auto& textureDbg = LLGL_CAST(const DbgTexture&, texture);
+    return instance_->IsTextureResident(textureDbg.instance);
+}
+
 void DbgRenderSystem::GenerateMips(Texture& texture)
 {
     auto& textureDbg = LLGL_CAST(DbgTexture&, texture);
@@ -330,6 +372,42 @@ void DbgRenderSystem::GenerateMips(Texture& texture, std::uint32_t baseMipLevel,
         profiler_->frameProfile.mipMapsGenerations++;
 }
 
+std::uint64_t DbgRenderSystem::ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel, ImageFormat format, DataType dataType)
+{
+    auto& textureDbg = LLGL_CAST(const DbgTexture&, texture);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        ValidateMipLevelLimit(mipLevel, textureDbg.mipLevels);
+    }
+
+    return instance_->ReadTextureAsync(textureDbg.instance, mipLevel, format, dataType);
+}
+
+bool DbgRenderSystem::QueryReadback(std::uint64_t ticket, bool wait)
+{
+    return instance_->QueryReadback(ticket, wait);
+}
+
+const void* DbgRenderSystem::MapReadback(std::uint64_t ticket, std::size_t& dataSize)
+{
+    auto data = instance_->MapReadback(ticket, dataSize);
+
+    if (debugger_ && data == nullptr)
+    {
+        LLGL_DBG_SOURCE;
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "invalid ticket passed to texture readback mapping");
+    }
+
+    return data;
+}
+
+void DbgRenderSystem::ReleaseReadback(std::uint64_t ticket)
+{
+    instance_->ReleaseReadback(ticket);
+}
+
 /* ----- Sampler States ---- */
 
 Sampler* DbgRenderSystem::CreateSampler(const SamplerDescriptor& desc)
@@ -450,7 +528,7 @@ static Shader* GetInstanceShader(Shader* shader)
     return nullptr;
 }
 
-ShaderProgram* DbgRenderSystem::CreateShaderProgram(const ShaderProgramDescriptor& desc)
+static ShaderProgramDescriptor GetInstanceShaderProgramDesc(const ShaderProgramDescriptor& desc)
 {
     ShaderProgramDescriptor instanceDesc;
     {
@@ -462,9 +540,31 @@ ShaderProgram* DbgRenderSystem::CreateShaderProgram(const ShaderProgramDescripto
         instanceDesc.fragmentShader         = GetInstanceShader(desc.fragmentShader);
         instanceDesc.computeShader          = GetInstanceShader(desc.computeShader);
     }
+    return instanceDesc;
+}
+
+ShaderProgram* DbgRenderSystem::CreateShaderProgram(const ShaderProgramDescriptor& desc)
+{
+    auto instanceDesc = GetInstanceShaderProgramDesc(desc);
     return TakeOwnership(shaderPrograms_, MakeUnique<DbgShaderProgram>(*instance_->CreateShaderProgram(instanceDesc), debugger_, desc, caps_));
 }
 
+void DbgRenderSystem::CreateShaderPrograms(std::uint32_t numShaderPrograms, const ShaderProgramDescriptor* descs, ShaderProgram** shaderPrograms)
+{
+    /* Create all shader program instances at once */
+    std::vector<ShaderProgramDescriptor> instanceDescs;
+    instanceDescs.reserve(numShaderPrograms);
+
+    for (std::uint32_t i = 0; i < numShaderPrograms; ++i)
+        instanceDescs.push_back(GetInstanceShaderProgramDesc(descs[i]));
+
+    instance_->CreateShaderPrograms(numShaderPrograms, instanceDescs.data(), shaderPrograms);
+
+    /* Replace instances by debug layer shader programs */
+    for (std::uint32_t i = 0; i < numShaderPrograms; ++i)
+        shaderPrograms[i] = TakeOwnership(shaderPrograms_, MakeUnique<DbgShaderProgram>(*shaderPrograms[i], debugger_, descs[i], caps_));
+}
+
 void DbgRenderSystem::Release(Shader& shader)
 {
     ReleaseDbg(shaders_, shader);
@@ -542,6 +642,11 @@ void DbgRenderSystem::Release(ComputePipeline& computePipeline)
     ReleaseDbg(computePipelines_, computePipeline);
 }
 
+bool DbgRenderSystem::QueryPipelineStateCacheStatistics(PipelineStateCacheStatistics& stats) const
+{
+    return instance_->QueryPipelineStateCacheStatistics(stats);
+}
+
 /* ----- Queries ----- */
 
 QueryHeap* DbgRenderSystem::CreateQueryHeap(const QueryHeapDescriptor& desc)
@@ -754,6 +859,38 @@ void DbgRenderSystem::ValidateBufferMapping(DbgBuffer& bufferDbg, bool mapMemory
     }
 }
 
+void DbgRenderSystem::ValidateMapBufferFlags(long flags, long cpuAccessFlags)
+{
+    if ((flags & (MapBufferFlags::Read | MapBufferFlags::Write)) == 0)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot map buffer range without 'LLGL::MapBufferFlags::Read' or 'LLGL::MapBufferFlags::Write' flag");
+
+    if ((flags & MapBufferFlags::Read) != 0)
+    {
+        if ((cpuAccessFlags & CPUAccessFlags::Read) == 0)
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidState,
+                "cannot map buffer range with CPU read access, because the resource was not created with 'LLGL::CPUAccessFlags::Read' flag"
+            );
+        }
+        if ((flags & (MapBufferFlags::InvalidateRange | MapBufferFlags::InvalidateBuffer)) != 0)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot invalidate buffer range that is mapped with CPU read access");
+    }
+
+    if ((flags & MapBufferFlags::Write) != 0)
+    {
+        if ((cpuAccessFlags & CPUAccessFlags::Write) == 0)
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidState,
+                "cannot map buffer range with CPU write access, because the resource was not created with 'LLGL::CPUAccessFlags::Write' flag"
+            );
+        }
+    }
+    else if ((flags & MapBufferFlags::FlushExplicit) != 0)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot map buffer range with 'LLGL::MapBufferFlags::FlushExplicit' flag but without CPU write access");
+}
+
 void DbgRenderSystem::ValidateTextureDesc(const TextureDescriptor& desc)
 {
     switch (desc.type)
@@ -73,6 +73,9 @@ class DbgRenderSystem : public RenderSystem
         void* MapBuffer(Buffer& buffer, const CPUAccess access) override;
         void UnmapBuffer(Buffer& buffer) override;
 
+        void* MapBufferRange(Buffer& buffer, std::uint64_t offset, std::uint64_t size, long flags) override;
+        void FlushMappedBufferRange(Buffer& buffer, std::uint64_t offset, std::uint64_t size) override;
+
         /* ----- Textures ----- */
 
         Texture* CreateTexture(const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc = nullptr) override;
@@ -82,9 +85,16 @@ class DbgRenderSystem : public RenderSystem
         void WriteTexture(Texture& texture, const TextureRegion& textureRegion, const SrcImageDescriptor& imageDesc) override;
         void ReadTexture(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc) override;
 
+        bool IsTextureResident(const Texture& texture) override;
+
         void GenerateMips(Texture& texture) override;
         void GenerateMips(Texture& texture, std::uint32_t baseMipLevel, std::uint32_t numMipLevels, std::uint32_t baseArrayLayer = 0, std::uint32_t numArrayLayers = 1) override;
 
+        std::uint64_t ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel, ImageFormat format, DataType dataType) override;
+        bool QueryReadback(std::uint64_t ticket, bool wait = false) override;
+        const void* MapReadback(std::uint64_t ticket, std::size_t& dataSize) override;
+        void ReleaseReadback(std::uint64_t ticket) override;
+
         /* ----- Sampler States ---- */
 
         Sampler* CreateSampler(const SamplerDescriptor& desc) override;
@@ -114,6 +124,7 @@ class DbgRenderSystem : public RenderSystem
         Shader* CreateShader(const ShaderDescriptor& desc) override;
 
         ShaderProgram* CreateShaderProgram(const ShaderProgramDescriptor& desc) override;
+        void CreateShaderPrograms(std::uint32_t numShaderPrograms, const ShaderProgramDescriptor* descs, ShaderProgram** shaderPrograms) override;
 
         void Release(Shader& shader) override;
         void Release(ShaderProgram& shaderProgram) override;
@@ -132,6 +143,8 @@ class DbgRenderSystem : public RenderSystem
         void Release(GraphicsPipeline& graphicsPipeline) override;
         void Release(ComputePipeline& computePipeline) override;
 
+        bool QueryPipelineStateCacheStatistics(PipelineStateCacheStatistics& stats) const override;
+
         /* ----- Queries ----- */
 
         QueryHeap* CreateQueryHeap(const QueryHeapDescriptor& desc) override;
@@ -156,6 +169,7 @@ class DbgRenderSystem : public RenderSystem
         void ValidateConstantBufferSize(std::uint64_t size);
         void ValidateBufferBoundary(std::uint64_t bufferSize, std::uint64_t dstOffset, std::uint64_t dataSize);
         void ValidateBufferMapping(DbgBuffer& bufferDbg, bool mapMemory);
+        void ValidateMapBufferFlags(long flags, long cpuAccessFlags);
 
         void ValidateTextureDesc(const TextureDescriptor& desc);
         void ValidateTextureDescMipLevels(const TextureDescriptor& desc);
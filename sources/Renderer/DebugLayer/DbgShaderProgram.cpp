@@ -19,7 +19,7 @@ DbgShaderProgram::DbgShaderProgram(
     ShaderProgram&                  instance,
     RenderingDebugger*              debugger,
     const ShaderProgramDescriptor&  desc,
-    const RenderingCapabilities&    caps)
+    const RenderingCapabilities&    /*caps*/)
 :   instance  { instance },
     debugger_ { debugger }
 {
@@ -34,7 +34,6 @@ DbgShaderProgram::DbgShaderProgram(
         ValidateShaderAttachment(desc.fragmentShader);
         ValidateShaderAttachment(desc.computeShader);
         ValidateShaderComposition();
-        QueryInstanceAndVertexIDs(caps);
     }
 
     /* Store all attributes of vertex layout */
@@ -93,11 +92,13 @@ bool DbgShaderProgram::GetWorkGroupSize(Extent3D& workGroupSize) const
 
 const char* DbgShaderProgram::GetVertexID() const
 {
+    QueryInstanceAndVertexIDs();
     return (vertexID_.empty() ? nullptr : vertexID_.c_str());
 }
 
 const char* DbgShaderProgram::GetInstanceID() const
 {
+    QueryInstanceAndVertexIDs();
     return (instanceID_.empty() ? nullptr : instanceID_.c_str());
 }
 
@@ -160,8 +161,14 @@ void DbgShaderProgram::ValidateShaderComposition()
     }
 }
 
-void DbgShaderProgram::QueryInstanceAndVertexIDs(const RenderingCapabilities& caps)
+// Reflection is queried on first use, so the instance is not forced to wait for the shader program to be linked
+void DbgShaderProgram::QueryInstanceAndVertexIDs() const
 {
+    if (!debugger_ || idsQueried_)
+        return;
+
+    idsQueried_ = true;
+
     try
     {
         auto reflect = instance.QueryReflectionDesc();
@@ -75,7 +75,7 @@ class DbgShaderProgram : public ShaderProgram
 
         void ValidateShaderAttachment(Shader* shader);
         void ValidateShaderComposition();
-        void QueryInstanceAndVertexIDs(const RenderingCapabilities& caps);
+        void QueryInstanceAndVertexIDs() const;
 
         RenderingDebugger*      debugger_               = nullptr;
         int                     shaderAttachmentMask_   = 0;
@@ -83,8 +83,9 @@ class DbgShaderProgram : public ShaderProgram
         std::vector<ShaderType> shaderTypes_;
         VertexLayout            vertexLayout_;
 
-        std::string             vertexID_;
-        std::string             instanceID_;
+        mutable std::string     vertexID_;
+        mutable std::string     instanceID_;
+        mutable bool            idsQueried_             = false;
 
 };
 
@@ -12,6 +12,9 @@
 #include <LLGL/Platform/NativeHandle.h>
 #include "../../Core/Helper.h"
 #include <algorithm>
+#include <stdexcept>
+#include <thread>
+#include <vector>
 
 #include "RenderState/D3D11StateManager.h"
 #include "RenderState/D3D11GraphicsPipelineBase.h"
@@ -389,6 +392,30 @@ void D3D11CommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t query)
     }
 }
 
+void D3D11CommandBuffer::ResolveQueries(QueryHeap& queryHeap, std::uint32_t firstQuery, std::uint32_t numQueries, Buffer& dstBuffer, std::uint64_t dstOffset)
+{
+    /* Query results can only be read back on the immediate context */
+    if (hasDeferredContext_)
+        throw std::runtime_error("cannot resolve queries in D3D11 command buffer with deferred context");
+
+    if (numQueries == 0)
+        return;
+
+    auto& queryHeapD3D = LLGL_CAST(D3D11QueryHeap&, queryHeap);
+    auto& dstBufferD3D = LLGL_CAST(D3D11Buffer&, dstBuffer);
+
+    /* Determine size of each result; QueryPipelineStatistics only consists of 64-bit integers */
+    const std::size_t resultSize = (queryHeapD3D.GetNativeType() == D3D11_QUERY_PIPELINE_STATISTICS ? sizeof(QueryPipelineStatistics) : sizeof(std::uint64_t));
+    const std::size_t dataSize   = numQueries * resultSize;
+
+    /* D3D11 has no command to write query data into a buffer, so wait for the results and upload them */
+    std::vector<std::uint64_t> data(dataSize / sizeof(std::uint64_t));
+    while (!queryHeapD3D.QueryResult(context_.Get(), firstQuery, numQueries, data.data(), dataSize))
+        std::this_thread::yield();
+
+    dstBufferD3D.UpdateSubresource(context_.Get(), data.data(), static_cast<UINT>(dataSize), static_cast<UINT>(dstOffset));
+}
+
 void D3D11CommandBuffer::BeginRenderCondition(QueryHeap& queryHeap, std::uint32_t query, const RenderConditionMode mode)
 {
     auto& queryHeapD3D = LLGL_CAST(D3D11QueryHeap&, queryHeap);
@@ -113,6 +113,8 @@ class D3D11CommandBuffer final : public CommandBufferExt
         void BeginQuery(QueryHeap& queryHeap, std::uint32_t query) override;
         void EndQuery(QueryHeap& queryHeap, std::uint32_t query) override;
 
+        void ResolveQueries(QueryHeap& queryHeap, std::uint32_t firstQuery, std::uint32_t numQueries, Buffer& dstBuffer, std::uint64_t dstOffset) override;
+
         void BeginRenderCondition(QueryHeap& queryHeap, std::uint32_t query, const RenderConditionMode mode) override;
         void EndRenderCondition() override;
 
@@ -20,8 +20,6 @@ namespace LLGL
 {
 
 
-class D3D11QueryHeap;
-
 class D3D11CommandQueue final : public CommandQueue
 {
 
@@ -52,33 +50,6 @@ class D3D11CommandQueue final : public CommandQueue
 
     private:
 
-        bool QueryResultSingleUInt64(
-            D3D11QueryHeap& queryHeapD3D,
-            std::uint32_t   query,
-            std::uint64_t&  data
-        );
-
-        bool QueryResultUInt32(
-            D3D11QueryHeap& queryHeapD3D,
-            std::uint32_t   firstQuery,
-            std::uint32_t   numQueries,
-            std::uint32_t*  data
-        );
-
-        bool QueryResultUInt64(
-            D3D11QueryHeap& queryHeapD3D,
-            std::uint32_t   firstQuery,
-            std::uint32_t   numQueries,
-            std::uint64_t*  data
-        );
-
-        bool QueryResultPipelineStatistics(
-            D3D11QueryHeap&             queryHeapD3D,
-            std::uint32_t               firstQuery,
-            std::uint32_t               numQueries,
-            QueryPipelineStatistics*    data
-        );
-
         ComPtr<ID3D11DeviceContext> context_;
         D3D11Fence                  intermediateFence_;
 
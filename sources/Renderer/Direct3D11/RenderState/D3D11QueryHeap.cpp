@@ -8,6 +8,7 @@
 #include "D3D11QueryHeap.h"
 #include "../D3D11Types.h"
 #include "../../DXCommon/DXCore.h"
+#include <cstddef>
 
 
 namespace LLGL
@@ -89,6 +90,208 @@ D3D11QueryHeap::D3D11QueryHeap(ID3D11Device* device, const QueryHeapDescriptor&
     }
 }
 
+bool D3D11QueryHeap::QueryResult(
+    ID3D11DeviceContext*    context,
+    std::uint32_t           firstQuery,
+    std::uint32_t           numQueries,
+    void*                   data,
+    std::size_t             dataSize)
+{
+    if (dataSize == numQueries * sizeof(std::uint32_t))
+        return QueryResultUInt32(context, firstQuery, numQueries, reinterpret_cast<std::uint32_t*>(data));
+    if (dataSize == numQueries * sizeof(std::uint64_t))
+        return QueryResultUInt64(context, firstQuery, numQueries, reinterpret_cast<std::uint64_t*>(data));
+    if (dataSize == numQueries * sizeof(QueryPipelineStatistics))
+        return QueryResultPipelineStatistics(context, firstQuery, numQueries, reinterpret_cast<QueryPipelineStatistics*>(data));
+    return false;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool D3D11QueryHeap::QueryResultSingleUInt64(
+    ID3D11DeviceContext*    context,
+    std::uint32_t           query,
+    std::uint64_t&          data)
+{
+    switch (GetNativeType())
+    {
+        /* Query result from data of type: UINT64 */
+        case D3D11_QUERY_OCCLUSION:
+        {
+            UINT64 tempData = 0;
+            if (context->GetData(GetNative(query), &tempData, sizeof(tempData), 0) == S_OK)
+            {
+                data = tempData;
+                return true;
+            }
+        }
+        break;
+
+        /* Query result from special case query type: TimeElapsed */
+        case D3D11_QUERY_TIMESTAMP_DISJOINT:
+        {
+            query *= GetGroupSize();
+
+            UINT64 startTime = 0;
+            if (context->GetData(GetNative(query + 1), &startTime, sizeof(startTime), 0) == S_OK)
+            {
+                UINT64 endTime = 0;
+                if (context->GetData(GetNative(query + 2), &endTime, sizeof(endTime), 0) == S_OK)
+                {
+                    D3D11_QUERY_DATA_TIMESTAMP_DISJOINT disjointData;
+                    if (context->GetData(GetNative(query), &disjointData, sizeof(disjointData), 0) == S_OK)
+                    {
+                        if (disjointData.Disjoint == FALSE)
+                        {
+                            /* Normalize elapsed time to nanoseconds */
+                            static const double nanoseconds = 1000000000.0;
+
+                            auto deltaTime      = (endTime - startTime);
+                            auto scale          = (nanoseconds / static_cast<double>(disjointData.Frequency));
+                            auto elapsedTime    = (static_cast<double>(deltaTime) * scale);
+
+                            data = static_cast<std::uint64_t>(elapsedTime + 0.5);
+                        }
+                        else
+                            data = 0;
+                        return true;
+                    }
+                }
+            }
+        }
+        break;
+
+        /* Query result from data of type: BOOL */
+        case D3D11_QUERY_OCCLUSION_PREDICATE:
+        case D3D11_QUERY_SO_OVERFLOW_PREDICATE:
+        {
+            BOOL tempData = FALSE;
+            if (context->GetData(GetPredicate(query), &tempData, sizeof(tempData), 0) == S_OK)
+            {
+                data = tempData;
+                return true;
+            }
+        }
+        break;
+
+        /* Query result from data of type: D3D11_QUERY_DATA_SO_STATISTICS */
+        case D3D11_QUERY_SO_STATISTICS:
+        {
+            D3D11_QUERY_DATA_SO_STATISTICS tempData;
+            if (context->GetData(GetNative(query), &tempData, sizeof(tempData), 0) == S_OK)
+            {
+                data = tempData.NumPrimitivesWritten;
+                return true;
+            }
+        }
+        break;
+
+        default:
+        break;
+    }
+
+    return false;
+}
+
+bool D3D11QueryHeap::QueryResultUInt32(
+    ID3D11DeviceContext*    context,
+    std::uint32_t           firstQuery,
+    std::uint32_t           numQueries,
+    std::uint32_t*          data)
+{
+    for (std::uint32_t i = 0; i < numQueries; ++i)
+    {
+        std::uint64_t tempData = 0;
+        if (QueryResultSingleUInt64(context, firstQuery + i, tempData))
+            data[i] = static_cast<std::uint32_t>(tempData);
+        else
+            return false;
+    }
+    return true;
+}
+
+bool D3D11QueryHeap::QueryResultUInt64(
+    ID3D11DeviceContext*    context,
+    std::uint32_t           firstQuery,
+    std::uint32_t           numQueries,
+    std::uint64_t*          data)
+{
+    for (std::uint32_t i = 0; i < numQueries; ++i)
+    {
+        if (!QueryResultSingleUInt64(context, firstQuery + i, data[i]))
+            return false;
+    }
+    return true;
+}
+
+// Static function (can be checked at compile time) to determine if
+// the structs <QueryPipelineStatistics> and <D3D11_QUERY_DATA_PIPELINE_STATISTICS> are compatible.
+static bool IsQueryPipelineStatsD3DCompatible()
+{
+    return
+    (
+        sizeof(QueryPipelineStatistics)                                    == sizeof(D3D11_QUERY_DATA_PIPELINE_STATISTICS)                  &&
+        offsetof(QueryPipelineStatistics, inputAssemblyVertices          ) == offsetof(D3D11_QUERY_DATA_PIPELINE_STATISTICS, IAVertices   ) &&
+        offsetof(QueryPipelineStatistics, inputAssemblyPrimitives        ) == offsetof(D3D11_QUERY_DATA_PIPELINE_STATISTICS, IAPrimitives ) &&
+        offsetof(QueryPipelineStatistics, vertexShaderInvocations        ) == offsetof(D3D11_QUERY_DATA_PIPELINE_STATISTICS, VSInvocations) &&
+        offsetof(QueryPipelineStatistics, geometryShaderInvocations      ) == offsetof(D3D11_QUERY_DATA_PIPELINE_STATISTICS, GSInvocations) &&
+        offsetof(QueryPipelineStatistics, geometryShaderPrimitives       ) == offsetof(D3D11_QUERY_DATA_PIPELINE_STATISTICS, GSPrimitives ) &&
+        offsetof(QueryPipelineStatistics, clippingInvocations            ) == offsetof(D3D11_QUERY_DATA_PIPELINE_STATISTICS, CInvocations ) &&
+        offsetof(QueryPipelineStatistics, clippingPrimitives             ) == offsetof(D3D11_QUERY_DATA_PIPELINE_STATISTICS, CPrimitives  ) &&
+        offsetof(QueryPipelineStatistics, fragmentShaderInvocations      ) == offsetof(D3D11_QUERY_DATA_PIPELINE_STATISTICS, PSInvocations) &&
+        offsetof(QueryPipelineStatistics, tessControlShaderInvocations   ) == offsetof(D3D11_QUERY_DATA_PIPELINE_STATISTICS, HSInvocations) &&
+        offsetof(QueryPipelineStatistics, tessEvaluationShaderInvocations) == offsetof(D3D11_QUERY_DATA_PIPELINE_STATISTICS, DSInvocations) &&
+        offsetof(QueryPipelineStatistics, computeShaderInvocations       ) == offsetof(D3D11_QUERY_DATA_PIPELINE_STATISTICS, CSInvocations)
+    );
+}
+
+bool D3D11QueryHeap::QueryResultPipelineStatistics(
+    ID3D11DeviceContext*        context,
+    std::uint32_t               firstQuery,
+    std::uint32_t               numQueries,
+    QueryPipelineStatistics*    data)
+{
+    /* Query result from data of type: D3D11_QUERY_DATA_PIPELINE_STATISTICS */
+    if (GetNativeType() == D3D11_QUERY_PIPELINE_STATISTICS)
+    {
+        for (std::uint32_t i = 0; i < numQueries; ++i)
+        {
+            if (IsQueryPipelineStatsD3DCompatible())
+            {
+                /* Use output storage directly when structure is compatible with D3D */
+                if (context->GetData(GetNative(firstQuery + i), &data[i], sizeof(QueryPipelineStatistics), 0) != S_OK)
+                    return false;
+            }
+            else
+            {
+                /* Copy temporary query data to output */
+                D3D11_QUERY_DATA_PIPELINE_STATISTICS tempData;
+                if (context->GetData(GetNative(firstQuery + i), &tempData, sizeof(tempData), 0) == S_OK)
+                {
+                    data[i].inputAssemblyVertices           = tempData.IAVertices;
+                    data[i].inputAssemblyPrimitives         = tempData.IAPrimitives;
+                    data[i].vertexShaderInvocations         = tempData.VSInvocations;
+                    data[i].geometryShaderInvocations       = tempData.GSInvocations;
+                    data[i].geometryShaderPrimitives        = tempData.GSPrimitives;
+                    data[i].clippingInvocations             = tempData.CInvocations;
+                    data[i].clippingPrimitives              = tempData.CPrimitives;
+                    data[i].fragmentShaderInvocations       = tempData.PSInvocations;
+                    data[i].tessControlShaderInvocations    = tempData.HSInvocations;
+                    data[i].tessEvaluationShaderInvocations = tempData.DSInvocations;
+                    data[i].computeShaderInvocations        = tempData.CSInvocations;
+                }
+                else
+                    return false;
+            }
+        }
+        return true;
+    }
+    return false;
+}
+
 
 } // /namespace LLGL
 
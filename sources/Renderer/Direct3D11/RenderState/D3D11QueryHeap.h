@@ -14,6 +14,7 @@
 #include <d3d11.h>
 #include <vector>
 #include <cstdint>
+#include <cstddef>
 
 
 namespace LLGL
@@ -77,8 +78,44 @@ class D3D11QueryHeap final : public QueryHeap
             return groupSize_;
         }
 
+        // Reads the results of the specified queries without waiting. Returns false if they are not available yet.
+        bool QueryResult(
+            ID3D11DeviceContext*    context,
+            std::uint32_t           firstQuery,
+            std::uint32_t           numQueries,
+            void*                   data,
+            std::size_t             dataSize
+        );
+
     private:
 
+        bool QueryResultSingleUInt64(
+            ID3D11DeviceContext*    context,
+            std::uint32_t           query,
+            std::uint64_t&          data
+        );
+
+        bool QueryResultUInt32(
+            ID3D11DeviceContext*    context,
+            std::uint32_t           firstQuery,
+            std::uint32_t           numQueries,
+            std::uint32_t*          data
+        );
+
+        bool QueryResultUInt64(
+            ID3D11DeviceContext*    context,
+            std::uint32_t           firstQuery,
+            std::uint32_t           numQueries,
+            std::uint64_t*          data
+        );
+
+        bool QueryResultPipelineStatistics(
+            ID3D11DeviceContext*        context,
+            std::uint32_t               firstQuery,
+            std::uint32_t               numQueries,
+            QueryPipelineStatistics*    data
+        );
+
         D3D11_QUERY                     nativeType_     = D3D11_QUERY_EVENT;
         std::uint32_t                   groupSize_      = 1;
         std::vector<D3D11NativeQuery>   nativeQueries_;
@@ -384,6 +384,13 @@ void D3D12CommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t query)
     queryHeapD3D.ResolveData(commandList_.Get(), query, 1);
 }
 
+void D3D12CommandBuffer::ResolveQueries(QueryHeap& queryHeap, std::uint32_t firstQuery, std::uint32_t numQueries, Buffer& dstBuffer, std::uint64_t dstOffset)
+{
+    auto& queryHeapD3D = LLGL_CAST(D3D12QueryHeap&, queryHeap);
+    auto& dstBufferD3D = LLGL_CAST(D3D12Buffer&, dstBuffer);
+    commandList_->ResolveQueryData(queryHeapD3D.GetNative(), queryHeapD3D.GetNativeType(), firstQuery, numQueries, dstBufferD3D.GetNative(), dstOffset);
+}
+
 static D3D12_PREDICATION_OP GetDXPredicateOp(const RenderConditionMode mode)
 {
     if (mode >= RenderConditionMode::WaitInverted)
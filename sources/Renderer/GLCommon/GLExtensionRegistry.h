@@ -43,6 +43,7 @@ enum class GLExt
     ARB_compute_shader,
     ARB_get_program_binary,
     ARB_program_interface_query,
+    ARB_separate_shader_objects,
     ARB_uniform_buffer_object,
     ARB_shader_storage_buffer_object,
     ARB_occlusion_query,
@@ -64,6 +65,7 @@ enum class GLExt
     ARB_texture_storage,
     ARB_texture_storage_multisample,
     ARB_buffer_storage,
+    ARB_map_buffer_range,
     ARB_copy_buffer,
     ARB_polygon_offset_clamp,
     ARB_texture_view,
@@ -73,6 +75,9 @@ enum class GLExt
     ARB_draw_indirect,
     ARB_multi_draw_indirect,
     ARB_direct_state_access,
+    ARB_parallel_shader_compile,
+    KHR_parallel_shader_compile,
+    ARB_vertex_attrib_binding,
 
     /* Extensions without procedures */
     ARB_texture_cube_map,
@@ -81,6 +86,7 @@ enum class GLExt
     ARB_geometry_shader4,
     NV_conservative_raster,
     INTEL_conservative_rasterization,
+    ARB_query_buffer_object,
 
     /* Enumeration entry counter */
     Count,
@@ -79,6 +79,28 @@ static bool IsSecondaryCubeFaceTarget(GLenum target)
 
 #endif // /GL_ARB_texture_storage
 
+#ifdef GL_ARB_clear_texture
+
+// Returns true if textures can be initialized with <glClearTexImage>, which requires immutable texture storage
+static bool IsClearTexImageSupported()
+{
+    return (HasExtension(GLExt::ARB_texture_storage) && HasExtension(GLExt::ARB_clear_texture));
+}
+
+#endif // /GL_ARB_clear_texture
+
+// Returns true if textures without initial data must be initialized with an image that is filled on the CPU
+static bool IsFillImageRequired()
+{
+    if (!g_imageInitialization.enabled)
+        return false;
+    #ifdef GL_ARB_clear_texture
+    if (IsClearTexImageSupported())
+        return false;
+    #endif
+    return true;
+}
+
 /* ----- Back-end OpenGL functions ----- */
 
 #ifdef LLGL_OPENGL
@@ -482,7 +504,7 @@ void GLTexImage1D(const TextureDescriptor& desc, const SrcImageDescriptor* image
         /* Throw runtime error for illegal use of depth-stencil format */
         ErrIllegalUseOfDepthFormat();
     }
-    else if (IsCompressedFormat(desc.format) || !g_imageInitialization.enabled)
+    else if (IsCompressedFormat(desc.format) || !IsFillImageRequired())
     {
         /* Allocate texture without initial data */
         GLTexImage1D(
@@ -529,7 +551,7 @@ void GLTexImage2D(const TextureDescriptor& desc, const SrcImageDescriptor* image
     }
     else if (IsDepthStencilFormat(desc.format))
     {
-        if (g_imageInitialization.enabled)
+        if (IsFillImageRequired())
         {
             //TODO: add support for default initialization of stencil values
             /* Initialize depth texture image with default depth */
@@ -558,7 +580,7 @@ void GLTexImage2D(const TextureDescriptor& desc, const SrcImageDescriptor* image
             );
         }
     }
-    else if (IsCompressedFormat(desc.format) || !g_imageInitialization.enabled)
+    else if (IsCompressedFormat(desc.format) || !IsFillImageRequired())
     {
         /* Allocate texture without initial data */
         GLTexImage2D(
@@ -609,7 +631,7 @@ void GLTexImage3D(const TextureDescriptor& desc, const SrcImageDescriptor* image
         /* Throw runtime error for illegal use of depth-stencil format */
         ErrIllegalUseOfDepthFormat();
     }
-    else if (IsCompressedFormat(desc.format) || !g_imageInitialization.enabled)
+    else if (IsCompressedFormat(desc.format) || !IsFillImageRequired())
     {
         /* Allocate texture without initial data */
         GLTexImage3D(
@@ -680,7 +702,7 @@ void GLTexImageCube(const TextureDescriptor& desc, const SrcImageDescriptor* ima
         std::vector<float> image;
         const void* initialData = nullptr;
 
-        if (g_imageInitialization.enabled)
+        if (IsFillImageRequired())
         {
             /* Initialize depth texture image with default depth */
             image       = GenImageDataRf(desc.extent.width * desc.extent.height, g_imageInitialization.clearValue.depth);
@@ -702,7 +724,7 @@ void GLTexImageCube(const TextureDescriptor& desc, const SrcImageDescriptor* ima
             );
         }
     }
-    else if (IsCompressedFormat(desc.format) || !g_imageInitialization.enabled)
+    else if (IsCompressedFormat(desc.format) || !IsFillImageRequired())
     {
         /* Allocate texture without initial data */
         for (std::uint32_t arrayLayer = 0; arrayLayer < desc.arrayLayers; ++arrayLayer)
@@ -762,7 +784,7 @@ void GLTexImage1DArray(const TextureDescriptor& desc, const SrcImageDescriptor*
         /* Throw runtime error for illegal use of depth-stencil format */
         ErrIllegalUseOfDepthFormat();
     }
-    else if (IsCompressedFormat(desc.format) || !g_imageInitialization.enabled)
+    else if (IsCompressedFormat(desc.format) || !IsFillImageRequired())
     {
         /* Allocate texture without initial data */
         GLTexImage1DArray(
@@ -812,7 +834,7 @@ void GLTexImage2DArray(const TextureDescriptor& desc, const SrcImageDescriptor*
     }
     else if (IsDepthStencilFormat(desc.format))
     {
-        if (g_imageInitialization.enabled)
+        if (IsFillImageRequired())
         {
             /* Initialize depth texture image with default depth */
             auto image = GenImageDataRf(desc.extent.width * desc.extent.height * desc.arrayLayers, g_imageInitialization.clearValue.depth);
@@ -842,7 +864,7 @@ void GLTexImage2DArray(const TextureDescriptor& desc, const SrcImageDescriptor*
             );
         }
     }
-    else if (IsCompressedFormat(desc.format) || !g_imageInitialization.enabled)
+    else if (IsCompressedFormat(desc.format) || !IsFillImageRequired())
     {
         /* Allocate texture without initial data */
         GLTexImage2DArray(
@@ -897,7 +919,7 @@ void GLTexImageCubeArray(const TextureDescriptor& desc, const SrcImageDescriptor
         /* Throw runtime error for illegal use of depth-stencil format */
         ErrIllegalUseOfDepthFormat();
     }
-    else if (IsCompressedFormat(desc.format) || !g_imageInitialization.enabled)
+    else if (IsCompressedFormat(desc.format) || !IsFillImageRequired())
     {
         /* Allocate texture without initial data */
         GLTexImageCubeArray(
@@ -953,6 +975,115 @@ void GLTexImage2DMSArray(const TextureDescriptor& desc)
     );
 }
 
+#ifdef GL_ARB_clear_texture
+
+// Initializes all MIP levels of the specified texture with the default clear value of the image initialization
+static void GLClearTexImage(GLuint texID, const TextureDescriptor& desc)
+{
+    const auto& clearValue = g_imageInitialization.clearValue;
+
+    GLenum      format  = GL_RGBA;
+    GLenum      type    = GL_FLOAT;
+    const void* data    = clearValue.color.Ptr();
+
+    GLint intColor[4];
+
+    struct DepthStencilValue
+    {
+        float           depth;
+        std::uint32_t   stencil;
+    }
+    depthStencil;
+
+    const auto internalFormat = FindSuitableDepthFormat(desc);
+
+    if (IsDepthStencilFormat(internalFormat))
+    {
+        if (IsStencilFormat(internalFormat))
+        {
+            /* Initialize depth and stencil values with a packed <GL_FLOAT_32_UNSIGNED_INT_24_8_REV> value, since <GL_DEPTH_COMPONENT> is invalid for depth-stencil textures */
+            depthStencil.depth      = clearValue.depth;
+            depthStencil.stencil    = (clearValue.stencil & 0xFF);
+            format                  = GL_DEPTH_STENCIL;
+            type                    = GL_FLOAT_32_UNSIGNED_INT_24_8_REV;
+            data                    = &depthStencil;
+        }
+        else
+        {
+            format                  = GL_DEPTH_COMPONENT;
+            data                    = &(clearValue.depth);
+        }
+    }
+    else if (IsDepthStencilFormat(desc.format))
+    {
+        /* Initialize depth texture that has been converted to a color renderable format with the default depth */
+        format  = GL_RED;
+        data    = &(clearValue.depth);
+    }
+    else if (IsIntegralFormat(internalFormat) && !IsNormalizedFormat(internalFormat))
+    {
+        /* Integer formats require integer source data */
+        for (int i = 0; i < 4; ++i)
+            intColor[i] = static_cast<GLint>(clearValue.color[i]);
+        format  = GL_RGBA_INTEGER;
+        type    = GL_INT;
+        data    = intColor;
+    }
+
+    for (std::uint32_t mipLevel = 0, numMipLevels = NumMipLevels(desc); mipLevel < numMipLevels; ++mipLevel)
+        glClearTexImage(texID, static_cast<GLint>(mipLevel), format, type, data);
+}
+
+#endif // /GL_ARB_clear_texture
+
+void GLTexImage(GLuint texID, const TextureDescriptor& desc, const SrcImageDescriptor* imageDesc)
+{
+    switch (desc.type)
+    {
+        case TextureType::Texture1D:
+            GLTexImage1D(desc, imageDesc);
+            break;
+        case TextureType::Texture2D:
+            GLTexImage2D(desc, imageDesc);
+            break;
+        case TextureType::Texture3D:
+            GLTexImage3D(desc, imageDesc);
+            break;
+        case TextureType::TextureCube:
+            GLTexImageCube(desc, imageDesc);
+            break;
+        case TextureType::Texture1DArray:
+            GLTexImage1DArray(desc, imageDesc);
+            break;
+        case TextureType::Texture2DArray:
+            GLTexImage2DArray(desc, imageDesc);
+            break;
+        case TextureType::TextureCubeArray:
+            GLTexImageCubeArray(desc, imageDesc);
+            break;
+        case TextureType::Texture2DMS:
+            GLTexImage2DMS(desc);
+            break;
+        case TextureType::Texture2DMSArray:
+            GLTexImage2DMSArray(desc);
+            break;
+        default:
+            throw std::invalid_argument("failed to create texture with invalid texture type");
+            break;
+    }
+
+    #ifdef GL_ARB_clear_texture
+
+    /* Initialize texture storage on the GPU, instead of uploading an image that has been filled on the CPU */
+    if (imageDesc == nullptr && g_imageInitialization.enabled && IsClearTexImageSupported())
+    {
+        if (!IsCompressedFormat(desc.format) && !IsMultiSampleTexture(desc.type))
+            GLClearTexImage(texID, desc);
+    }
+
+    #endif // /GL_ARB_clear_texture
+}
+
 #endif
 
 
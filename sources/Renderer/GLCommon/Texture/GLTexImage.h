@@ -12,6 +12,7 @@
 #include <LLGL/ImageFlags.h>
 #include <LLGL/TextureFlags.h>
 #include <LLGL/RenderSystemFlags.h>
+#include "../GLImport.h"
 
 
 namespace LLGL
@@ -32,6 +33,13 @@ void GLTexImageCubeArray(const TextureDescriptor& desc, const SrcImageDescriptor
 void GLTexImage2DMS     (const TextureDescriptor& desc);
 void GLTexImage2DMSArray(const TextureDescriptor& desc);
 
+/*
+Allocates the texture storage for the bound texture and initializes it with the specified image data (if non-null), depending on the texture type.
+Without image data, the texture is cleared with glClearTexImage if GL_ARB_texture_storage and GL_ARB_clear_texture are supported.
+The texture ID must be the name of the bound texture.
+*/
+void GLTexImage(GLuint texID, const TextureDescriptor& desc, const SrcImageDescriptor* imageDesc);
+
 #else
 
 void GLTexImage2D       (const TextureDescriptor& desc, const SrcImageDescriptor* imageDesc);
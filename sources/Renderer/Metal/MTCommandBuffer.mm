@@ -19,6 +19,7 @@
 #include "Shader/MTShaderProgram.h"
 #include "../CheckedCast.h"
 #include <algorithm>
+#include <stdexcept>
 #include <limits.h>
 
 
@@ -378,6 +379,11 @@ void MTCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t query)
     //todo
 }
 
+void MTCommandBuffer::ResolveQueries(QueryHeap& queryHeap, std::uint32_t firstQuery, std::uint32_t numQueries, Buffer& dstBuffer, std::uint64_t dstOffset)
+{
+    throw std::runtime_error("query heaps are not supported by the Metal renderer");
+}
+
 void MTCommandBuffer::BeginRenderCondition(QueryHeap& queryHeap, std::uint32_t query, const RenderConditionMode mode)
 {
     //todo
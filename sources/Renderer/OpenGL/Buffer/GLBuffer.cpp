@@ -6,6 +6,7 @@
  */
 
 #include "GLBuffer.h"
+#include "GLUploadRing.h"
 #include "../Ext/GLExtensions.h"
 #include "../../GLCommon/GLTypes.h"
 #include "../../GLCommon/GLExtensionRegistry.h"
@@ -87,6 +88,15 @@ void GLBuffer::BufferStorage(GLsizeiptr size, const void* data, GLbitfield flags
 
 void GLBuffer::BufferSubData(GLintptr offset, GLsizeiptr size, const void* data)
 {
+    GLStateManager::active->FlushBufferMemoryBarrier(GetID(), GLBarrierAccess::BufferUpdate);
+
+    /* Write small updates into the upload ring, so they don't stall on a buffer that is still in use by the GPU */
+    if (auto uploadRing = GLStateManager::active->GetUploadRing())
+    {
+        if (uploadRing->Write(*this, offset, size, data))
+            return;
+    }
+
     #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
     if (HasExtension(GLExt::ARB_direct_state_access))
     {
@@ -102,6 +112,8 @@ void GLBuffer::BufferSubData(GLintptr offset, GLsizeiptr size, const void* data)
 
 void GLBuffer::ClearBufferData(std::uint32_t data)
 {
+    GLStateManager::active->FlushBufferMemoryBarrier(GetID(), GLBarrierAccess::BufferUpdate);
+
     #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
     if (HasExtension(GLExt::ARB_direct_state_access))
     {
@@ -137,6 +149,8 @@ void GLBuffer::ClearBufferData(std::uint32_t data)
 
 void GLBuffer::ClearBufferSubData(GLintptr offset, GLsizeiptr size, std::uint32_t data)
 {
+    GLStateManager::active->FlushBufferMemoryBarrier(GetID(), GLBarrierAccess::BufferUpdate);
+
     #if 0 // TODO: does not work properly here with DSA version???
     #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
     if (HasExtension(GLExt::ARB_direct_state_access))
@@ -168,6 +182,9 @@ void GLBuffer::ClearBufferSubData(GLintptr offset, GLsizeiptr size, std::uint32_
 
 void GLBuffer::CopyBufferSubData(const GLBuffer& readBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
 {
+    GLStateManager::active->FlushBufferMemoryBarrier(readBuffer.GetID(), GLBarrierAccess::BufferUpdate);
+    GLStateManager::active->FlushBufferMemoryBarrier(GetID(), GLBarrierAccess::BufferUpdate);
+
     #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
     if (HasExtension(GLExt::ARB_direct_state_access))
     {
@@ -202,6 +219,8 @@ void GLBuffer::CopyBufferSubData(const GLBuffer& readBuffer, GLintptr readOffset
 
 void* GLBuffer::MapBuffer(GLenum access)
 {
+    GLStateManager::active->FlushBufferMemoryBarrier(GetID(), GLBarrierAccess::BufferUpdate);
+
     #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
     if (HasExtension(GLExt::ARB_direct_state_access))
     {
@@ -215,6 +234,23 @@ void* GLBuffer::MapBuffer(GLenum access)
     }
 }
 
+void* GLBuffer::MapBufferRange(GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+    GLStateManager::active->FlushBufferMemoryBarrier(GetID(), GLBarrierAccess::BufferUpdate);
+
+    #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
+    if (HasExtension(GLExt::ARB_direct_state_access))
+    {
+        return glMapNamedBufferRange(GetID(), offset, length, access);
+    }
+    else
+    #endif // /GL_ARB_direct_state_access
+    {
+        GLStateManager::active->BindGLBuffer(*this);
+        return glMapBufferRange(GetGLTarget(), offset, length, access);
+    }
+}
+
 void GLBuffer::UnmapBuffer()
 {
     #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
@@ -230,6 +266,21 @@ void GLBuffer::UnmapBuffer()
     }
 }
 
+void GLBuffer::FlushMappedBufferRange(GLintptr offset, GLsizeiptr length)
+{
+    #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
+    if (HasExtension(GLExt::ARB_direct_state_access))
+    {
+        glFlushMappedNamedBufferRange(GetID(), offset, length);
+    }
+    else
+    #endif // /GL_ARB_direct_state_access
+    {
+        GLStateManager::active->BindGLBuffer(*this);
+        glFlushMappedBufferRange(GetGLTarget(), offset, length);
+    }
+}
+
 void GLBuffer::SetIndexType(const Format format)
 {
     indexType16Bits_ = (format == Format::R16UInt);
@@ -37,7 +37,9 @@ class GLBuffer : public Buffer
         void CopyBufferSubData(const GLBuffer& readBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size);
 
         void* MapBuffer(GLenum access);
+        void* MapBufferRange(GLintptr offset, GLsizeiptr length, GLbitfield access);
         void UnmapBuffer();
+        void FlushMappedBufferRange(GLintptr offset, GLsizeiptr length);
 
         // Returns the hardware buffer ID.
         inline GLuint GetID() const
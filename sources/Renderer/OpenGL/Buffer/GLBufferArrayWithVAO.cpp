@@ -33,6 +33,10 @@ void GLBufferArrayWithVAO::BuildVertexArray(std::uint32_t numBuffers, Buffer* co
                 {
                     const auto& vertexFormat = vertexBufferGL->GetVertexFormat();
 
+                    /* Store vertex buffer binding (required for separate vertex formats) */
+                    offsetArray_.push_back(0);
+                    strideArray_.push_back(static_cast<GLsizei>(vertexFormat.stride));
+
                     /* Bind VBO */
                     GLStateManager::active->BindBuffer(GLBufferTarget::ARRAY_BUFFER, vertexBufferGL->GetID());
 
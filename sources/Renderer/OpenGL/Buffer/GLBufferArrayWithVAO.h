@@ -11,6 +11,7 @@
 
 #include "GLBufferArray.h"
 #include "GLVertexArrayObject.h"
+#include <vector>
 
 
 namespace LLGL
@@ -32,9 +33,23 @@ class GLBufferArrayWithVAO final : public GLBufferArray
             return vao_.GetID();
         }
 
+        // Returns the vertex buffer offsets for glBindVertexBuffers (one for each buffer ID).
+        inline const std::vector<GLintptr>& GetOffsetArray() const
+        {
+            return offsetArray_;
+        }
+
+        // Returns the vertex buffer strides for glBindVertexBuffers (one for each buffer ID).
+        inline const std::vector<GLsizei>& GetStrideArray() const
+        {
+            return strideArray_;
+        }
+
     private:
 
-        GLVertexArrayObject vao_;
+        GLVertexArrayObject     vao_;
+        std::vector<GLintptr>   offsetArray_;
+        std::vector<GLsizei>    strideArray_;
 
 };
 
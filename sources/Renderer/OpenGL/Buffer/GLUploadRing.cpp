@@ -0,0 +1,99 @@
+/*
+ * GLUploadRing.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLUploadRing.h"
+#include "../Ext/GLExtensions.h"
+#include "../../GLCommon/GLExtensionRegistry.h"
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+// Alignment (in bytes) of each update within the ring.
+static const GLsizeiptr g_uploadAlignment = 16;
+
+GLUploadRing::GLUploadRing(GLsizeiptr segmentSize) :
+    buffer_      { 0           },
+    segmentSize_ { segmentSize }
+{
+    #ifdef GL_ARB_buffer_storage
+
+    /* Allocate immutable storage that stays mapped for the lifetime of the ring */
+    const GLbitfield flags = (GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+    const GLsizeiptr size  = segmentSize_ * g_numSegments;
+
+    buffer_.BufferStorage(size, nullptr, flags, GL_STREAM_DRAW);
+    mappedData_ = reinterpret_cast<std::int8_t*>(buffer_.MapBufferRange(0, size, flags));
+
+    #endif // /GL_ARB_buffer_storage
+
+    for (auto& pending : fencesPending_)
+        pending = false;
+}
+
+GLUploadRing::~GLUploadRing()
+{
+    if (mappedData_ != nullptr)
+        buffer_.UnmapBuffer();
+}
+
+bool GLUploadRing::IsSupported()
+{
+    return
+    (
+        HasExtension(GLExt::ARB_buffer_storage)     &&
+        HasExtension(GLExt::ARB_map_buffer_range)   &&
+        HasExtension(GLExt::ARB_copy_buffer)        &&
+        HasExtension(GLExt::ARB_sync)
+    );
+}
+
+bool GLUploadRing::Write(GLBuffer& dstBuffer, GLintptr dstOffset, GLsizeiptr size, const void* data)
+{
+    if (mappedData_ == nullptr || size > g_maxUploadSize || offset_ + size > segmentSize_)
+        return false;
+
+    /* Write data into current segment */
+    const auto srcOffset = static_cast<GLintptr>(segmentSize_ * segment_ + offset_);
+    ::memcpy(mappedData_ + srcOffset, data, static_cast<std::size_t>(size));
+
+    /* Copy data from ring into destination buffer (the mapping is coherent, so no flush is required) */
+    dstBuffer.CopyBufferSubData(buffer_, srcOffset, dstOffset, size);
+
+    offset_ += (size + g_uploadAlignment - 1) / g_uploadAlignment * g_uploadAlignment;
+
+    return true;
+}
+
+void GLUploadRing::NextFrame()
+{
+    /* Fence current segment if it has been written to */
+    if (offset_ > 0)
+    {
+        fences_[segment_].Submit();
+        fencesPending_[segment_] = true;
+    }
+
+    /* Continue with next segment and wait until the GPU has finished reading from it */
+    segment_    = (segment_ + 1) % g_numSegments;
+    offset_     = 0;
+
+    if (fencesPending_[segment_])
+    {
+        fences_[segment_].Wait(~0ull);
+        fencesPending_[segment_] = false;
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,80 @@
+/*
+ * GLUploadRing.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_UPLOAD_RING_H
+#define LLGL_GL_UPLOAD_RING_H
+
+
+#include "GLBuffer.h"
+#include "../RenderState/GLFence.h"
+#include "../OpenGL.h"
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/*
+Ring of persistently mapped staging memory for small buffer updates.
+The ring is divided into one segment per frame in flight. Each update is written into the segment of the current frame
+and copied into the destination buffer with glCopyBufferSubData, so the CPU never waits for a destination buffer that is still in use by the GPU.
+A segment is only reused after the fence that was submitted at the end of its frame has been signaled.
+*/
+class GLUploadRing
+{
+
+    public:
+
+        // Number of frames the ring can have in flight.
+        static const std::uint32_t  g_numSegments       = 3;
+
+        // Maximal size (in bytes) of a single update. Larger updates are passed to glBufferSubData directly.
+        static const GLsizeiptr     g_maxUploadSize     = (64 << 10);
+
+        GLUploadRing(const GLUploadRing&) = delete;
+        GLUploadRing& operator = (const GLUploadRing&) = delete;
+
+        // Allocates and maps the ring buffer with the specified size (in bytes) for each segment.
+        GLUploadRing(GLsizeiptr segmentSize);
+        ~GLUploadRing();
+
+        // Returns true if all extensions that are required for the upload ring are supported.
+        static bool IsSupported();
+
+        /*
+        Writes the specified data into the current segment and copies it into the destination buffer.
+        Returns false if the data is too large or the current segment is full, in which case the caller must update the buffer directly.
+        */
+        bool Write(GLBuffer& dstBuffer, GLintptr dstOffset, GLsizeiptr size, const void* data);
+
+        // Submits the fence for the current segment and continues with the next segment. Blocks until the GPU has finished reading from that segment.
+        void NextFrame();
+
+    private:
+
+        GLBuffer        buffer_;
+        std::int8_t*    mappedData_                 = nullptr;
+        GLsizeiptr      segmentSize_                = 0;
+
+        std::uint32_t   segment_                    = 0;
+        GLsizeiptr      offset_                     = 0;
+
+        GLFence         fences_[g_numSegments];
+        bool            fencesPending_[g_numSegments];
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
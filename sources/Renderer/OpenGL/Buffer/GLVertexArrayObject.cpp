@@ -78,6 +78,47 @@ void GLVertexArrayObject::BuildVertexAttribute(const VertexAttribute& attribute,
     }
 }
 
+void GLVertexArrayObject::BuildVertexFormat(const VertexAttribute& attribute, std::uint32_t index, std::uint32_t bindingIndex)
+{
+    #ifdef GL_ARB_vertex_attrib_binding
+
+    /* Enable array index in currently bound VAO */
+    glEnableVertexAttribArray(index);
+
+    /* Get data type and components of vector type */
+    DataType        dataType    = DataType::Float32;
+    std::uint32_t   components  = 0;
+    SplitFormat(attribute.format, dataType, components);
+
+    auto isNormalizedFormat = IsNormalizedFormat(attribute.format);
+    auto isFloatFormat      = IsFloatFormat(attribute.format);
+
+    /* Specify format with offset relative to the vertex buffer binding (the stride is specified with the vertex buffer) */
+    if (!isNormalizedFormat && !isFloatFormat)
+        glVertexAttribIFormat(index, components, GLTypes::Map(dataType), attribute.offset);
+    else
+        glVertexAttribFormat(index, components, GLTypes::Map(dataType), GLBoolean(isNormalizedFormat), attribute.offset);
+
+    /* Associate attribute with vertex buffer binding point; the instance divisor is a state of the binding point (see GLShaderProgram::BuildVertexFormatVAO) */
+    glVertexAttribBinding(index, bindingIndex);
+    glVertexBindingDivisor(bindingIndex, attribute.instanceDivisor);
+
+    #else
+
+    ThrowNotSupportedExcept(__FUNCTION__, "GL_ARB_vertex_attrib_binding");
+
+    #endif // /GL_ARB_vertex_attrib_binding
+}
+
+bool GLVertexArrayObject::IsVertexAttribBindingSupported()
+{
+    #ifdef GL_ARB_vertex_attrib_binding
+    return HasExtension(GLExt::ARB_vertex_attrib_binding);
+    #else
+    return false;
+    #endif
+}
+
 
 } // /namespace LLGL
 
@@ -27,6 +27,16 @@ class GLVertexArrayObject
 
         void BuildVertexAttribute(const VertexAttribute& attribute, std::uint32_t stride, std::uint32_t index);
 
+        /*
+        Specifies the format of the vertex attribute at the specified index and associates it with the specified vertex buffer binding point.
+        The vertex buffer itself is bound separately with glBindVertexBuffer(s) (see GL_ARB_vertex_attrib_binding).
+        The instance divisor is specified for the binding point, so all attributes of one binding point must have the same divisor.
+        */
+        void BuildVertexFormat(const VertexAttribute& attribute, std::uint32_t index, std::uint32_t bindingIndex);
+
+        // Returns true if vertex formats can be specified separately from vertex buffers, i.e. GL_ARB_vertex_attrib_binding is supported.
+        static bool IsVertexAttribBindingSupported();
+
         //! Returns the ID of the hardware vertex-array-object (VAO)
         inline GLuint GetID() const
         {
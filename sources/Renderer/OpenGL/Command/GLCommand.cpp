@@ -0,0 +1,158 @@
+/*
+ * GLCommand.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLCommand.h"
+
+
+namespace LLGL
+{
+
+
+std::size_t GetGLCommandSize(const GLOpcode opcode, const void* pc)
+{
+    switch (opcode)
+    {
+        case GLOpcodeUpdateBuffer:
+        {
+            auto cmd = reinterpret_cast<const GLCmdUpdateBuffer*>(pc);
+            return (sizeof(*cmd) + cmd->size);
+        }
+        case GLOpcodeCopyBuffer:
+            return sizeof(GLCmdCopyBuffer);
+        case GLOpcodeSetAPIDepState:
+            return sizeof(GLCmdSetAPIDepState);
+        case GLOpcodeExecute:
+            return sizeof(GLCmdExecute);
+        case GLOpcodeViewport:
+            return sizeof(GLCmdViewport);
+        case GLOpcodeViewportArray:
+        {
+            auto cmd = reinterpret_cast<const GLCmdViewportArray*>(pc);
+            return (sizeof(*cmd) + (sizeof(GLViewport) + sizeof(GLDepthRange))*cmd->count);
+        }
+        case GLOpcodeScissor:
+            return sizeof(GLCmdScissor);
+        case GLOpcodeScissorArray:
+        {
+            auto cmd = reinterpret_cast<const GLCmdScissorArray*>(pc);
+            return (sizeof(*cmd) + sizeof(GLScissor)*cmd->count);
+        }
+        case GLOpcodeClearColor:
+            return sizeof(GLCmdClearColor);
+        case GLOpcodeClearDepth:
+            return sizeof(GLCmdClearDepth);
+        case GLOpcodeClearStencil:
+            return sizeof(GLCmdClearStencil);
+        case GLOpcodeClear:
+            return sizeof(GLCmdClear);
+        case GLOpcodeClearBuffers:
+        {
+            auto cmd = reinterpret_cast<const GLCmdClearBuffers*>(pc);
+            return (sizeof(*cmd) + sizeof(AttachmentClear)*cmd->numAttachments);
+        }
+        case GLOpcodeBindVertexArray:
+            return sizeof(GLCmdBindVertexArray);
+        case GLOpcodeBindVertexBuffers:
+        {
+            auto cmd = reinterpret_cast<const GLCmdBindVertexBuffers*>(pc);
+            return (sizeof(*cmd) + (sizeof(GLintptr) + sizeof(GLuint) + sizeof(GLsizei))*cmd->count);
+        }
+        case GLOpcodeBindElementArrayBufferToVAO:
+            return sizeof(GLCmdBindElementArrayBufferToVAO);
+        case GLOpcodeBindBufferBase:
+            return sizeof(GLCmdBindBufferBase);
+        case GLOpcodeBindBuffersBase:
+        {
+            auto cmd = reinterpret_cast<const GLCmdBindBuffersBase*>(pc);
+            return (sizeof(*cmd) + sizeof(GLuint)*cmd->count);
+        }
+        case GLOpcodeBeginTransformFeedback:
+            return sizeof(GLCmdBeginTransformFeedback);
+        case GLOpcodeBeginTransformFeedbackNV:
+            return sizeof(GLCmdBeginTransformFeedbackNV);
+        case GLOpcodeEndTransformFeedback:
+        case GLOpcodeEndTransformFeedbackNV:
+            return 0;
+        case GLOpcodeBindResourceHeap:
+            return sizeof(GLCmdBindResourceHeap);
+        case GLOpcodeBindRenderPass:
+        {
+            auto cmd = reinterpret_cast<const GLCmdBindRenderPass*>(pc);
+            return (sizeof(*cmd) + sizeof(ClearValue)*cmd->numClearValues);
+        }
+        case GLOpcodeBindGraphicsPipeline:
+            return sizeof(GLCmdBindGraphicsPipeline);
+        case GLOpcodeBindComputePipeline:
+            return sizeof(GLCmdBindComputePipeline);
+        case GLOpcodeBeginQuery:
+            return sizeof(GLCmdBeginQuery);
+        case GLOpcodeEndQuery:
+            return sizeof(GLCmdEndQuery);
+        case GLOpcodeResolveQueries:
+            return sizeof(GLCmdResolveQueries);
+        case GLOpcodeBeginConditionalRender:
+            return sizeof(GLCmdBeginConditionalRender);
+        case GLOpcodeEndConditionalRender:
+            return 0;
+        case GLOpcodeDrawArrays:
+            return sizeof(GLCmdDrawArrays);
+        case GLOpcodeDrawArraysInstanced:
+            return sizeof(GLCmdDrawArraysInstanced);
+        case GLOpcodeDrawArraysInstancedBaseInstance:
+            return sizeof(GLCmdDrawArraysInstancedBaseInstance);
+        case GLOpcodeDrawArraysIndirect:
+            return sizeof(GLCmdDrawArraysIndirect);
+        case GLOpcodeDrawElements:
+            return sizeof(GLCmdDrawElements);
+        case GLOpcodeDrawElementsBaseVertex:
+            return sizeof(GLCmdDrawElementsBaseVertex);
+        case GLOpcodeDrawElementsInstanced:
+            return sizeof(GLCmdDrawElementsInstanced);
+        case GLOpcodeDrawElementsInstancedBaseVertex:
+            return sizeof(GLCmdDrawElementsInstancedBaseVertex);
+        case GLOpcodeDrawElementsInstancedBaseVertexBaseInstance:
+            return sizeof(GLCmdDrawElementsInstancedBaseVertexBaseInstance);
+        case GLOpcodeDrawElementsIndirect:
+            return sizeof(GLCmdDrawElementsIndirect);
+        case GLOpcodeMultiDrawArraysIndirect:
+            return sizeof(GLCmdMultiDrawArraysIndirect);
+        case GLOpcodeMultiDrawElementsIndirect:
+            return sizeof(GLCmdMultiDrawElementsIndirect);
+        case GLOpcodeDispatchCompute:
+            return sizeof(GLCmdDispatchCompute);
+        case GLOpcodeDispatchComputeIndirect:
+            return sizeof(GLCmdDispatchComputeIndirect);
+        case GLOpcodeBindTexture:
+            return sizeof(GLCmdBindTexture);
+        case GLOpcodeBindSampler:
+            return sizeof(GLCmdBindSampler);
+        case GLOpcodeUnbindResources:
+            return sizeof(GLCmdUnbindResources);
+        case GLOpcodeFlushResourceBindings:
+            return 0;
+        case GLOpcodeSetStorageBufferWriteMask:
+            return sizeof(GLCmdSetStorageBufferWriteMask);
+        case GLOpcodeFlushMemoryBarriers:
+            return sizeof(GLCmdFlushMemoryBarriers);
+        case GLOpcodeMultiDrawElementsBatch:
+        {
+            auto cmd = reinterpret_cast<const GLCmdMultiDrawElementsBatch*>(pc);
+            return (sizeof(*cmd) + sizeof(GLDrawElementsIndirectCommand)*cmd->drawcount);
+        }
+        case GLOpcodeInvoke:
+            return sizeof(GLCmdInvoke);
+        default:
+            return 0;
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
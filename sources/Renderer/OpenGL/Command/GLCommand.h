@@ -11,8 +11,10 @@
 
 #include <LLGL/CommandBufferFlags.h>
 #include "../RenderState/GLState.h"
+#include "GLCommandOpcode.h"
 #include "../OpenGL.h"
 #include <cstdint>
+#include <cstddef>
 
 
 namespace LLGL
@@ -116,6 +118,15 @@ struct GLCmdBindVertexArray
     GLuint vao;
 };
 
+struct GLCmdBindVertexBuffers
+{
+    GLuint      vao;
+    GLsizei     count;
+//  GLintptr    offsets[count];
+//  GLuint      buffers[count];
+//  GLsizei     strides[count];
+};
+
 struct GLCmdBindElementArrayBufferToVAO
 {
     GLuint id;
@@ -186,6 +197,15 @@ struct GLCmdEndQuery
     std::uint32_t   query;
 };
 
+struct GLCmdResolveQueries
+{
+    GLQueryHeap*    queryHeap;
+    std::uint32_t   firstQuery;
+    std::uint32_t   numQueries;
+    GLuint          buffer;
+    GLintptr        offset;
+};
+
 struct GLCmdBeginConditionalRender
 {
     GLuint id;
@@ -303,6 +323,30 @@ struct GLCmdMultiDrawElementsIndirect
     GLsizei         stride;
 };
 
+// Indirect argument structure of an indexed draw command (memory layout is specified by glMultiDrawElementsIndirect).
+struct GLDrawElementsIndirectCommand
+{
+    GLuint          count;
+    GLuint          instanceCount;
+    GLuint          firstIndex;
+    GLint           baseVertex;
+    GLuint          baseInstance;
+};
+
+struct GLCmdMultiDrawElementsBatch
+{
+    GLenum          mode;
+    GLenum          type;
+    GLsizei         drawcount;
+    // GLDrawElementsIndirectCommand commands[drawcount];
+};
+
+struct GLCmdInvoke
+{
+    void            (*func)(void* userData);
+    void*           userData;
+};
+
 struct GLCmdDispatchCompute
 {
     GLuint numgroups[3];
@@ -326,6 +370,18 @@ struct GLCmdBindSampler
     GLuint          sampler;
 };
 
+struct GLCmdSetStorageBufferWriteMask
+{
+    std::uint64_t   slotMask;
+    std::uint64_t   writeMask;
+};
+
+struct GLCmdFlushMemoryBarriers
+{
+    bool            drawCommand;
+    GLuint          indirectBuffer;
+};
+
 struct GLCmdUnbindResources
 {
     GLuint              first;
@@ -346,6 +402,10 @@ struct GLCmdUnbindResources
 };
 
 
+// Returns the size of the specified command including its trailing data (excluding the opcode itself).
+std::size_t GetGLCommandSize(const GLOpcode opcode, const void* pc);
+
+
 } // /namespace LLGL
 
 
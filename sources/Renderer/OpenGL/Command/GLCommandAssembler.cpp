@@ -10,6 +10,7 @@
 #include "GLCommandAssembler.h"
 #include "GLCommandExecutor.h"
 #include "GLCommand.h"
+#include "GLDrawBatch.h"
 #include "GLDeferredCommandBuffer.h"
 #include "../../../JIT/JITCompiler.h"
 
@@ -147,7 +148,7 @@ static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, JITC
         {
             auto cmd = reinterpret_cast<const GLCmdClearBuffers*>(pc);
             compiler.CallMember(&GLStateManager::ClearBuffers, g_stateMngrArg, cmd->numAttachments, (cmd + 1));
-            return sizeof(*cmd);
+            return (sizeof(*cmd) + sizeof(AttachmentClear)*cmd->numAttachments);
         }
         case GLOpcodeBindVertexArray:
         {
@@ -155,6 +156,15 @@ static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, JITC
             compiler.CallMember(&GLStateManager::BindVertexArray, g_stateMngrArg, cmd->vao);
             return sizeof(*cmd);
         }
+        case GLOpcodeBindVertexBuffers:
+        {
+            auto cmd        = reinterpret_cast<const GLCmdBindVertexBuffers*>(pc);
+            auto offsets    = reinterpret_cast<const GLintptr*>(cmd + 1);
+            auto buffers    = reinterpret_cast<const GLuint*>(offsets + cmd->count);
+            auto strides    = reinterpret_cast<const GLsizei*>(buffers + cmd->count);
+            compiler.CallMember(&GLStateManager::BindVertexBuffers, g_stateMngrArg, cmd->vao, cmd->count, buffers, offsets, strides);
+            return (sizeof(*cmd) + (sizeof(GLintptr) + sizeof(GLuint) + sizeof(GLsizei))*cmd->count);
+        }
         case GLOpcodeBindElementArrayBufferToVAO:
         {
             auto cmd = reinterpret_cast<const GLCmdBindElementArrayBufferToVAO*>(pc);
@@ -235,6 +245,12 @@ static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, JITC
             compiler.CallMember(&GLQueryHeap::End, cmd->queryHeap, cmd->query);
             return sizeof(*cmd);
         }
+        case GLOpcodeResolveQueries:
+        {
+            auto cmd = reinterpret_cast<const GLCmdResolveQueries*>(pc);
+            compiler.CallMember(&GLQueryHeap::Resolve, cmd->queryHeap, g_stateMngrArg, cmd->firstQuery, cmd->numQueries, cmd->buffer, cmd->offset);
+            return sizeof(*cmd);
+        }
         case GLOpcodeBeginConditionalRender:
         {
             auto cmd = reinterpret_cast<const GLCmdBeginConditionalRender*>(pc);
@@ -360,8 +376,10 @@ static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, JITC
         case GLOpcodeBindTexture:
         {
             auto cmd = reinterpret_cast<const GLCmdBindTexture*>(pc);
-            compiler.CallMember(&GLStateManager::ActiveTexture, g_stateMngrArg, cmd->slot);
-            compiler.CallMember(&GLStateManager::BindGLTexture, g_stateMngrArg, cmd->texture);
+            compiler.CallMember(
+                &GLStateManager::BindTextureSlot, g_stateMngrArg,
+                static_cast<GLuint>(cmd->slot), GLStateManager::GetTextureTarget(cmd->texture->GetType()), cmd->texture->GetID()
+            );
             return sizeof(*cmd);
         }
         case GLOpcodeBindSampler:
@@ -389,6 +407,35 @@ static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, JITC
                 compiler.CallMember(&GLStateManager::UnbindSamplers, g_stateMngrArg, cmd->first, cmd->count);
             return sizeof(*cmd);
         }
+        case GLOpcodeFlushResourceBindings:
+        {
+            compiler.CallMember(&GLStateManager::FlushResourceBindings, g_stateMngrArg);
+            return 0;
+        }
+        case GLOpcodeSetStorageBufferWriteMask:
+        {
+            auto cmd = reinterpret_cast<const GLCmdSetStorageBufferWriteMask*>(pc);
+            compiler.CallMember(&GLStateManager::SetStorageBufferWriteMask, g_stateMngrArg, cmd->slotMask, cmd->writeMask);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeFlushMemoryBarriers:
+        {
+            auto cmd = reinterpret_cast<const GLCmdFlushMemoryBarriers*>(pc);
+            compiler.CallMember(&GLStateManager::FlushMemoryBarriers, g_stateMngrArg, cmd->drawCommand, cmd->indirectBuffer);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeMultiDrawElementsBatch:
+        {
+            auto cmd = reinterpret_cast<const GLCmdMultiDrawElementsBatch*>(pc);
+            compiler.Call(GLMultiDrawElementsBatch, g_stateMngrArg, cmd->mode, cmd->type, cmd->drawcount, (cmd + 1));
+            return (sizeof(*cmd) + sizeof(GLDrawElementsIndirectCommand)*cmd->drawcount);
+        }
+        case GLOpcodeInvoke:
+        {
+            auto cmd = reinterpret_cast<const GLCmdInvoke*>(pc);
+            compiler.Call(cmd->func, cmd->userData);
+            return sizeof(*cmd);
+        }
         default:
             return 0;
     }
@@ -411,12 +458,6 @@ std::unique_ptr<JITProgram> AssembleGLDeferredCommandBuffer(const GLDeferredComm
     /* Try to create a JIT-compiler for the active architecture (if supported) */
     if (auto compiler = JITCompiler::Create())
     {
-        /* Initialize program counter to execute virtual GL commands */
-        const auto& rawBuffer = cmdBuffer.GetRawBuffer();
-        
-        auto pc     = rawBuffer.data();
-        auto pcEnd  = rawBuffer.data() + rawBuffer.size();
-
         GLOpcode opcode;
         
         /* Declare variadic arguments for entry point of JIT program */
@@ -430,14 +471,21 @@ std::unique_ptr<JITProgram> AssembleGLDeferredCommandBuffer(const GLDeferredComm
         /* Assemble GL commands into JIT program */
         compiler->Begin();
         
-        while (pc < pcEnd)
+        for (auto chunk = cmdBuffer.GetFirstChunk(); chunk != nullptr; chunk = chunk->next)
         {
-            /* Read opcode */
-            opcode = *reinterpret_cast<const GLOpcode*>(pc);
-            pc += sizeof(GLOpcode);
+            /* Initialize program counter to assemble virtual GL commands of the current chunk */
+            auto pc     = chunk->Data();
+            auto pcEnd  = chunk->Data() + chunk->size;
 
-            /* Execute command and increment program counter */
-            pc += AssembleGLCommand(opcode, pc, *compiler);
+            while (pc < pcEnd)
+            {
+                /* Read opcode */
+                opcode = *reinterpret_cast<const GLOpcode*>(pc);
+                pc += sizeof(GLOpcode);
+
+                /* Assemble command and increment program counter */
+                pc += AssembleGLCommand(opcode, pc, *compiler);
+            }
         }
         
         compiler->End();
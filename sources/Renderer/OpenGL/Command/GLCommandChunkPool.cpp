@@ -0,0 +1,94 @@
+/*
+ * GLCommandChunkPool.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLCommandChunkPool.h"
+#include <new>
+#include <stdlib.h>
+
+
+namespace LLGL
+{
+
+
+static GLCommandChunk* MakeChunk(std::size_t capacity)
+{
+    auto chunk = reinterpret_cast<GLCommandChunk*>(::malloc(sizeof(GLCommandChunk) + capacity));
+    if (chunk == nullptr)
+        throw std::bad_alloc();
+    chunk->next     = nullptr;
+    chunk->size     = 0;
+    chunk->capacity = capacity;
+    return chunk;
+}
+
+GLCommandChunkPool::~GLCommandChunkPool()
+{
+    while (freeList_ != nullptr)
+    {
+        auto next = freeList_->next;
+        ::free(freeList_);
+        freeList_ = next;
+    }
+}
+
+GLCommandChunkPool& GLCommandChunkPool::Instance()
+{
+    static GLCommandChunkPool instance;
+    return instance;
+}
+
+GLCommandChunk* GLCommandChunkPool::AllocChunk(std::size_t minCapacity)
+{
+    /* Allocate dedicated chunk for oversized commands */
+    if (minCapacity > g_chunkCapacity)
+        return MakeChunk(minCapacity);
+
+    /* Take chunk from free list */
+    {
+        std::lock_guard<std::mutex> guard { mutex_ };
+        if (auto chunk = freeList_)
+        {
+            freeList_       = chunk->next;
+            chunk->next     = nullptr;
+            chunk->size     = 0;
+            return chunk;
+        }
+    }
+
+    /* Allocate new chunk with default capacity */
+    return MakeChunk(g_chunkCapacity);
+}
+
+void GLCommandChunkPool::FreeChunks(GLCommandChunk* firstChunk)
+{
+    while (firstChunk != nullptr)
+    {
+        auto next = firstChunk->next;
+
+        if (firstChunk->capacity == g_chunkCapacity)
+        {
+            /* Return chunk to free list */
+            std::lock_guard<std::mutex> guard { mutex_ };
+            firstChunk->next = freeList_;
+            freeList_ = firstChunk;
+        }
+        else
+        {
+            /* Release oversized chunk */
+            ::free(firstChunk);
+        }
+
+        firstChunk = next;
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
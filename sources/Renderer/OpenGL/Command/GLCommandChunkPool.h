@@ -0,0 +1,89 @@
+/*
+ * GLCommandChunkPool.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_COMMAND_CHUNK_POOL_H
+#define LLGL_GL_COMMAND_CHUNK_POOL_H
+
+
+#include <cstdint>
+#include <cstddef>
+#include <mutex>
+
+
+namespace LLGL
+{
+
+
+// Header of a single chunk of encoded GL commands. The command data follows immediately after this header.
+struct GLCommandChunk
+{
+    GLCommandChunk* next;       // Next chunk in the linked list, or null if this is the last chunk.
+    std::size_t     size;       // Number of bytes that are currently in use.
+    std::size_t     capacity;   // Number of bytes that can be stored in this chunk.
+
+    // Returns a pointer to the command data of this chunk.
+    inline std::uint8_t* Data()
+    {
+        return reinterpret_cast<std::uint8_t*>(this + 1);
+    }
+
+    // Returns a constant pointer to the command data of this chunk.
+    inline const std::uint8_t* Data() const
+    {
+        return reinterpret_cast<const std::uint8_t*>(this + 1);
+    }
+};
+
+/*
+Singleton pool for fixed-size chunks of encoded GL commands.
+Chunks are recycled across all deferred command buffers, so recording commands never copies previously recorded data.
+*/
+class GLCommandChunkPool
+{
+
+    public:
+
+        // Default capacity (in bytes) of each chunk that is recycled by this pool.
+        static const std::size_t g_chunkCapacity = 4096 - sizeof(GLCommandChunk);
+
+        GLCommandChunkPool(const GLCommandChunkPool&) = delete;
+        GLCommandChunkPool& operator = (const GLCommandChunkPool&) = delete;
+
+        ~GLCommandChunkPool();
+
+        // Returns the instance of this pool.
+        static GLCommandChunkPool& Instance();
+
+        /*
+        Allocates a new empty chunk with a capacity of at least the specified size.
+        If the size is less than or equal to 'g_chunkCapacity', a chunk from the free list is reused if available.
+        */
+        GLCommandChunk* AllocChunk(std::size_t minCapacity);
+
+        // Returns the entire linked list of chunks back to this pool.
+        void FreeChunks(GLCommandChunk* firstChunk);
+
+    private:
+
+        GLCommandChunkPool() = default;
+
+    private:
+
+        std::mutex      mutex_;
+        GLCommandChunk* freeList_   = nullptr;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
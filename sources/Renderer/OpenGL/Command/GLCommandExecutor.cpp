@@ -7,6 +7,7 @@
 
 #include "GLCommandExecutor.h"
 #include "GLCommand.h"
+#include "GLDrawBatch.h"
 #include "GLDeferredCommandBuffer.h"
 
 #include "../GLRenderContext.h"
@@ -46,375 +47,591 @@ namespace LLGL
 {
 
 
-static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLStateManager& stateMngr)
+/*
+ * GL command handlers
+ */
+
+static std::size_t ExecuteGLCmdUpdateBuffer(const void* pc, GLStateManager& /*stateMngr*/)
 {
-    switch (opcode)
+    auto cmd = reinterpret_cast<const GLCmdUpdateBuffer*>(pc);
+    cmd->buffer->BufferSubData(cmd->offset, cmd->size, cmd + 1);
+    return sizeof(*cmd) + cmd->size;
+}
+
+static std::size_t ExecuteGLCmdCopyBuffer(const void* pc, GLStateManager& /*stateMngr*/)
+{
+    auto cmd = reinterpret_cast<const GLCmdCopyBuffer*>(pc);
+    cmd->writeBuffer->CopyBufferSubData(*(cmd->readBuffer), cmd->readOffset, cmd->writeOffset, cmd->size);
+    return sizeof(*cmd);
+}
+
+static std::size_t ExecuteGLCmdExecute(const void* pc, GLStateManager& stateMngr)
+{
+    auto cmd = reinterpret_cast<const GLCmdExecute*>(pc);
+    ExecuteGLDeferredCommandBuffer(*(cmd->commandBuffer), stateMngr);
+    return sizeof(*cmd);
+}
+
+static std::size_t ExecuteGLCmdSetAPIDepState(const void* pc, GLStateManager& stateMngr)
+{
+    auto cmd = reinterpret_cast<const GLCmdSetAPIDepState*>(pc);
+    stateMngr.SetGraphicsAPIDependentState(cmd->desc);
+    return sizeof(*cmd);
+}
+
+static std::size_t ExecuteGLCmdViewport(const void* pc, GLStateManager& stateMngr)
+{
+    auto cmd = reinterpret_cast<const GLCmdViewport*>(pc);
     {
-        case GLOpcodeUpdateBuffer:
-        {
-            auto cmd = reinterpret_cast<const GLCmdUpdateBuffer*>(pc);
-            cmd->buffer->BufferSubData(cmd->offset, cmd->size, cmd + 1);
-            return sizeof(*cmd) + cmd->size;
-        }
-        case GLOpcodeCopyBuffer:
-        {
-            auto cmd = reinterpret_cast<const GLCmdCopyBuffer*>(pc);
-            cmd->writeBuffer->CopyBufferSubData(*(cmd->readBuffer), cmd->readOffset, cmd->writeOffset, cmd->size);
-            return sizeof(*cmd);
-        }
-        case GLOpcodeExecute:
-        {
-            auto cmd = reinterpret_cast<const GLCmdExecute*>(pc);
-            ExecuteGLDeferredCommandBuffer(*(cmd->commandBuffer), stateMngr);
-            return sizeof(*cmd);
-        }
-        case GLOpcodeSetAPIDepState:
-        {
-            auto cmd = reinterpret_cast<const GLCmdSetAPIDepState*>(pc);
-            stateMngr.SetGraphicsAPIDependentState(cmd->desc);
-            return sizeof(*cmd);
-        }
-        case GLOpcodeViewport:
-        {
-            auto cmd = reinterpret_cast<const GLCmdViewport*>(pc);
-            {
-                GLViewport viewport = cmd->viewport;
-                stateMngr.SetViewport(viewport);
+        GLViewport viewport = cmd->viewport;
+        stateMngr.SetViewport(viewport);
 
-                GLDepthRange depthRange = cmd->depthRange;
-                stateMngr.SetDepthRange(depthRange);
-            }
-            return sizeof(*cmd);
-        }
-        case GLOpcodeViewportArray:
+        GLDepthRange depthRange = cmd->depthRange;
+        stateMngr.SetDepthRange(depthRange);
+    }
+    return sizeof(*cmd);
+}
+
+static std::size_t ExecuteGLCmdViewportArray(const void* pc, GLStateManager& stateMngr)
+{
+    auto cmd = reinterpret_cast<const GLCmdViewportArray*>(pc);
+    auto cmdData = reinterpret_cast<const std::int8_t*>(cmd + 1);
+    {
+        union
         {
-            auto cmd = reinterpret_cast<const GLCmdViewportArray*>(pc);
-            auto cmdData = reinterpret_cast<const std::int8_t*>(cmd + 1);
-            {
-                union
-                {
-                    GLViewport viewports[LLGL_MAX_NUM_VIEWPORTS_AND_SCISSORS];
-                    GLDepthRange depthRanges[LLGL_MAX_NUM_VIEWPORTS_AND_SCISSORS];
-                };
+            GLViewport viewports[LLGL_MAX_NUM_VIEWPORTS_AND_SCISSORS];
+            GLDepthRange depthRanges[LLGL_MAX_NUM_VIEWPORTS_AND_SCISSORS];
+        };
 
-                ::memcpy(viewports, cmdData, sizeof(GLViewport)*cmd->count);
-                stateMngr.SetViewportArray(cmd->first, cmd->count, viewports);
+        ::memcpy(viewports, cmdData, sizeof(GLViewport)*cmd->count);
+        stateMngr.SetViewportArray(cmd->first, cmd->count, viewports);
 
-                ::memcpy(depthRanges, cmdData + sizeof(GLViewport)*cmd->count, sizeof(GLDepthRange)*cmd->count);
-                stateMngr.SetDepthRangeArray(cmd->first, cmd->count, depthRanges);
-            }
-            return (sizeof(*cmd) + sizeof(GLViewport)*cmd->count + sizeof(GLDepthRange)*cmd->count);
-        }
-        case GLOpcodeScissor:
-        {
-            auto cmd = reinterpret_cast<const GLCmdScissor*>(pc);
-            {
-                GLScissor scissor = cmd->scissor;
-                stateMngr.SetScissor(scissor);
-            }
-            return sizeof(*cmd);
-        }
-        case GLOpcodeScissorArray:
-        {
-            auto cmd = reinterpret_cast<const GLCmdScissorArray*>(pc);
-            auto cmdData = reinterpret_cast<const std::int8_t*>(cmd + 1);
-            {
-                GLScissor scissors[LLGL_MAX_NUM_VIEWPORTS_AND_SCISSORS];
-                ::memcpy(scissors, cmdData, sizeof(GLScissor)*cmd->count);
-                stateMngr.SetScissorArray(cmd->first, cmd->count, scissors);
-            }
-            return (sizeof(*cmd) + sizeof(GLScissor)*cmd->count);
-        }
-        case GLOpcodeClearColor:
-        {
-            auto cmd = reinterpret_cast<const GLCmdClearColor*>(pc);
-            glClearColor(cmd->color[0], cmd->color[1], cmd->color[2], cmd->color[3]);
-            return sizeof(*cmd);
-        }
-        case GLOpcodeClearDepth:
-        {
-            auto cmd = reinterpret_cast<const GLCmdClearDepth*>(pc);
-            glClearDepth(cmd->depth);
-            return sizeof(*cmd);
-        }
-        case GLOpcodeClearStencil:
-        {
-            auto cmd = reinterpret_cast<const GLCmdClearStencil*>(pc);
-            glClearStencil(cmd->stencil);
-            return sizeof(*cmd);
-        }
-        case GLOpcodeClear:
-        {
-            auto cmd = reinterpret_cast<const GLCmdClear*>(pc);
-            stateMngr.Clear(cmd->flags);
-            return sizeof(*cmd);
-        }
-        case GLOpcodeClearBuffers:
-        {
-            auto cmd = reinterpret_cast<const GLCmdClearBuffers*>(pc);
-            stateMngr.ClearBuffers(cmd->numAttachments, reinterpret_cast<const AttachmentClear*>(cmd + 1));
-            return sizeof(*cmd);
-        }
-        case GLOpcodeBindVertexArray:
-        {
-            auto cmd = reinterpret_cast<const GLCmdBindVertexArray*>(pc);
-            stateMngr.BindVertexArray(cmd->vao);
-            return sizeof(*cmd);
-        }
-        case GLOpcodeBindElementArrayBufferToVAO:
-        {
-            auto cmd = reinterpret_cast<const GLCmdBindElementArrayBufferToVAO*>(pc);
-            stateMngr.BindElementArrayBufferToVAO(cmd->id);
-            return sizeof(*cmd);
-        }
-        case GLOpcodeBindBufferBase:
-        {
-            auto cmd = reinterpret_cast<const GLCmdBindBufferBase*>(pc);
-            stateMngr.BindBufferBase(cmd->target, cmd->index, cmd->id);
-            return sizeof(*cmd);
-        }
-        case GLOpcodeBindBuffersBase:
-        {
-            auto cmd = reinterpret_cast<const GLCmdBindBuffersBase*>(pc);
-            stateMngr.BindBuffersBase(cmd->target, cmd->first, cmd->count, reinterpret_cast<const GLuint*>(cmd + 1));
-            return (sizeof(*cmd) + sizeof(GLuint)*cmd->count);
-        }
-        case GLOpcodeBeginTransformFeedback:
-        {
-            auto cmd = reinterpret_cast<const GLCmdBeginTransformFeedback*>(pc);
-            glBeginTransformFeedback(cmd->primitiveMove);
-            return sizeof(*cmd);
-        }
+        ::memcpy(depthRanges, cmdData + sizeof(GLViewport)*cmd->count, sizeof(GLDepthRange)*cmd->count);
+        stateMngr.SetDepthRangeArray(cmd->first, cmd->count, depthRanges);
+    }
+    return (sizeof(*cmd) + sizeof(GLViewport)*cmd->count + sizeof(GLDepthRange)*cmd->count);
+}
+
+static std::size_t ExecuteGLCmdScissor(const void* pc, GLStateManager& stateMngr)
+{
+    auto cmd = reinterpret_cast<const GLCmdScissor*>(pc);
+    {
+        GLScissor scissor = cmd->scissor;
+        stateMngr.SetScissor(scissor);
+    }
+    return sizeof(*cmd);
+}
+
+static std::size_t ExecuteGLCmdScissorArray(const void* pc, GLStateManager& stateMngr)
+{
+    auto cmd = reinterpret_cast<const GLCmdScissorArray*>(pc);
+    auto cmdData = reinterpret_cast<const std::int8_t*>(cmd + 1);
+    {
+        GLScissor scissors[LLGL_MAX_NUM_VIEWPORTS_AND_SCISSORS];
+        ::memcpy(scissors, cmdData, sizeof(GLScissor)*cmd->count);
+        stateMngr.SetScissorArray(cmd->first, cmd->count, scissors);
+    }
+    return (sizeof(*cmd) + sizeof(GLScissor)*cmd->count);
+}
+
+static std::size_t ExecuteGLCmdClearColor(const void* pc, GLStateManager& /*stateMngr*/)
+{
+    auto cmd = reinterpret_cast<const GLCmdClearColor*>(pc);
+    glClearColor(cmd->color[0], cmd->color[1], cmd->color[2], cmd->color[3]);
+    return sizeof(*cmd);
+}
+
+static std::size_t ExecuteGLCmdClearDepth(const void* pc, GLStateManager& /*stateMngr*/)
+{
+    auto cmd = reinterpret_cast<const GLCmdClearDepth*>(pc);
+    glClearDepth(cmd->depth);
+    return sizeof(*cmd);
+}
+
+static std::size_t ExecuteGLCmdClearStencil(const void* pc, GLStateManager& /*stateMngr*/)
+{
+    auto cmd = reinterpret_cast<const GLCmdClearStencil*>(pc);
+    glClearStencil(cmd->stencil);
+    return sizeof(*cmd);
+}
+
+static std::size_t ExecuteGLCmdClear(const void* pc, GLStateManager& stateMngr)
+{
+    auto cmd = reinterpret_cast<const GLCmdClear*>(pc);
+    stateMngr.Clear(cmd->flags);
+    return sizeof(*cmd);
+}
+
+static std::size_t ExecuteGLCmdClearBuffers(const void* pc, GLStateManager& stateMngr)
+{
+    auto cmd = reinterpret_cast<const GLCmdClearBuffers*>(pc);
+    stateMngr.ClearBuffers(cmd->numAttachments, reinterpret_cast<const AttachmentClear*>(cmd + 1));
+    return (sizeof(*cmd) + sizeof(AttachmentClear)*cmd->numAttachments);
+}
+
+static std::size_t ExecuteGLCmdBindVertexArray(const void* pc, GLStateManager& stateMngr)
+{
+    auto cmd = reinterpret_cast<const GLCmdBindVertexArray*>(pc);
+    stateMngr.BindVertexArray(cmd->vao);
+    return sizeof(*cmd);
+}
+
+static std::size_t ExecuteGLCmdBindVertexBuffers(const void* pc, GLStateManager& stateMngr)
+{
+    auto cmd        = reinterpret_cast<const GLCmdBindVertexBuffers*>(pc);
+    auto offsets    = reinterpret_cast<const GLintptr*>(cmd + 1);
+    auto buffers    = reinterpret_cast<const GLuint*>(offsets + cmd->count);
+    auto strides    = reinterpret_cast<const GLsizei*>(buffers + cmd->count);
+    stateMngr.BindVertexBuffers(cmd->vao, cmd->count, buffers, offsets, strides);
+    return (sizeof(*cmd) + (sizeof(GLintptr) + sizeof(GLuint) + sizeof(GLsizei))*cmd->count);
+}
+
+static std::size_t ExecuteGLCmdBindElementArrayBufferToVAO(const void* pc, GLStateManager& stateMngr)
+{
+    auto cmd = reinterpret_cast<const GLCmdBindElementArrayBufferToVAO*>(pc);
+    stateMngr.BindElementArrayBufferToVAO(cmd->id);
+    return sizeof(*cmd);
+}
+
+static std::size_t ExecuteGLCmdBindBufferBase(const void* pc, GLStateManager& stateMngr)
+{
+    auto cmd = reinterpret_cast<const GLCmdBindBufferBase*>(pc);
+    stateMngr.BindBufferBase(cmd->target, cmd->index, cmd->id);
+    return sizeof(*cmd);
+}
+
+static std::size_t ExecuteGLCmdBindBuffersBase(const void* pc, GLStateManager& stateMngr)
+{
+    auto cmd = reinterpret_cast<const GLCmdBindBuffersBase*>(pc);
+    stateMngr.BindBuffersBase(cmd->target, cmd->first, cmd->count, reinterpret_cast<const GLuint*>(cmd + 1));
+    return (sizeof(*cmd) + sizeof(GLuint)*cmd->count);
+}
+
+static std::size_t ExecuteGLCmdBeginTransformFeedback(const void* pc, GLStateManager& /*stateMngr*/)
+{
+    auto cmd = reinterpret_cast<const GLCmdBeginTransformFeedback*>(pc);
+    glBeginTransformFeedback(cmd->primitiveMove);
+    return sizeof(*cmd);
+}
+
+#ifdef GL_NV_transform_feedback
+
+static std::size_t ExecuteGLCmdBeginTransformFeedbackNV(const void* pc, GLStateManager& /*stateMngr*/)
+{
+    auto cmd = reinterpret_cast<const GLCmdBeginTransformFeedbackNV*>(pc);
+    glBeginTransformFeedbackNV(cmd->primitiveMove);
+    return sizeof(*cmd);
+}
+
+#endif // /GL_NV_transform_feedback
+
+static std::size_t ExecuteGLCmdEndTransformFeedback(const void* /*pc*/, GLStateManager& /*stateMngr*/)
+{
+    glEndTransformFeedback();
+    return 0;
+}
+
+#ifdef GL_NV_transform_feedback
+
+static std::size_t ExecuteGLCmdEndTransformFeedbackNV(const void* /*pc*/, GLStateManager& /*stateMngr*/)
+{
+    glEndTransformFeedbackNV();
+    return 0;
+}
+
+#endif // /GL_NV_transform_feedback
+
+static std::size_t ExecuteGLCmdBindResourceHeap(const void* pc, GLStateManager& stateMngr)
+{
+    auto cmd = reinterpret_cast<const GLCmdBindResourceHeap*>(pc);
+    cmd->resourceHeap->Bind(stateMngr);
+    return sizeof(*cmd);
+}
+
+static std::size_t ExecuteGLCmdBindRenderPass(const void* pc, GLStateManager& stateMngr)
+{
+    auto cmd = reinterpret_cast<const GLCmdBindRenderPass*>(pc);
+    stateMngr.BindRenderPass(*(cmd->renderTarget), cmd->renderPass, cmd->numClearValues, reinterpret_cast<const ClearValue*>(cmd + 1), cmd->defaultClearValue);
+    return (sizeof(*cmd) + sizeof(ClearValue)*cmd->numClearValues);
+}
+
+static std::size_t ExecuteGLCmdBindGraphicsPipeline(const void* pc, GLStateManager& stateMngr)
+{
+    auto cmd = reinterpret_cast<const GLCmdBindGraphicsPipeline*>(pc);
+    cmd->graphicsPipeline->Bind(stateMngr);
+    return sizeof(*cmd);
+}
+
+static std::size_t ExecuteGLCmdBindComputePipeline(const void* pc, GLStateManager& stateMngr)
+{
+    auto cmd = reinterpret_cast<const GLCmdBindComputePipeline*>(pc);
+    cmd->computePipeline->Bind(stateMngr);
+    return sizeof(*cmd);
+}
+
+static std::size_t ExecuteGLCmdBeginQuery(const void* pc, GLStateManager& /*stateMngr*/)
+{
+    auto cmd = reinterpret_cast<const GLCmdBeginQuery*>(pc);
+    cmd->queryHeap->Begin(cmd->query);
+    return sizeof(*cmd);
+}
+
+static std::size_t ExecuteGLCmdEndQuery(const void* pc, GLStateManager& /*stateMngr*/)
+{
+    auto cmd = reinterpret_cast<const GLCmdEndQuery*>(pc);
+    cmd->queryHeap->End(cmd->query);
+    return sizeof(*cmd);
+}
+
+static std::size_t ExecuteGLCmdResolveQueries(const void* pc, GLStateManager& stateMngr)
+{
+    auto cmd = reinterpret_cast<const GLCmdResolveQueries*>(pc);
+    cmd->queryHeap->Resolve(stateMngr, cmd->firstQuery, cmd->numQueries, cmd->buffer, cmd->offset);
+    return sizeof(*cmd);
+}
+
+static std::size_t ExecuteGLCmdBeginConditionalRender(const void* pc, GLStateManager& /*stateMngr*/)
+{
+    auto cmd = reinterpret_cast<const GLCmdBeginConditionalRender*>(pc);
+    glBeginConditionalRender(cmd->id, cmd->mode);
+    return sizeof(*cmd);
+}
+
+static std::size_t ExecuteGLCmdEndConditionalRender(const void* /*pc*/, GLStateManager& /*stateMngr*/)
+{
+    glEndConditionalRender();
+    return 0;
+}
+
+static std::size_t ExecuteGLCmdDrawArrays(const void* pc, GLStateManager& /*stateMngr*/)
+{
+    auto cmd = reinterpret_cast<const GLCmdDrawArrays*>(pc);
+    glDrawArrays(cmd->mode, cmd->first, cmd->count);
+    return sizeof(*cmd);
+}
+
+static std::size_t ExecuteGLCmdDrawArraysInstanced(const void* pc, GLStateManager& /*stateMngr*/)
+{
+    auto cmd = reinterpret_cast<const GLCmdDrawArraysInstanced*>(pc);
+    glDrawArraysInstanced(cmd->mode, cmd->first, cmd->count, cmd->instancecount);
+    return sizeof(*cmd);
+}
+
+#ifdef GL_ARB_base_instance
+
+static std::size_t ExecuteGLCmdDrawArraysInstancedBaseInstance(const void* pc, GLStateManager& /*stateMngr*/)
+{
+    auto cmd = reinterpret_cast<const GLCmdDrawArraysInstancedBaseInstance*>(pc);
+    glDrawArraysInstancedBaseInstance(cmd->mode, cmd->first, cmd->count, cmd->instancecount, cmd->baseinstance);
+    return sizeof(*cmd);
+}
+
+#endif // /GL_ARB_base_instance
+
+static std::size_t ExecuteGLCmdDrawArraysIndirect(const void* pc, GLStateManager& stateMngr)
+{
+    auto cmd = reinterpret_cast<const GLCmdDrawArraysIndirect*>(pc);
+    stateMngr.BindBuffer(GLBufferTarget::DRAW_INDIRECT_BUFFER, cmd->id);
+    GLintptr offset = cmd->indirect;
+    for (std::uint32_t i = 0; i < cmd->numCommands; ++i)
+    {
+        glDrawArraysIndirect(cmd->mode, reinterpret_cast<const GLvoid*>(offset));
+        offset += cmd->stride;
+    }
+    return sizeof(*cmd);
+}
+
+static std::size_t ExecuteGLCmdDrawElements(const void* pc, GLStateManager& /*stateMngr*/)
+{
+    auto cmd = reinterpret_cast<const GLCmdDrawElements*>(pc);
+    glDrawElements(cmd->mode, cmd->count, cmd->type, cmd->indices);
+    return sizeof(*cmd);
+}
+
+static std::size_t ExecuteGLCmdDrawElementsBaseVertex(const void* pc, GLStateManager& /*stateMngr*/)
+{
+    auto cmd = reinterpret_cast<const GLCmdDrawElementsBaseVertex*>(pc);
+    glDrawElementsBaseVertex(cmd->mode, cmd->count, cmd->type, cmd->indices, cmd->basevertex);
+    return sizeof(*cmd);
+}
+
+static std::size_t ExecuteGLCmdDrawElementsInstanced(const void* pc, GLStateManager& /*stateMngr*/)
+{
+    auto cmd = reinterpret_cast<const GLCmdDrawElementsInstanced*>(pc);
+    glDrawElementsInstanced(cmd->mode, cmd->count, cmd->type, cmd->indices, cmd->instancecount);
+    return sizeof(*cmd);
+}
+
+static std::size_t ExecuteGLCmdDrawElementsInstancedBaseVertex(const void* pc, GLStateManager& /*stateMngr*/)
+{
+    auto cmd = reinterpret_cast<const GLCmdDrawElementsInstancedBaseVertex*>(pc);
+    glDrawElementsInstancedBaseVertex(cmd->mode, cmd->count, cmd->type, cmd->indices, cmd->instancecount, cmd->basevertex);
+    return sizeof(*cmd);
+}
+
+#ifdef GL_ARB_base_instance
+
+static std::size_t ExecuteGLCmdDrawElementsInstancedBaseVertexBaseInstance(const void* pc, GLStateManager& /*stateMngr*/)
+{
+    auto cmd = reinterpret_cast<const GLCmdDrawElementsInstancedBaseVertexBaseInstance*>(pc);
+    glDrawElementsInstancedBaseVertexBaseInstance(cmd->mode, cmd->count, cmd->type, cmd->indices, cmd->instancecount, cmd->basevertex, cmd->baseinstance);
+    return sizeof(*cmd);
+}
+
+#endif // /GL_ARB_base_instance
+
+static std::size_t ExecuteGLCmdDrawElementsIndirect(const void* pc, GLStateManager& stateMngr)
+{
+    auto cmd = reinterpret_cast<const GLCmdDrawElementsIndirect*>(pc);
+    stateMngr.BindBuffer(GLBufferTarget::DRAW_INDIRECT_BUFFER, cmd->id);
+    GLintptr offset = cmd->indirect;
+    for (std::uint32_t i = 0; i < cmd->numCommands; ++i)
+    {
+        glDrawElementsIndirect(cmd->mode, cmd->type, reinterpret_cast<const GLvoid*>(offset));
+        offset += cmd->stride;
+    }
+    return sizeof(*cmd);
+}
+
+#ifdef GL_ARB_multi_draw_indirect
+
+static std::size_t ExecuteGLCmdMultiDrawArraysIndirect(const void* pc, GLStateManager& stateMngr)
+{
+    auto cmd = reinterpret_cast<const GLCmdMultiDrawArraysIndirect*>(pc);
+    stateMngr.BindBuffer(GLBufferTarget::DRAW_INDIRECT_BUFFER, cmd->id);
+    glMultiDrawArraysIndirect(cmd->mode, cmd->indirect, cmd->drawcount, cmd->stride);
+    return sizeof(*cmd);
+}
+
+static std::size_t ExecuteGLCmdMultiDrawElementsIndirect(const void* pc, GLStateManager& stateMngr)
+{
+    auto cmd = reinterpret_cast<const GLCmdMultiDrawElementsIndirect*>(pc);
+    stateMngr.BindBuffer(GLBufferTarget::DRAW_INDIRECT_BUFFER, cmd->id);
+    glMultiDrawElementsIndirect(cmd->mode, cmd->type, cmd->indirect, cmd->drawcount, cmd->stride);
+    return sizeof(*cmd);
+}
+
+#endif // /GL_ARB_multi_draw_indirect
+
+#ifdef GL_ARB_compute_shader
+
+static std::size_t ExecuteGLCmdDispatchCompute(const void* pc, GLStateManager& /*stateMngr*/)
+{
+    auto cmd = reinterpret_cast<const GLCmdDispatchCompute*>(pc);
+    glDispatchCompute(cmd->numgroups[0], cmd->numgroups[1], cmd->numgroups[2]);
+    return sizeof(*cmd);
+}
+
+static std::size_t ExecuteGLCmdDispatchComputeIndirect(const void* pc, GLStateManager& stateMngr)
+{
+    auto cmd = reinterpret_cast<const GLCmdDispatchComputeIndirect*>(pc);
+    stateMngr.BindBuffer(GLBufferTarget::DISPATCH_INDIRECT_BUFFER, cmd->id);
+    glDispatchComputeIndirect(cmd->indirect);
+    return sizeof(*cmd);
+}
+
+#endif // /GL_ARB_compute_shader
+
+static std::size_t ExecuteGLCmdBindTexture(const void* pc, GLStateManager& stateMngr)
+{
+    auto cmd = reinterpret_cast<const GLCmdBindTexture*>(pc);
+    stateMngr.BindTextureSlot(cmd->slot, GLStateManager::GetTextureTarget(cmd->texture->GetType()), cmd->texture->GetID());
+    return sizeof(*cmd);
+}
+
+static std::size_t ExecuteGLCmdBindSampler(const void* pc, GLStateManager& stateMngr)
+{
+    auto cmd = reinterpret_cast<const GLCmdBindSampler*>(pc);
+    stateMngr.BindSampler(cmd->slot, cmd->sampler);
+    return sizeof(*cmd);
+}
+
+static std::size_t ExecuteGLCmdUnbindResources(const void* pc, GLStateManager& stateMngr)
+{
+    auto cmd = reinterpret_cast<const GLCmdUnbindResources*>(pc);
+    if (cmd->resetUBO)
+        stateMngr.UnbindBuffersBase(GLBufferTarget::UNIFORM_BUFFER, cmd->first, cmd->count);
+    if (cmd->resetSSAO)
+        stateMngr.UnbindBuffersBase(GLBufferTarget::SHADER_STORAGE_BUFFER, cmd->first, cmd->count);
+    if (cmd->resetTransformFeedback)
+        stateMngr.UnbindBuffersBase(GLBufferTarget::TRANSFORM_FEEDBACK_BUFFER, cmd->first, cmd->count);
+    if (cmd->resetTextures)
+        stateMngr.UnbindTextures(cmd->first, cmd->count);
+    #if 0//TODO
+    if (cmd->resetImages)
+        stateMngr.UnbindImages(cmd->first, cmd->count);
+    #endif
+    if (cmd->resetSamplers)
+        stateMngr.UnbindSamplers(cmd->first, cmd->count);
+    return sizeof(*cmd);
+}
+
+static std::size_t ExecuteGLCmdFlushResourceBindings(const void* /*pc*/, GLStateManager& stateMngr)
+{
+    stateMngr.FlushResourceBindings();
+    return 0;
+}
+
+static std::size_t ExecuteGLCmdSetStorageBufferWriteMask(const void* pc, GLStateManager& stateMngr)
+{
+    auto cmd = reinterpret_cast<const GLCmdSetStorageBufferWriteMask*>(pc);
+    stateMngr.SetStorageBufferWriteMask(cmd->slotMask, cmd->writeMask);
+    return sizeof(*cmd);
+}
+
+static std::size_t ExecuteGLCmdFlushMemoryBarriers(const void* pc, GLStateManager& stateMngr)
+{
+    auto cmd = reinterpret_cast<const GLCmdFlushMemoryBarriers*>(pc);
+    stateMngr.FlushMemoryBarriers(cmd->drawCommand, cmd->indirectBuffer);
+    return sizeof(*cmd);
+}
+
+static std::size_t ExecuteGLCmdMultiDrawElementsBatch(const void* pc, GLStateManager& stateMngr)
+{
+    auto cmd = reinterpret_cast<const GLCmdMultiDrawElementsBatch*>(pc);
+    GLMultiDrawElementsBatch(stateMngr, cmd->mode, cmd->type, cmd->drawcount, reinterpret_cast<const GLDrawElementsIndirectCommand*>(cmd + 1));
+    return (sizeof(*cmd) + sizeof(GLDrawElementsIndirectCommand)*cmd->drawcount);
+}
+
+static std::size_t ExecuteGLCmdInvoke(const void* pc, GLStateManager& /*stateMngr*/)
+{
+    auto cmd = reinterpret_cast<const GLCmdInvoke*>(pc);
+    cmd->func(cmd->userData);
+    return sizeof(*cmd);
+}
+
+static std::size_t ExecuteGLCmdNull(const void* /*pc*/, GLStateManager& /*stateMngr*/)
+{
+    return 0;
+}
+
+static GLCommandHandler GetGLCommandHandler(const GLOpcode opcode)
+{
+    switch (opcode)
+    {
+        case GLOpcodeUpdateBuffer:                          return ExecuteGLCmdUpdateBuffer;
+        case GLOpcodeCopyBuffer:                            return ExecuteGLCmdCopyBuffer;
+        case GLOpcodeExecute:                               return ExecuteGLCmdExecute;
+        case GLOpcodeSetAPIDepState:                        return ExecuteGLCmdSetAPIDepState;
+        case GLOpcodeViewport:                              return ExecuteGLCmdViewport;
+        case GLOpcodeViewportArray:                         return ExecuteGLCmdViewportArray;
+        case GLOpcodeScissor:                               return ExecuteGLCmdScissor;
+        case GLOpcodeScissorArray:                          return ExecuteGLCmdScissorArray;
+        case GLOpcodeClearColor:                            return ExecuteGLCmdClearColor;
+        case GLOpcodeClearDepth:                            return ExecuteGLCmdClearDepth;
+        case GLOpcodeClearStencil:                          return ExecuteGLCmdClearStencil;
+        case GLOpcodeClear:                                 return ExecuteGLCmdClear;
+        case GLOpcodeClearBuffers:                          return ExecuteGLCmdClearBuffers;
+        case GLOpcodeBindVertexArray:                       return ExecuteGLCmdBindVertexArray;
+        case GLOpcodeBindVertexBuffers:                     return ExecuteGLCmdBindVertexBuffers;
+        case GLOpcodeBindElementArrayBufferToVAO:           return ExecuteGLCmdBindElementArrayBufferToVAO;
+        case GLOpcodeBindBufferBase:                        return ExecuteGLCmdBindBufferBase;
+        case GLOpcodeBindBuffersBase:                       return ExecuteGLCmdBindBuffersBase;
+        case GLOpcodeBeginTransformFeedback:                return ExecuteGLCmdBeginTransformFeedback;
         #ifdef GL_NV_transform_feedback
-        case GLOpcodeBeginTransformFeedbackNV:
-        {
-            auto cmd = reinterpret_cast<const GLCmdBeginTransformFeedbackNV*>(pc);
-            glBeginTransformFeedbackNV(cmd->primitiveMove);
-            return sizeof(*cmd);
-        }
+        case GLOpcodeBeginTransformFeedbackNV:              return ExecuteGLCmdBeginTransformFeedbackNV;
         #endif // /GL_NV_transform_feedback
-        case GLOpcodeEndTransformFeedback:
-        {
-            glEndTransformFeedback();
-            return 0;
-        }
+        case GLOpcodeEndTransformFeedback:                  return ExecuteGLCmdEndTransformFeedback;
         #ifdef GL_NV_transform_feedback
-        case GLOpcodeEndTransformFeedbackNV:
-        {
-            glEndTransformFeedbackNV();
-            return 0;
-        }
+        case GLOpcodeEndTransformFeedbackNV:                return ExecuteGLCmdEndTransformFeedbackNV;
         #endif // /GL_NV_transform_feedback
-        case GLOpcodeBindResourceHeap:
-        {
-            auto cmd = reinterpret_cast<const GLCmdBindResourceHeap*>(pc);
-            cmd->resourceHeap->Bind(stateMngr);
-            return sizeof(*cmd);
-        }
-        case GLOpcodeBindRenderPass:
-        {
-            auto cmd = reinterpret_cast<const GLCmdBindRenderPass*>(pc);
-            stateMngr.BindRenderPass(*(cmd->renderTarget), cmd->renderPass, cmd->numClearValues, reinterpret_cast<const ClearValue*>(cmd + 1), cmd->defaultClearValue);
-            return (sizeof(*cmd) + sizeof(ClearValue)*cmd->numClearValues);
-        }
-        case GLOpcodeBindGraphicsPipeline:
-        {
-            auto cmd = reinterpret_cast<const GLCmdBindGraphicsPipeline*>(pc);
-            cmd->graphicsPipeline->Bind(stateMngr);
-            return sizeof(*cmd);
-        }
-        case GLOpcodeBindComputePipeline:
-        {
-            auto cmd = reinterpret_cast<const GLCmdBindComputePipeline*>(pc);
-            cmd->computePipeline->Bind(stateMngr);
-            return sizeof(*cmd);
-        }
-        case GLOpcodeBeginQuery:
-        {
-            auto cmd = reinterpret_cast<const GLCmdBeginQuery*>(pc);
-            cmd->queryHeap->Begin(cmd->query);
-            return sizeof(*cmd);
-        }
-        case GLOpcodeEndQuery:
-        {
-            auto cmd = reinterpret_cast<const GLCmdEndQuery*>(pc);
-            cmd->queryHeap->End(cmd->query);
-            return sizeof(*cmd);
-        }
-        case GLOpcodeBeginConditionalRender:
-        {
-            auto cmd = reinterpret_cast<const GLCmdBeginConditionalRender*>(pc);
-            glBeginConditionalRender(cmd->id, cmd->mode);
-            return sizeof(*cmd);
-        }
-        case GLOpcodeEndConditionalRender:
-        {
-            glEndConditionalRender();
-            return 0;
-        }
-        case GLOpcodeDrawArrays:
-        {
-            auto cmd = reinterpret_cast<const GLCmdDrawArrays*>(pc);
-            glDrawArrays(cmd->mode, cmd->first, cmd->count);
-            return sizeof(*cmd);
-        }
-        case GLOpcodeDrawArraysInstanced:
-        {
-            auto cmd = reinterpret_cast<const GLCmdDrawArraysInstanced*>(pc);
-            glDrawArraysInstanced(cmd->mode, cmd->first, cmd->count, cmd->instancecount);
-            return sizeof(*cmd);
-        }
+        case GLOpcodeBindResourceHeap:                      return ExecuteGLCmdBindResourceHeap;
+        case GLOpcodeBindRenderPass:                        return ExecuteGLCmdBindRenderPass;
+        case GLOpcodeBindGraphicsPipeline:                  return ExecuteGLCmdBindGraphicsPipeline;
+        case GLOpcodeBindComputePipeline:                   return ExecuteGLCmdBindComputePipeline;
+        case GLOpcodeBeginQuery:                            return ExecuteGLCmdBeginQuery;
+        case GLOpcodeEndQuery:                              return ExecuteGLCmdEndQuery;
+        case GLOpcodeResolveQueries:                        return ExecuteGLCmdResolveQueries;
+        case GLOpcodeBeginConditionalRender:                return ExecuteGLCmdBeginConditionalRender;
+        case GLOpcodeEndConditionalRender:                  return ExecuteGLCmdEndConditionalRender;
+        case GLOpcodeDrawArrays:                            return ExecuteGLCmdDrawArrays;
+        case GLOpcodeDrawArraysInstanced:                   return ExecuteGLCmdDrawArraysInstanced;
         #ifdef GL_ARB_base_instance
-        case GLOpcodeDrawArraysInstancedBaseInstance:
-        {
-            auto cmd = reinterpret_cast<const GLCmdDrawArraysInstancedBaseInstance*>(pc);
-            glDrawArraysInstancedBaseInstance(cmd->mode, cmd->first, cmd->count, cmd->instancecount, cmd->baseinstance);
-            return sizeof(*cmd);
-        }
+        case GLOpcodeDrawArraysInstancedBaseInstance:       return ExecuteGLCmdDrawArraysInstancedBaseInstance;
         #endif // /GL_ARB_base_instance
-        case GLOpcodeDrawArraysIndirect:
-        {
-            auto cmd = reinterpret_cast<const GLCmdDrawArraysIndirect*>(pc);
-            stateMngr.BindBuffer(GLBufferTarget::DRAW_INDIRECT_BUFFER, cmd->id);
-            GLintptr offset = cmd->indirect;
-            for (std::uint32_t i = 0; i < cmd->numCommands; ++i)
-            {
-                glDrawArraysIndirect(cmd->mode, reinterpret_cast<const GLvoid*>(offset));
-                offset += cmd->stride;
-            }
-            return sizeof(*cmd);
-        }
-        case GLOpcodeDrawElements:
-        {
-            auto cmd = reinterpret_cast<const GLCmdDrawElements*>(pc);
-            glDrawElements(cmd->mode, cmd->count, cmd->type, cmd->indices);
-            return sizeof(*cmd);
-        }
-        case GLOpcodeDrawElementsBaseVertex:
-        {
-            auto cmd = reinterpret_cast<const GLCmdDrawElementsBaseVertex*>(pc);
-            glDrawElementsBaseVertex(cmd->mode, cmd->count, cmd->type, cmd->indices, cmd->basevertex);
-            return sizeof(*cmd);
-        }
-        case GLOpcodeDrawElementsInstanced:
-        {
-            auto cmd = reinterpret_cast<const GLCmdDrawElementsInstanced*>(pc);
-            glDrawElementsInstanced(cmd->mode, cmd->count, cmd->type, cmd->indices, cmd->instancecount);
-            return sizeof(*cmd);
-        }
-        case GLOpcodeDrawElementsInstancedBaseVertex:
-        {
-            auto cmd = reinterpret_cast<const GLCmdDrawElementsInstancedBaseVertex*>(pc);
-            glDrawElementsInstancedBaseVertex(cmd->mode, cmd->count, cmd->type, cmd->indices, cmd->instancecount, cmd->basevertex);
-            return sizeof(*cmd);
-        }
+        case GLOpcodeDrawArraysIndirect:                    return ExecuteGLCmdDrawArraysIndirect;
+        case GLOpcodeDrawElements:                          return ExecuteGLCmdDrawElements;
+        case GLOpcodeDrawElementsBaseVertex:                return ExecuteGLCmdDrawElementsBaseVertex;
+        case GLOpcodeDrawElementsInstanced:                 return ExecuteGLCmdDrawElementsInstanced;
+        case GLOpcodeDrawElementsInstancedBaseVertex:       return ExecuteGLCmdDrawElementsInstancedBaseVertex;
         #ifdef GL_ARB_base_instance
-        case GLOpcodeDrawElementsInstancedBaseVertexBaseInstance:
-        {
-            auto cmd = reinterpret_cast<const GLCmdDrawElementsInstancedBaseVertexBaseInstance*>(pc);
-            glDrawElementsInstancedBaseVertexBaseInstance(cmd->mode, cmd->count, cmd->type, cmd->indices, cmd->instancecount, cmd->basevertex, cmd->baseinstance);
-            return sizeof(*cmd);
-        }
+        case GLOpcodeDrawElementsInstancedBaseVertexBaseInstance: return ExecuteGLCmdDrawElementsInstancedBaseVertexBaseInstance;
         #endif // /GL_ARB_base_instance
-        case GLOpcodeDrawElementsIndirect:
-        {
-            auto cmd = reinterpret_cast<const GLCmdDrawElementsIndirect*>(pc);
-            stateMngr.BindBuffer(GLBufferTarget::DRAW_INDIRECT_BUFFER, cmd->id);
-            GLintptr offset = cmd->indirect;
-            for (std::uint32_t i = 0; i < cmd->numCommands; ++i)
-            {
-                glDrawElementsIndirect(cmd->mode, cmd->type, reinterpret_cast<const GLvoid*>(offset));
-                offset += cmd->stride;
-            }
-            return sizeof(*cmd);
-        }
+        case GLOpcodeDrawElementsIndirect:                  return ExecuteGLCmdDrawElementsIndirect;
         #ifdef GL_ARB_multi_draw_indirect
-        case GLOpcodeMultiDrawArraysIndirect:
-        {
-            auto cmd = reinterpret_cast<const GLCmdMultiDrawArraysIndirect*>(pc);
-            stateMngr.BindBuffer(GLBufferTarget::DRAW_INDIRECT_BUFFER, cmd->id);
-            glMultiDrawArraysIndirect(cmd->mode, cmd->indirect, cmd->drawcount, cmd->stride);
-            return sizeof(*cmd);
-        }
-        case GLOpcodeMultiDrawElementsIndirect:
-        {
-            auto cmd = reinterpret_cast<const GLCmdMultiDrawElementsIndirect*>(pc);
-            stateMngr.BindBuffer(GLBufferTarget::DRAW_INDIRECT_BUFFER, cmd->id);
-            glMultiDrawElementsIndirect(cmd->mode, cmd->type, cmd->indirect, cmd->drawcount, cmd->stride);
-            return sizeof(*cmd);
-        }
+        case GLOpcodeMultiDrawArraysIndirect:               return ExecuteGLCmdMultiDrawArraysIndirect;
+        case GLOpcodeMultiDrawElementsIndirect:             return ExecuteGLCmdMultiDrawElementsIndirect;
         #endif // /GL_ARB_multi_draw_indirect
         #ifdef GL_ARB_compute_shader
-        case GLOpcodeDispatchCompute:
-        {
-            auto cmd = reinterpret_cast<const GLCmdDispatchCompute*>(pc);
-            glDispatchCompute(cmd->numgroups[0], cmd->numgroups[1], cmd->numgroups[2]);
-            return sizeof(*cmd);
-        }
-        case GLOpcodeDispatchComputeIndirect:
-        {
-            auto cmd = reinterpret_cast<const GLCmdDispatchComputeIndirect*>(pc);
-            stateMngr.BindBuffer(GLBufferTarget::DISPATCH_INDIRECT_BUFFER, cmd->id);
-            glDispatchComputeIndirect(cmd->indirect);
-            return sizeof(*cmd);
-        }
+        case GLOpcodeDispatchCompute:                       return ExecuteGLCmdDispatchCompute;
+        case GLOpcodeDispatchComputeIndirect:               return ExecuteGLCmdDispatchComputeIndirect;
         #endif // /GL_ARB_compute_shader
-        case GLOpcodeBindTexture:
-        {
-            auto cmd = reinterpret_cast<const GLCmdBindTexture*>(pc);
-            stateMngr.ActiveTexture(cmd->slot);
-            stateMngr.BindGLTexture(*(cmd->texture));
-            return sizeof(*cmd);
-        }
-        case GLOpcodeBindSampler:
-        {
-            auto cmd = reinterpret_cast<const GLCmdBindSampler*>(pc);
-            stateMngr.BindSampler(cmd->slot, cmd->sampler);
-            return sizeof(*cmd);
-        }
-        case GLOpcodeUnbindResources:
+        case GLOpcodeBindTexture:                           return ExecuteGLCmdBindTexture;
+        case GLOpcodeBindSampler:                           return ExecuteGLCmdBindSampler;
+        case GLOpcodeUnbindResources:                       return ExecuteGLCmdUnbindResources;
+        case GLOpcodeFlushResourceBindings:                 return ExecuteGLCmdFlushResourceBindings;
+        case GLOpcodeSetStorageBufferWriteMask:             return ExecuteGLCmdSetStorageBufferWriteMask;
+        case GLOpcodeFlushMemoryBarriers:                   return ExecuteGLCmdFlushMemoryBarriers;
+        case GLOpcodeMultiDrawElementsBatch:                return ExecuteGLCmdMultiDrawElementsBatch;
+        case GLOpcodeInvoke:                                return ExecuteGLCmdInvoke;
+        default:                                            return nullptr;
+    }
+}
+
+// Returns the table of GL command handlers for all opcodes. Unknown opcodes are mapped to a handler that does nothing.
+static const GLCommandHandler* GetGLCommandHandlerTable()
+{
+    struct GLCommandHandlerTable
+    {
+        GLCommandHandlerTable()
         {
-            auto cmd = reinterpret_cast<const GLCmdUnbindResources*>(pc);
-            if (cmd->resetUBO)
-                stateMngr.UnbindBuffersBase(GLBufferTarget::UNIFORM_BUFFER, cmd->first, cmd->count);
-            if (cmd->resetSSAO)
-                stateMngr.UnbindBuffersBase(GLBufferTarget::SHADER_STORAGE_BUFFER, cmd->first, cmd->count);
-            if (cmd->resetTransformFeedback)
-                stateMngr.UnbindBuffersBase(GLBufferTarget::TRANSFORM_FEEDBACK_BUFFER, cmd->first, cmd->count);
-            if (cmd->resetTextures)
-                stateMngr.UnbindTextures(cmd->first, cmd->count);
-            #if 0//TODO
-            if (cmd->resetImages)
-                stateMngr.UnbindImages(cmd->first, cmd->count);
-            #endif
-            if (cmd->resetSamplers)
-                stateMngr.UnbindSamplers(cmd->first, cmd->count);
-            return sizeof(*cmd);
+            for (int i = 0; i < 256; ++i)
+            {
+                if (auto handler = GetGLCommandHandler(static_cast<GLOpcode>(i)))
+                    handlers[i] = handler;
+                else
+                    handlers[i] = ExecuteGLCmdNull;
+            }
         }
-        default:
-            return 0;
-    }
+
+        GLCommandHandler handlers[256];
+    };
+
+    static const GLCommandHandlerTable table;
+    return table.handlers;
 }
 
-static void ExecuteGLCommandsEmulated(const std::vector<std::uint8_t>& rawBuffer, GLStateManager& stateMngr)
+static void ExecuteGLCommandsEmulated(const GLCommandChunk* chunk, GLStateManager& stateMngr)
 {
-    /* Initialize program counter to execute virtual GL commands */
-    auto pc     = rawBuffer.data();
-    auto pcEnd  = rawBuffer.data() + rawBuffer.size();
+    const auto handlers = GetGLCommandHandlerTable();
 
     GLOpcode opcode;
 
-    while (pc < pcEnd)
+    for (; chunk != nullptr; chunk = chunk->next)
     {
-        /* Read opcode */
-        opcode = *reinterpret_cast<const GLOpcode*>(pc);
-        pc += sizeof(GLOpcode);
+        /* Initialize program counter to execute virtual GL commands of the current chunk */
+        auto pc     = chunk->Data();
+        auto pcEnd  = chunk->Data() + chunk->size;
 
-        /* Execute command and increment program counter */
-        pc += ExecuteGLCommand(opcode, pc, stateMngr);
+        while (pc < pcEnd)
+        {
+            /* Read opcode */
+            opcode = *reinterpret_cast<const GLOpcode*>(pc);
+            pc += sizeof(GLOpcode);
+
+            /* Execute command and increment program counter */
+            pc += handlers[opcode](pc, stateMngr);
+        }
     }
 }
 
+static void ExecuteGLCommandsDecoded(const std::vector<GLDecodedCommand>& decodedCommands, GLStateManager& stateMngr)
+{
+    /* Execute pre-decoded command handlers without reading opcodes */
+    for (const auto& cmd : decodedCommands)
+        cmd.handler(cmd.pc, stateMngr);
+}
+
 #ifdef LLGL_ENABLE_JIT_COMPILER
 
 static void ExecuteGLCommandsNatively(const JITProgram& exec, GLStateManager& stateMngr)
@@ -425,6 +642,29 @@ static void ExecuteGLCommandsNatively(const JITProgram& exec, GLStateManager& st
 
 #endif // /LLGL_ENABLE_JIT_COMPILER
 
+void DecodeGLDeferredCommandBuffer(const GLDeferredCommandBuffer& cmdBuffer, std::vector<GLDecodedCommand>& decodedCommands)
+{
+    const auto handlers = GetGLCommandHandlerTable();
+
+    decodedCommands.clear();
+
+    for (auto chunk = cmdBuffer.GetFirstChunk(); chunk != nullptr; chunk = chunk->next)
+    {
+        auto pc     = chunk->Data();
+        auto pcEnd  = chunk->Data() + chunk->size;
+
+        while (pc < pcEnd)
+        {
+            /* Read opcode and store its handler with the command structure */
+            auto opcode = *reinterpret_cast<const GLOpcode*>(pc);
+            pc += sizeof(GLOpcode);
+
+            decodedCommands.push_back({ handlers[opcode], pc });
+            pc += GetGLCommandSize(opcode, pc);
+        }
+    }
+}
+
 void ExecuteGLDeferredCommandBuffer(const GLDeferredCommandBuffer& cmdBuffer, GLStateManager& stateMngr)
 {
     #ifdef LLGL_ENABLE_JIT_COMPILER
@@ -435,12 +675,24 @@ void ExecuteGLDeferredCommandBuffer(const GLDeferredCommandBuffer& cmdBuffer, GL
     }
     else
     #endif // /LLGL_ENABLE_JIT_COMPILER
+    if (!cmdBuffer.GetDecodedCommands().empty())
+    {
+        /* Execute GL commands with pre-decoded command handlers */
+        ExecuteGLCommandsDecoded(cmdBuffer.GetDecodedCommands(), stateMngr);
+    }
+    else
     {
         /* Emulate execution of GL commands */
-        ExecuteGLCommandsEmulated(cmdBuffer.GetRawBuffer(), stateMngr);
+        ExecuteGLCommandsEmulated(cmdBuffer.GetFirstChunk(), stateMngr);
     }
 }
 
+std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLStateManager& stateMngr)
+{
+    static const auto handlers = GetGLCommandHandlerTable();
+    return handlers[opcode](pc, stateMngr);
+}
+
 void ExecuteGLCommandBuffer(const GLCommandBuffer& cmdBuffer, GLStateManager& stateMngr)
 {
     /* Is this a secondary command buffer? */
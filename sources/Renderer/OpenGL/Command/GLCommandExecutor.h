@@ -9,6 +9,11 @@
 #define LLGL_GL_COMMAND_EXECUTOR_H
 
 
+#include "GLCommandOpcode.h"
+#include <cstddef>
+#include <vector>
+
+
 namespace LLGL
 {
 
@@ -17,7 +22,28 @@ class GLStateManager;
 class GLCommandBuffer;
 class GLDeferredCommandBuffer;
 
+// Function pointer to execute a single GL command. Returns the size of the command (excluding the opcode).
+using GLCommandHandler = std::size_t (*)(const void* pc, GLStateManager& stateMngr);
+
+// Pre-decoded GL command with its handler and the pointer to its command structure.
+struct GLDecodedCommand
+{
+    GLCommandHandler    handler;
+    const void*         pc;
+};
+
+/*
+Pre-decodes all commands of the specified deferred command buffer into a list of command handlers.
+This is used for command buffers that are submitted multiple times when the JIT compiler is not available.
+The decoded commands refer to the command buffer's memory, so they must be decoded again after the command buffer has been re-encoded.
+*/
+void DecodeGLDeferredCommandBuffer(const GLDeferredCommandBuffer& cmdBuffer, std::vector<GLDecodedCommand>& decodedCommands);
+
 void ExecuteGLDeferredCommandBuffer(const GLDeferredCommandBuffer& cmdbuffer, GLStateManager& stateMngr);
+
+// Executes a single GL command and returns its size (excluding the opcode).
+std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLStateManager& stateMngr);
+
 void ExecuteGLCommandBuffer(const GLCommandBuffer& cmdbuffer, GLStateManager& stateMngr);
 
 
@@ -32,6 +32,7 @@ enum GLOpcode : std::uint8_t
     GLOpcodeClear,
     GLOpcodeClearBuffers,
     GLOpcodeBindVertexArray,
+    GLOpcodeBindVertexBuffers,
     GLOpcodeBindElementArrayBufferToVAO,
     GLOpcodeBindBufferBase,
     GLOpcodeBindBuffersBase,
@@ -45,6 +46,7 @@ enum GLOpcode : std::uint8_t
     GLOpcodeBindComputePipeline,
     GLOpcodeBeginQuery,
     GLOpcodeEndQuery,
+    GLOpcodeResolveQueries,
     GLOpcodeBeginConditionalRender,
     GLOpcodeEndConditionalRender,
     GLOpcodeDrawArrays,
@@ -64,6 +66,11 @@ enum GLOpcode : std::uint8_t
     GLOpcodeBindTexture,
     GLOpcodeBindSampler,
     GLOpcodeUnbindResources,
+    GLOpcodeFlushResourceBindings,
+    GLOpcodeSetStorageBufferWriteMask,
+    GLOpcodeFlushMemoryBarriers,
+    GLOpcodeMultiDrawElementsBatch,
+    GLOpcodeInvoke,
 };
 
 
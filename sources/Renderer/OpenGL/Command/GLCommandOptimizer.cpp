@@ -0,0 +1,525 @@
+/*
+ * GLCommandOptimizer.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLCommandOptimizer.h"
+#include "GLCommandChunkPool.h"
+#include "GLCommandOpcode.h"
+#include "GLCommand.h"
+
+#include "../Texture/GLTexture.h"
+#include "../RenderState/GLGraphicsPipeline.h"
+
+#include <LLGL/CommandBufferFlags.h>
+#include <vector>
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+/*
+ * Internal structures
+ */
+
+// Reference to a single encoded command within the source chunk list.
+struct GLCommandRef
+{
+    GLOpcode            opcode;
+    const std::uint8_t* cmd;    // Pointer to the command structure (after the opcode)
+    std::size_t         size;   // Size of the command structure including its trailing data (without the opcode)
+    bool                alive;
+};
+
+// Helper class to write commands into a new linked list of chunks.
+class GLCommandChunkWriter
+{
+
+    public:
+
+        // Allocates the specified number of bytes; commands never cross chunk boundaries.
+        std::uint8_t* AllocBytes(std::size_t size)
+        {
+            if (lastChunk_ == nullptr || lastChunk_->size + size > lastChunk_->capacity)
+            {
+                auto chunk = GLCommandChunkPool::Instance().AllocChunk(size);
+                if (lastChunk_ != nullptr)
+                    lastChunk_->next = chunk;
+                else
+                    firstChunk_ = chunk;
+                lastChunk_ = chunk;
+            }
+            auto ptr = lastChunk_->Data() + lastChunk_->size;
+            lastChunk_->size += size;
+            return ptr;
+        }
+
+        // Allocates a new command and stores the specified opcode.
+        template <typename T>
+        T* AllocCommand(const GLOpcode opcode, std::size_t extraSize = 0)
+        {
+            auto ptr = AllocBytes(sizeof(opcode) + sizeof(T) + extraSize);
+            *ptr = opcode;
+            return reinterpret_cast<T*>(ptr + sizeof(opcode));
+        }
+
+        // Copies the referenced command without modification.
+        void CopyCommand(const GLCommandRef& ref)
+        {
+            auto ptr = AllocBytes(sizeof(ref.opcode) + ref.size);
+            *ptr = ref.opcode;
+            ::memcpy(ptr + sizeof(ref.opcode), ref.cmd, ref.size);
+        }
+
+        // Returns the first chunk of the written command list.
+        inline GLCommandChunk* GetFirstChunk() const
+        {
+            return firstChunk_;
+        }
+
+    private:
+
+        GLCommandChunk* firstChunk_ = nullptr;
+        GLCommandChunk* lastChunk_  = nullptr;
+
+};
+
+
+/*
+ * Internal functions
+ */
+
+template <typename T>
+const T& GetCmd(const GLCommandRef& ref)
+{
+    return *reinterpret_cast<const T*>(ref.cmd);
+}
+
+static void DecodeGLCommands(const GLCommandChunk* chunk, std::vector<GLCommandRef>& refs)
+{
+    for (; chunk != nullptr; chunk = chunk->next)
+    {
+        auto pc     = chunk->Data();
+        auto pcEnd  = chunk->Data() + chunk->size;
+
+        while (pc < pcEnd)
+        {
+            GLCommandRef ref;
+            {
+                ref.opcode  = *reinterpret_cast<const GLOpcode*>(pc);
+                ref.cmd     = pc + sizeof(GLOpcode);
+                ref.size    = GetGLCommandSize(ref.opcode, ref.cmd);
+                ref.alive   = true;
+            }
+            refs.push_back(ref);
+            pc = ref.cmd + ref.size;
+        }
+    }
+}
+
+/* ----- Viewports and scissors ----- */
+
+static bool IsViewportOrScissorCmd(const GLOpcode opcode)
+{
+    return (opcode >= GLOpcodeViewport && opcode <= GLOpcodeScissorArray);
+}
+
+// Returns true if the range [first, first + count) is a subset of the range [outerFirst, outerFirst + outerCount).
+static bool IsRangeCovered(GLuint first, GLsizei count, GLuint outerFirst, GLsizei outerCount)
+{
+    return (outerFirst <= first && outerFirst + outerCount >= first + count);
+}
+
+/*
+Returns true if command 'ref' is entirely overwritten by command 'next'.
+Note: glViewport, glDepthRange, and glScissor set all viewports and scissors at once.
+*/
+static bool IsViewportOrScissorOverwritten(const GLCommandRef& ref, const GLCommandRef& next)
+{
+    switch (ref.opcode)
+    {
+        case GLOpcodeViewport:
+            return (next.opcode == GLOpcodeViewport);
+
+        case GLOpcodeViewportArray:
+        {
+            if (next.opcode == GLOpcodeViewport)
+                return true;
+            if (next.opcode == GLOpcodeViewportArray)
+            {
+                const auto& cmd     = GetCmd<GLCmdViewportArray>(ref);
+                const auto& cmdNext = GetCmd<GLCmdViewportArray>(next);
+                return IsRangeCovered(cmd.first, cmd.count, cmdNext.first, cmdNext.count);
+            }
+        }
+        break;
+
+        case GLOpcodeScissor:
+            return (next.opcode == GLOpcodeScissor);
+
+        case GLOpcodeScissorArray:
+        {
+            if (next.opcode == GLOpcodeScissor)
+                return true;
+            if (next.opcode == GLOpcodeScissorArray)
+            {
+                const auto& cmd     = GetCmd<GLCmdScissorArray>(ref);
+                const auto& cmdNext = GetCmd<GLCmdScissorArray>(next);
+                return IsRangeCovered(cmd.first, cmd.count, cmdNext.first, cmdNext.count);
+            }
+        }
+        break;
+
+        default:
+        break;
+    }
+    return false;
+}
+
+// Removes viewport and scissor commands that are overwritten within the same run of back-to-back viewport and scissor commands.
+static void FoldViewportsAndScissors(std::vector<GLCommandRef>& refs)
+{
+    for (std::size_t i = 0, n = refs.size(); i < n; ++i)
+    {
+        if (IsViewportOrScissorCmd(refs[i].opcode))
+        {
+            for (auto j = i + 1; j < n && IsViewportOrScissorCmd(refs[j].opcode); ++j)
+            {
+                if (IsViewportOrScissorOverwritten(refs[i], refs[j]))
+                {
+                    refs[i].alive = false;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+/* ----- Bindings ----- */
+
+// Returns true if the specified command only modifies binding or dynamic state, i.e. no other command is affected by its removal until that state is used.
+static bool IsStateCmd(const GLOpcode opcode)
+{
+    switch (opcode)
+    {
+        case GLOpcodeViewport:
+        case GLOpcodeViewportArray:
+        case GLOpcodeScissor:
+        case GLOpcodeScissorArray:
+        case GLOpcodeBindVertexArray:
+        case GLOpcodeBindVertexBuffers:
+        case GLOpcodeBindBufferBase:
+        case GLOpcodeBindBuffersBase:
+        case GLOpcodeBindGraphicsPipeline:
+        case GLOpcodeBindComputePipeline:
+        case GLOpcodeBindTexture:
+        case GLOpcodeBindSampler:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Returns true if the binding of command 'ref' is entirely overwritten by command 'next'.
+static bool IsBindingOverwritten(const GLCommandRef& ref, const GLCommandRef& next)
+{
+    switch (ref.opcode)
+    {
+        case GLOpcodeBindVertexArray:
+            return (next.opcode == GLOpcodeBindVertexArray);
+
+        case GLOpcodeBindVertexBuffers:
+            /* Each command replaces all vertex buffer bindings and the fallback VAO */
+            return (next.opcode == GLOpcodeBindVertexBuffers);
+
+        case GLOpcodeBindBufferBase:
+        {
+            const auto& cmd = GetCmd<GLCmdBindBufferBase>(ref);
+            if (next.opcode == GLOpcodeBindBufferBase)
+            {
+                const auto& cmdNext = GetCmd<GLCmdBindBufferBase>(next);
+                return (cmd.target == cmdNext.target && cmd.index == cmdNext.index);
+            }
+            if (next.opcode == GLOpcodeBindBuffersBase)
+            {
+                const auto& cmdNext = GetCmd<GLCmdBindBuffersBase>(next);
+                return (cmd.target == cmdNext.target && IsRangeCovered(cmd.index, 1, cmdNext.first, cmdNext.count));
+            }
+        }
+        break;
+
+        case GLOpcodeBindBuffersBase:
+        {
+            if (next.opcode == GLOpcodeBindBuffersBase)
+            {
+                const auto& cmd     = GetCmd<GLCmdBindBuffersBase>(ref);
+                const auto& cmdNext = GetCmd<GLCmdBindBuffersBase>(next);
+                return (cmd.target == cmdNext.target && IsRangeCovered(cmd.first, cmd.count, cmdNext.first, cmdNext.count));
+            }
+        }
+        break;
+
+        case GLOpcodeBindGraphicsPipeline:
+        {
+            /* Static viewports and scissors are not reset by other pipelines, so only identical pipelines overwrite them */
+            if (next.opcode == GLOpcodeBindGraphicsPipeline)
+            {
+                const auto& cmd     = GetCmd<GLCmdBindGraphicsPipeline>(ref);
+                const auto& cmdNext = GetCmd<GLCmdBindGraphicsPipeline>(next);
+                return (cmd.graphicsPipeline == cmdNext.graphicsPipeline || !cmd.graphicsPipeline->HasStaticViewportsOrScissors());
+            }
+        }
+        break;
+
+        case GLOpcodeBindComputePipeline:
+            return (next.opcode == GLOpcodeBindComputePipeline || next.opcode == GLOpcodeBindGraphicsPipeline);
+
+        case GLOpcodeBindTexture:
+        {
+            if (next.opcode == GLOpcodeBindTexture)
+            {
+                /* Textures of different types are bound to different targets of the same texture slot */
+                const auto& cmd     = GetCmd<GLCmdBindTexture>(ref);
+                const auto& cmdNext = GetCmd<GLCmdBindTexture>(next);
+                return (cmd.slot == cmdNext.slot && cmd.texture->GetType() == cmdNext.texture->GetType());
+            }
+        }
+        break;
+
+        case GLOpcodeBindSampler:
+        {
+            if (next.opcode == GLOpcodeBindSampler)
+            {
+                const auto& cmd     = GetCmd<GLCmdBindSampler>(ref);
+                const auto& cmdNext = GetCmd<GLCmdBindSampler>(next);
+                return (cmd.slot == cmdNext.slot);
+            }
+        }
+        break;
+
+        default:
+        break;
+    }
+    return false;
+}
+
+// Removes bind commands that are overwritten before any draw, dispatch, or other dependent command.
+static void RemoveOverwrittenBindings(std::vector<GLCommandRef>& refs)
+{
+    for (std::size_t i = 0, n = refs.size(); i < n; ++i)
+    {
+        if (refs[i].alive && IsStateCmd(refs[i].opcode))
+        {
+            for (auto j = i + 1; j < n && IsStateCmd(refs[j].opcode); ++j)
+            {
+                if (IsBindingOverwritten(refs[i], refs[j]))
+                {
+                    refs[i].alive = false;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+/* ----- Merging ----- */
+
+// Returns the number of vertices per primitive for list primitive types, or 0 if draw commands of this mode cannot be merged.
+static GLsizei GetVerticesPerListPrimitive(GLenum mode)
+{
+    switch (mode)
+    {
+        case GL_POINTS:                     return 1;
+        case GL_LINES:                      return 2;
+        case GL_TRIANGLES:                  return 3;
+        case GL_LINES_ADJACENCY:            return 4;
+        case GL_TRIANGLES_ADJACENCY:        return 6;
+        default:                            return 0;
+    }
+}
+
+static GLsizei GetIndexSize(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:  return 1;
+        case GL_UNSIGNED_SHORT: return 2;
+        default:                return 4;
+    }
+}
+
+static bool IsMergeableDrawRange(GLenum mode, GLsizei count)
+{
+    auto verticesPerPrimitive = GetVerticesPerListPrimitive(mode);
+    return (verticesPerPrimitive > 0 && count % verticesPerPrimitive == 0);
+}
+
+static bool CanMergeUpdateBuffer(const GLCmdUpdateBuffer& cmd, const GLCommandRef& next)
+{
+    if (next.opcode == GLOpcodeUpdateBuffer)
+    {
+        const auto& cmdNext = GetCmd<GLCmdUpdateBuffer>(next);
+        return (cmd.buffer == cmdNext.buffer && cmd.offset + cmd.size == cmdNext.offset);
+    }
+    return false;
+}
+
+static bool CanMergeDrawArrays(const GLCmdDrawArrays& cmd, const GLCommandRef& next)
+{
+    if (next.opcode == GLOpcodeDrawArrays)
+    {
+        const auto& cmdNext = GetCmd<GLCmdDrawArrays>(next);
+        return
+        (
+            cmd.mode == cmdNext.mode                &&
+            cmd.first + cmd.count == cmdNext.first  &&
+            IsMergeableDrawRange(cmd.mode, cmd.count)
+        );
+    }
+    return false;
+}
+
+template <typename T>
+bool CanMergeDrawElementsRange(const T& cmd, const T& cmdNext)
+{
+    auto indicesEnd = reinterpret_cast<GLintptr>(cmd.indices) + cmd.count * GetIndexSize(cmd.type);
+    return
+    (
+        cmd.mode == cmdNext.mode                                    &&
+        cmd.type == cmdNext.type                                    &&
+        indicesEnd == reinterpret_cast<GLintptr>(cmdNext.indices)   &&
+        IsMergeableDrawRange(cmd.mode, cmd.count)
+    );
+}
+
+static bool CanMergeDrawElements(const GLCmdDrawElements& cmd, const GLCommandRef& next)
+{
+    if (next.opcode == GLOpcodeDrawElements)
+        return CanMergeDrawElementsRange(cmd, GetCmd<GLCmdDrawElements>(next));
+    return false;
+}
+
+static bool CanMergeDrawElementsBaseVertex(const GLCmdDrawElementsBaseVertex& cmd, const GLCommandRef& next)
+{
+    if (next.opcode == GLOpcodeDrawElementsBaseVertex)
+    {
+        const auto& cmdNext = GetCmd<GLCmdDrawElementsBaseVertex>(next);
+        return (cmd.basevertex == cmdNext.basevertex && CanMergeDrawElementsRange(cmd, cmdNext));
+    }
+    return false;
+}
+
+// Returns the index of the next alive command after 'i', or 'refs.size()' if there is none.
+static std::size_t NextAliveCommand(const std::vector<GLCommandRef>& refs, std::size_t i)
+{
+    for (++i; i < refs.size() && !refs[i].alive; ++i);
+    return i;
+}
+
+// Writes all UpdateBuffer commands that can be merged into a single command, beginning with 'refs[i]', and returns the index of the last merged command.
+static std::size_t WriteMergedUpdateBuffer(GLCommandChunkWriter& writer, const std::vector<GLCommandRef>& refs, std::size_t i)
+{
+    /* Determine range of mergeable commands */
+    auto merged     = GetCmd<GLCmdUpdateBuffer>(refs[i]);
+    auto last       = i;
+
+    for (auto j = NextAliveCommand(refs, i); j < refs.size() && CanMergeUpdateBuffer(merged, refs[j]); j = NextAliveCommand(refs, j))
+    {
+        merged.size += GetCmd<GLCmdUpdateBuffer>(refs[j]).size;
+        last = j;
+    }
+
+    /* Write merged command and concatenate data of all commands */
+    auto cmd = writer.AllocCommand<GLCmdUpdateBuffer>(GLOpcodeUpdateBuffer, static_cast<std::size_t>(merged.size));
+    *cmd = merged;
+
+    auto dst = reinterpret_cast<std::uint8_t*>(cmd + 1);
+    for (auto j = i; j <= last; j = NextAliveCommand(refs, j))
+    {
+        const auto& cmdSrc = GetCmd<GLCmdUpdateBuffer>(refs[j]);
+        ::memcpy(dst, &cmdSrc + 1, static_cast<std::size_t>(cmdSrc.size));
+        dst += cmdSrc.size;
+    }
+
+    return last;
+}
+
+// Writes all draw commands of type <T> that can be merged into a single command, beginning with 'refs[i]', and returns the index of the last merged command.
+template <typename T, typename TMergePredicate>
+std::size_t WriteMergedDraw(GLCommandChunkWriter& writer, const std::vector<GLCommandRef>& refs, std::size_t i, TMergePredicate canMerge)
+{
+    auto merged = GetCmd<T>(refs[i]);
+    auto last   = i;
+
+    for (auto j = NextAliveCommand(refs, i); j < refs.size() && canMerge(merged, refs[j]); j = NextAliveCommand(refs, j))
+    {
+        merged.count += GetCmd<T>(refs[j]).count;
+        last = j;
+    }
+
+    *writer.AllocCommand<T>(refs[i].opcode) = merged;
+
+    return last;
+}
+
+static void WriteOptimizedCommands(GLCommandChunkWriter& writer, const std::vector<GLCommandRef>& refs)
+{
+    for (std::size_t i = 0, n = refs.size(); i < n; i = NextAliveCommand(refs, i))
+    {
+        const auto& ref = refs[i];
+        if (!ref.alive)
+            continue;
+
+        switch (ref.opcode)
+        {
+            case GLOpcodeUpdateBuffer:
+                i = WriteMergedUpdateBuffer(writer, refs, i);
+                break;
+            case GLOpcodeDrawArrays:
+                i = WriteMergedDraw<GLCmdDrawArrays>(writer, refs, i, CanMergeDrawArrays);
+                break;
+            case GLOpcodeDrawElements:
+                i = WriteMergedDraw<GLCmdDrawElements>(writer, refs, i, CanMergeDrawElements);
+                break;
+            case GLOpcodeDrawElementsBaseVertex:
+                i = WriteMergedDraw<GLCmdDrawElementsBaseVertex>(writer, refs, i, CanMergeDrawElementsBaseVertex);
+                break;
+            default:
+                writer.CopyCommand(ref);
+                break;
+        }
+    }
+}
+
+
+/*
+ * Global functions
+ */
+
+GLCommandChunk* OptimizeGLCommandChunks(const GLCommandChunk* firstChunk)
+{
+    /* Decode command stream into list of command references */
+    std::vector<GLCommandRef> refs;
+    DecodeGLCommands(firstChunk, refs);
+
+    /* Remove redundant commands */
+    FoldViewportsAndScissors(refs);
+    RemoveOverwrittenBindings(refs);
+
+    /* Encode remaining commands into new chunk list and merge consecutive commands */
+    GLCommandChunkWriter writer;
+    WriteOptimizedCommands(writer, refs);
+
+    return writer.GetFirstChunk();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,36 @@
+/*
+ * GLCommandOptimizer.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_COMMAND_OPTIMIZER_H
+#define LLGL_GL_COMMAND_OPTIMIZER_H
+
+
+namespace LLGL
+{
+
+
+struct GLCommandChunk;
+
+/*
+Optimizes the encoded GL commands of the specified chunk list and returns a new chunk list from the GLCommandChunkPool.
+The input chunks are not modified. The following optimizations are applied:
+- Consecutive UpdateBuffer commands for contiguous ranges of the same buffer are merged.
+- Back-to-back viewport and scissor commands that are entirely overwritten are removed.
+- Bind commands that are overwritten before any other command depends on them are removed.
+- Consecutive non-indexed and indexed draw commands over contiguous ranges with list primitive types are merged.
+*/
+GLCommandChunk* OptimizeGLCommandChunks(const GLCommandChunk* firstChunk);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
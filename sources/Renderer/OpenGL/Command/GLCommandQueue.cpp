@@ -8,6 +8,7 @@
 #include "GLCommandQueue.h"
 #include "GLDeferredCommandBuffer.h"
 #include "GLCommandExecutor.h"
+#include "GLRenderThread.h"
 #include "../Ext/GLExtensions.h"
 #include "../RenderState/GLFence.h"
 #include "../RenderState/GLQueryHeap.h"
@@ -38,7 +39,10 @@ void GLCommandQueue::Submit(CommandBuffer& commandBuffer)
     if (!cmdBufferGL.IsImmediateCmdBuffer())
     {
         auto& deferredCmdBufferGL = LLGL_CAST(const GLDeferredCommandBuffer&, cmdBufferGL);
-        ExecuteGLDeferredCommandBuffer(deferredCmdBufferGL, *stateMngr_);
+        if (GLRenderThread::IsForwardingRequired())
+            GLRenderThread::Active()->Submit(deferredCmdBufferGL);
+        else
+            ExecuteGLDeferredCommandBuffer(deferredCmdBufferGL, *stateMngr_);
     }
 }
 
@@ -156,6 +160,8 @@ bool GLCommandQueue::QueryResult(
     void*           data,
     std::size_t     dataSize)
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(QueryResult(queryHeap, firstQuery, numQueries, data, dataSize));
+
     auto& queryHeapGL = LLGL_CAST(GLQueryHeap&, queryHeap);
 
     /* Multiply query range by the query group size */
@@ -180,20 +186,32 @@ bool GLCommandQueue::QueryResult(
 
 /* ----- Fences ----- */
 
+static void SubmitGLFence(void* userData)
+{
+    auto fenceGL = reinterpret_cast<GLFence*>(userData);
+    fenceGL->Submit();
+}
+
 void GLCommandQueue::Submit(Fence& fence)
 {
     auto& fenceGL = LLGL_CAST(GLFence&, fence);
-    fenceGL.Submit();
+    if (GLRenderThread::IsForwardingRequired())
+        GLRenderThread::Active()->Post(SubmitGLFence, &fenceGL);
+    else
+        fenceGL.Submit();
 }
 
 bool GLCommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(WaitFence(fence, timeout));
+
     auto& fenceGL = LLGL_CAST(GLFence&, fence);
     return fenceGL.Wait(timeout);
 }
 
 void GLCommandQueue::WaitIdle()
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(WaitIdle());
     glFinish();
 }
 
@@ -0,0 +1,100 @@
+/*
+ * GLCommandRing.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLCommandRing.h"
+#include <algorithm>
+#include <thread>
+
+
+namespace LLGL
+{
+
+
+static std::size_t RoundUpToPowerOfTwo(std::size_t x)
+{
+    std::size_t y = 1;
+    while (y < x)
+        y <<= 1;
+    return y;
+}
+
+GLCommandRing::GLCommandRing(std::size_t capacity) :
+    readPos_  { 0 },
+    writePos_ { 0 }
+{
+    buffer_.resize(RoundUpToPowerOfTwo(capacity));
+    mask_ = buffer_.size() - 1;
+}
+
+/* ----- Producer ----- */
+
+std::uint8_t* GLCommandRing::BeginWrite(std::size_t size)
+{
+    const auto capacity = buffer_.size();
+    const auto writePos = writePos_.load(std::memory_order_relaxed);
+    const auto offset   = (writePos & mask_);
+
+    /* Skip remaining bytes at the end of the ring if the record does not fit */
+    std::size_t skip = 0;
+    if (size > capacity - offset)
+        skip = capacity - offset;
+
+    /* Wait until the consumer has released enough bytes */
+    while (capacity - (writePos - readPos_.load(std::memory_order_acquire)) < skip + size)
+        std::this_thread::yield();
+
+    reservedPos_ = writePos + skip + size;
+
+    if (skip > 0)
+    {
+        buffer_[offset] = g_wrapMarker;
+        return buffer_.data();
+    }
+
+    return &(buffer_[offset]);
+}
+
+void GLCommandRing::EndWrite()
+{
+    writePos_.store(reservedPos_, std::memory_order_release);
+}
+
+/* ----- Consumer ----- */
+
+const std::uint8_t* GLCommandRing::BeginRead(std::size_t& size) const
+{
+    const auto readPos  = readPos_.load(std::memory_order_relaxed);
+    const auto writePos = writePos_.load(std::memory_order_acquire);
+
+    if (readPos == writePos)
+        return nullptr;
+
+    /* Return contiguous range until the write position or the end of the ring */
+    const auto offset = (readPos & mask_);
+    size = std::min(writePos - readPos, buffer_.size() - offset);
+
+    return &(buffer_[offset]);
+}
+
+void GLCommandRing::EndRead(std::size_t size)
+{
+    readPos_.store(readPos_.load(std::memory_order_relaxed) + size, std::memory_order_release);
+}
+
+/* ----- Common ----- */
+
+bool GLCommandRing::IsEmpty() const
+{
+    return (readPos_.load(std::memory_order_acquire) == writePos_.load(std::memory_order_acquire));
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
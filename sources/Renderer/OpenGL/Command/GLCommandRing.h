@@ -0,0 +1,91 @@
+/*
+ * GLCommandRing.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_COMMAND_RING_H
+#define LLGL_GL_COMMAND_RING_H
+
+
+#include <atomic>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+/*
+Lock-free single-producer/single-consumer ring buffer for encoded GL commands.
+Each record that is written to the ring is stored contiguously. If a record does not fit into the remaining bytes
+at the end of the ring, a wrap marker is written and the record starts at the beginning of the ring instead.
+*/
+class GLCommandRing
+{
+
+    public:
+
+        // Byte value that marks the remaining bytes until the end of the ring as unused (all GL opcodes are greater than zero).
+        static const std::uint8_t g_wrapMarker = 0;
+
+        GLCommandRing(const GLCommandRing&) = delete;
+        GLCommandRing& operator = (const GLCommandRing&) = delete;
+
+        // Initializes the ring with the specified capacity, which is rounded up to the next power of two.
+        GLCommandRing(std::size_t capacity);
+
+        /* ----- Producer ----- */
+
+        /*
+        Reserves the specified number of contiguous bytes and returns a pointer to them.
+        Blocks until enough bytes have been released by the consumer. The reserved bytes are not visible to the consumer until 'EndWrite' is called.
+        */
+        std::uint8_t* BeginWrite(std::size_t size);
+
+        // Publishes the bytes that have been reserved with the previous call to 'BeginWrite'.
+        void EndWrite();
+
+        /* ----- Consumer ----- */
+
+        // Returns a pointer to the next contiguous range of readable bytes and stores its size in 'size', or returns null if the ring is empty.
+        const std::uint8_t* BeginRead(std::size_t& size) const;
+
+        // Releases the specified number of bytes from the front of the ring.
+        void EndRead(std::size_t size);
+
+        /* ----- Common ----- */
+
+        // Returns true if the consumer has read all published bytes.
+        bool IsEmpty() const;
+
+        // Returns the maximal size of a single record.
+        inline std::size_t GetMaxRecordSize() const
+        {
+            return (buffer_.size() / 2);
+        }
+
+    private:
+
+        std::vector<std::uint8_t>   buffer_;
+        std::size_t                 mask_           = 0;
+
+        // Positions are never wrapped, only the offsets into the buffer are (i.e. position & mask).
+        std::atomic<std::size_t>    readPos_;
+        std::atomic<std::size_t>    writePos_;
+        std::size_t                 reservedPos_    = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
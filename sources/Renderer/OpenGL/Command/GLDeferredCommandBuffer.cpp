@@ -7,6 +7,7 @@
 
 #include "GLDeferredCommandBuffer.h"
 #include "GLCommand.h"
+#include "GLCommandOptimizer.h"
 
 #include "../GLRenderContext.h"
 #include "../../GLCommon/GLTypes.h"
@@ -45,10 +46,14 @@ namespace LLGL
 {
 
 
-GLDeferredCommandBuffer::GLDeferredCommandBuffer(long flags, std::size_t reservedSize) :
+GLDeferredCommandBuffer::GLDeferredCommandBuffer(long flags) :
     flags_ { flags }
 {
-    buffer_.reserve(reservedSize);
+}
+
+GLDeferredCommandBuffer::~GLDeferredCommandBuffer()
+{
+    GLCommandChunkPool::Instance().FreeChunks(firstChunk_);
 }
 
 bool GLDeferredCommandBuffer::IsImmediateCmdBuffer() const
@@ -60,8 +65,21 @@ bool GLDeferredCommandBuffer::IsImmediateCmdBuffer() const
 
 void GLDeferredCommandBuffer::Begin()
 {
-    /* Reset internal command buffer */
-    buffer_.clear();
+    /* Invalidate pre-decoded commands, since they refer to the chunks that are about to be re-encoded */
+    decodedCommands_.clear();
+    drawBatch_.Clear();
+
+    /* Resource bindings of a previous command buffer may still be deferred */
+    bindingsChanged_ = true;
+
+    /* Reset internal command buffer, but keep the first chunk for the next recording */
+    if (firstChunk_ != nullptr)
+    {
+        GLCommandChunkPool::Instance().FreeChunks(firstChunk_->next);
+        firstChunk_->next = nullptr;
+        firstChunk_->size = 0;
+        lastChunk_ = firstChunk_;
+    }
     
     #ifdef LLGL_ENABLE_JIT_COMPILER
     
@@ -75,13 +93,28 @@ void GLDeferredCommandBuffer::Begin()
 
 void GLDeferredCommandBuffer::End()
 {
-    #ifdef LLGL_ENABLE_JIT_COMPILER
-    
-    /* Generate native assembly only if command buffer will be submitted multiple times */
+    /* Encode remaining batched draw commands */
+    if (!drawBatch_.Empty())
+        FlushDrawBatch();
+
+    /* Optimize command stream only if requested, since it will be re-encoded entirely */
+    if ((GetFlags() & CommandBufferFlags::OptimizeCommands) != 0)
+        OptimizeCommands();
+
     if ((GetFlags() & CommandBufferFlags::MultiSubmit) != 0)
+    {
+        #ifdef LLGL_ENABLE_JIT_COMPILER
+
+        /* Generate native assembly only if command buffer will be submitted multiple times */
         executable_ = AssembleGLDeferredCommandBuffer(*this);
-    
-    #endif // /LLGL_ENABLE_JIT_COMPILER
+        if (executable_)
+            return;
+
+        #endif // /LLGL_ENABLE_JIT_COMPILER
+
+        /* Pre-decode command handlers if command buffer will be submitted multiple times and no native assembly is available */
+        DecodeGLDeferredCommandBuffer(*this, decodedCommands_);
+    }
 }
 
 void GLDeferredCommandBuffer::UpdateBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, const void* data, std::uint16_t dataSize)
@@ -121,6 +154,7 @@ void GLDeferredCommandBuffer::Execute(CommandBuffer& deferredCommandBuffer)
                 /* Encode GL command */
                 auto cmd = AllocCommand<GLCmdExecute>(GLOpcodeExecute);
                 cmd->commandBuffer = &deferredCmdBufferGL;
+                bindingsChanged_ = true;
             }
         }
     }
@@ -134,6 +168,8 @@ void GLDeferredCommandBuffer::SetGraphicsAPIDependentState(const void* stateDesc
     {
         auto cmd = AllocCommand<GLCmdSetAPIDepState>(GLOpcodeSetAPIDepState);
         cmd->desc = *reinterpret_cast<const OpenGLDependentStateDescriptor*>(stateDesc);
+        batchIndexedDraws_ = cmd->desc.batchIndexedDraws;
+        memoryBarriers_ = (cmd->desc.automaticMemoryBarriers || cmd->desc.reportMemoryBarriers);
     }
 }
 
@@ -282,8 +318,19 @@ void GLDeferredCommandBuffer::SetVertexBuffer(Buffer& buffer)
 {
     if ((buffer.GetBindFlags() & BindFlags::VertexBuffer) != 0)
     {
-        auto cmd = AllocCommand<GLCmdBindVertexArray>(GLOpcodeBindVertexArray);
-        cmd->vao = LLGL_CAST(const GLBufferWithVAO&, buffer).GetVaoID();
+        auto& vertexBufferGL = LLGL_CAST(const GLBufferWithVAO&, buffer);
+        if (GLVertexArrayObject::IsVertexAttribBindingSupported())
+        {
+            const GLuint    id      = vertexBufferGL.GetID();
+            const GLintptr  offset  = 0;
+            const GLsizei   stride  = static_cast<GLsizei>(vertexBufferGL.GetVertexFormat().stride);
+            BindVertexBuffers(vertexBufferGL.GetVaoID(), 1, &id, &offset, &stride);
+        }
+        else
+        {
+            auto cmd = AllocCommand<GLCmdBindVertexArray>(GLOpcodeBindVertexArray);
+            cmd->vao = vertexBufferGL.GetVaoID();
+        }
     }
 }
 
@@ -291,8 +338,22 @@ void GLDeferredCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
 {
     if ((bufferArray.GetBindFlags() & BindFlags::VertexBuffer) != 0)
     {
-        auto cmd = AllocCommand<GLCmdBindVertexArray>(GLOpcodeBindVertexArray);
-        cmd->vao = LLGL_CAST(const GLBufferArrayWithVAO&, bufferArray).GetVaoID();
+        auto& vertexBufferArrayGL = LLGL_CAST(const GLBufferArrayWithVAO&, bufferArray);
+        if (GLVertexArrayObject::IsVertexAttribBindingSupported())
+        {
+            BindVertexBuffers(
+                vertexBufferArrayGL.GetVaoID(),
+                static_cast<GLsizei>(vertexBufferArrayGL.GetIDArray().size()),
+                vertexBufferArrayGL.GetIDArray().data(),
+                vertexBufferArrayGL.GetOffsetArray().data(),
+                vertexBufferArrayGL.GetStrideArray().data()
+            );
+        }
+        else
+        {
+            auto cmd = AllocCommand<GLCmdBindVertexArray>(GLOpcodeBindVertexArray);
+            cmd->vao = vertexBufferArrayGL.GetVaoID();
+        }
     }
 }
 
@@ -439,6 +500,19 @@ void GLDeferredCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t query
     }
 }
 
+void GLDeferredCommandBuffer::ResolveQueries(QueryHeap& queryHeap, std::uint32_t firstQuery, std::uint32_t numQueries, Buffer& dstBuffer, std::uint64_t dstOffset)
+{
+    auto& dstBufferGL = LLGL_CAST(GLBuffer&, dstBuffer);
+    auto cmd = AllocCommand<GLCmdResolveQueries>(GLOpcodeResolveQueries);
+    {
+        cmd->queryHeap  = LLGL_CAST(GLQueryHeap*, &queryHeap);
+        cmd->firstQuery = firstQuery;
+        cmd->numQueries = numQueries;
+        cmd->buffer     = dstBufferGL.GetID();
+        cmd->offset     = static_cast<GLintptr>(dstOffset);
+    }
+}
+
 void GLDeferredCommandBuffer::BeginRenderCondition(QueryHeap& queryHeap, std::uint32_t query, const RenderConditionMode mode)
 {
     auto cmd = AllocCommand<GLCmdBeginConditionalRender>(GLOpcodeBeginConditionalRender);
@@ -463,6 +537,9 @@ The indices actually store the index start offset, but must be passed to GL as a
 
 void GLDeferredCommandBuffer::Draw(std::uint32_t numVertices, std::uint32_t firstVertex)
 {
+    FlushResourceBindings();
+    FlushMemoryBarriers(true);
+
     auto cmd = AllocCommand<GLCmdDrawArrays>(GLOpcodeDrawArrays);
     {
         cmd->mode   = renderState_.drawMode;
@@ -473,7 +550,14 @@ void GLDeferredCommandBuffer::Draw(std::uint32_t numVertices, std::uint32_t firs
 
 void GLDeferredCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex)
 {
+    FlushResourceBindings();
+    if (drawBatch_.Empty())
+        FlushMemoryBarriers(true);
+
     const GLintptr indices = (renderState_.indexBufferOffset + firstIndex * renderState_.indexBufferStride);
+    if (batchIndexedDraws_ && BatchDrawElements(indices, numIndices))
+        return;
+
     auto cmd = AllocCommand<GLCmdDrawElements>(GLOpcodeDrawElements);
     {
         cmd->mode       = renderState_.drawMode;
@@ -485,7 +569,14 @@ void GLDeferredCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_
 
 void GLDeferredCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex, std::int32_t vertexOffset)
 {
+    FlushResourceBindings();
+    if (drawBatch_.Empty())
+        FlushMemoryBarriers(true);
+
     const GLintptr indices = (renderState_.indexBufferOffset + firstIndex * renderState_.indexBufferStride);
+    if (batchIndexedDraws_ && BatchDrawElements(indices, numIndices, 1, vertexOffset))
+        return;
+
     auto cmd = AllocCommand<GLCmdDrawElementsBaseVertex>(GLOpcodeDrawElementsBaseVertex);
     {
         cmd->mode       = renderState_.drawMode;
@@ -498,6 +589,9 @@ void GLDeferredCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_
 
 void GLDeferredCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances)
 {
+    FlushResourceBindings();
+    FlushMemoryBarriers(true);
+
     auto cmd = AllocCommand<GLCmdDrawArraysInstanced>(GLOpcodeDrawArraysInstanced);
     {
         cmd->mode           = renderState_.drawMode;
@@ -509,6 +603,9 @@ void GLDeferredCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint
 
 void GLDeferredCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances, std::uint32_t firstInstance)
 {
+    FlushResourceBindings();
+    FlushMemoryBarriers(true);
+
     #ifndef __APPLE__
     auto cmd = AllocCommand<GLCmdDrawArraysInstancedBaseInstance>(GLOpcodeDrawArraysInstancedBaseInstance);
     {
@@ -525,7 +622,14 @@ void GLDeferredCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint
 
 void GLDeferredCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex)
 {
+    FlushResourceBindings();
+    if (drawBatch_.Empty())
+        FlushMemoryBarriers(true);
+
     const GLintptr indices = (renderState_.indexBufferOffset + firstIndex * renderState_.indexBufferStride);
+    if (batchIndexedDraws_ && BatchDrawElements(indices, numIndices, numInstances))
+        return;
+
     auto cmd = AllocCommand<GLCmdDrawElementsInstanced>(GLOpcodeDrawElementsInstanced);
     {
         cmd->mode           = renderState_.drawMode;
@@ -538,7 +642,14 @@ void GLDeferredCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std
 
 void GLDeferredCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset)
 {
+    FlushResourceBindings();
+    if (drawBatch_.Empty())
+        FlushMemoryBarriers(true);
+
     const GLintptr indices = (renderState_.indexBufferOffset + firstIndex * renderState_.indexBufferStride);
+    if (batchIndexedDraws_ && BatchDrawElements(indices, numIndices, numInstances, vertexOffset))
+        return;
+
     auto cmd = AllocCommand<GLCmdDrawElementsInstancedBaseVertex>(GLOpcodeDrawElementsInstancedBaseVertex);
     {
         cmd->mode           = renderState_.drawMode;
@@ -552,8 +663,15 @@ void GLDeferredCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std
 
 void GLDeferredCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset, std::uint32_t firstInstance)
 {
+    FlushResourceBindings();
+    if (drawBatch_.Empty())
+        FlushMemoryBarriers(true);
+
     #ifndef __APPLE__
     const GLintptr indices = (renderState_.indexBufferOffset + firstIndex * renderState_.indexBufferStride);
+    if (batchIndexedDraws_ && BatchDrawElements(indices, numIndices, numInstances, vertexOffset, firstInstance))
+        return;
+
     auto cmd = AllocCommand<GLCmdDrawElementsInstancedBaseVertexBaseInstance>(GLOpcodeDrawElementsInstancedBaseVertexBaseInstance);
     {
         cmd->mode           = renderState_.drawMode;
@@ -571,6 +689,9 @@ void GLDeferredCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std
 
 void GLDeferredCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
 {
+    FlushResourceBindings();
+    FlushMemoryBarriers(true, LLGL_CAST(GLBuffer&, buffer).GetID());
+
     auto cmd = AllocCommand<GLCmdDrawArraysIndirect>(GLOpcodeDrawArraysIndirect);
     {
         cmd->id             = LLGL_CAST(GLBuffer&, buffer).GetID();
@@ -583,6 +704,9 @@ void GLDeferredCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
 
 void GLDeferredCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
 {
+    FlushResourceBindings();
+    FlushMemoryBarriers(true, LLGL_CAST(GLBuffer&, buffer).GetID());
+
     #ifndef __APPLE__
     if (HasExtension(GLExt::ARB_multi_draw_indirect))
     {
@@ -612,6 +736,9 @@ void GLDeferredCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset,
 
 void GLDeferredCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
 {
+    FlushResourceBindings();
+    FlushMemoryBarriers(true, LLGL_CAST(GLBuffer&, buffer).GetID());
+
     auto cmd = AllocCommand<GLCmdDrawElementsIndirect>(GLOpcodeDrawElementsIndirect);
     {
         cmd->id             = LLGL_CAST(GLBuffer&, buffer).GetID();
@@ -625,6 +752,9 @@ void GLDeferredCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t
 
 void GLDeferredCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
 {
+    FlushResourceBindings();
+    FlushMemoryBarriers(true, LLGL_CAST(GLBuffer&, buffer).GetID());
+
     #ifndef __APPLE__
     if (HasExtension(GLExt::ARB_multi_draw_indirect))
     {
@@ -658,6 +788,9 @@ void GLDeferredCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t
 
 void GLDeferredCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
 {
+    FlushResourceBindings();
+    FlushMemoryBarriers(false);
+
     #ifndef __APPLE__
     auto cmd = AllocCommand<GLCmdDispatchCompute>(GLOpcodeDispatchCompute);
     {
@@ -672,6 +805,9 @@ void GLDeferredCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32
 
 void GLDeferredCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
 {
+    FlushResourceBindings();
+    FlushMemoryBarriers(false, LLGL_CAST(const GLBuffer&, buffer).GetID());
+
     #ifndef __APPLE__
     auto cmd = AllocCommand<GLCmdDispatchComputeIndirect>(GLOpcodeDispatchComputeIndirect);
     {
@@ -705,11 +841,13 @@ void GLDeferredCommandBuffer::SetConstantBuffer(Buffer& buffer, std::uint32_t sl
 void GLDeferredCommandBuffer::SetSampleBuffer(Buffer& buffer, std::uint32_t slot, long /*stageFlags*/)
 {
     SetGenericBuffer(GLBufferTarget::SHADER_STORAGE_BUFFER, buffer, slot);
+    SetStorageBufferAccess(slot, false);
 }
 
 void GLDeferredCommandBuffer::SetRWStorageBuffer(Buffer& buffer, std::uint32_t slot, long /*stageFlags*/)
 {
     SetGenericBuffer(GLBufferTarget::SHADER_STORAGE_BUFFER, buffer, slot);
+    SetStorageBufferAccess(slot, true);
 }
 
 void GLDeferredCommandBuffer::SetTexture(Texture& texture, std::uint32_t slot, long /*stageFlags*/)
@@ -719,6 +857,7 @@ void GLDeferredCommandBuffer::SetTexture(Texture& texture, std::uint32_t slot, l
         cmd->slot       = slot;
         cmd->texture    = LLGL_CAST(const GLTexture*, &texture);
     }
+    bindingsChanged_ = true;
 }
 
 void GLDeferredCommandBuffer::SetSampler(Sampler& sampler, std::uint32_t slot, long /*stageFlags*/)
@@ -729,6 +868,7 @@ void GLDeferredCommandBuffer::SetSampler(Sampler& sampler, std::uint32_t slot, l
         cmd->slot       = slot;
         cmd->sampler    = samplerGL.GetID();
     }
+    bindingsChanged_ = true;
 }
 
 void GLDeferredCommandBuffer::ResetResourceSlots(
@@ -779,7 +919,10 @@ void GLDeferredCommandBuffer::ResetResourceSlots(
         }
 
         if (cmd.resetFlags != 0)
+        {
             *AllocCommand<GLCmdUnbindResources>(GLOpcodeUnbindResources) = cmd;
+            bindingsChanged_ = true;
+        }
     }
 }
 
@@ -804,6 +947,7 @@ void GLDeferredCommandBuffer::SetGenericBuffer(const GLBufferTarget bufferTarget
         cmd->index  = slot;
         cmd->id     = bufferGL.GetID();
     }
+    bindingsChanged_ = true;
 }
 
 void GLDeferredCommandBuffer::SetGenericBufferArray(const GLBufferTarget bufferTarget, BufferArray& bufferArray, std::uint32_t startSlot)
@@ -817,29 +961,157 @@ void GLDeferredCommandBuffer::SetGenericBufferArray(const GLBufferTarget bufferT
         cmd->count  = static_cast<GLsizei>(count);
         ::memcpy(cmd + 1, bufferArrayGL.GetIDArray().data(), sizeof(GLuint)*count);
     }
+    bindingsChanged_ = true;
+}
+
+void GLDeferredCommandBuffer::BindVertexBuffers(GLuint vao, GLsizei count, const GLuint* buffers, const GLintptr* offsets, const GLsizei* strides)
+{
+    const auto n = static_cast<std::size_t>(count);
+    auto cmd = AllocCommand<GLCmdBindVertexBuffers>(GLOpcodeBindVertexBuffers, (sizeof(GLintptr) + sizeof(GLuint) + sizeof(GLsizei))*n);
+    {
+        cmd->vao    = vao;
+        cmd->count  = count;
+
+        auto dst = reinterpret_cast<char*>(cmd + 1);
+        ::memcpy(dst, offsets, sizeof(GLintptr)*n);
+        dst += sizeof(GLintptr)*n;
+        ::memcpy(dst, buffers, sizeof(GLuint)*n);
+        dst += sizeof(GLuint)*n;
+        ::memcpy(dst, strides, sizeof(GLsizei)*n);
+    }
 }
 
 void GLDeferredCommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap)
 {
     auto cmd = AllocCommand<GLCmdBindResourceHeap>(GLOpcodeBindResourceHeap);
     cmd->resourceHeap = LLGL_CAST(GLResourceHeap*, &resourceHeap);
+    bindingsChanged_ = true;
+}
+
+std::uint8_t* GLDeferredCommandBuffer::AllocBytes(std::size_t size)
+{
+    /* Append new chunk if the current one cannot hold the entire command (commands never cross chunk boundaries) */
+    if (lastChunk_ == nullptr || lastChunk_->size + size > lastChunk_->capacity)
+    {
+        auto chunk = GLCommandChunkPool::Instance().AllocChunk(size);
+        if (lastChunk_ != nullptr)
+            lastChunk_->next = chunk;
+        else
+            firstChunk_ = chunk;
+        lastChunk_ = chunk;
+    }
+
+    /* Take bytes from the end of the current chunk */
+    auto ptr = lastChunk_->Data() + lastChunk_->size;
+    lastChunk_->size += size;
+    return ptr;
+}
+
+bool GLDeferredCommandBuffer::BatchDrawElements(GLintptr indices, std::uint32_t numIndices, std::uint32_t numInstances, std::int32_t vertexOffset, std::uint32_t firstInstance)
+{
+    const auto mode             = renderState_.drawMode;
+    const auto type             = renderState_.indexBufferDataType;
+    const auto count            = static_cast<GLsizei>(numIndices);
+    const auto instanceCount    = static_cast<GLsizei>(numInstances);
+
+    if (!drawBatch_.Append(mode, type, indices, count, instanceCount, vertexOffset, firstInstance))
+    {
+        /* Start new batch if the command is incompatible with the current one */
+        if (drawBatch_.Empty())
+            return false;
+        FlushDrawBatch();
+        return drawBatch_.Append(mode, type, indices, count, instanceCount, vertexOffset, firstInstance);
+    }
+
+    return true;
+}
+
+void GLDeferredCommandBuffer::FlushDrawBatch()
+{
+    const auto& commands = drawBatch_.GetCommands();
+    const auto commandsSize = sizeof(GLDrawElementsIndirectCommand)*commands.size();
+
+    /* Encode batch as a single command with all indirect arguments as trailing data (bypasses AllocCommand to avoid recursion) */
+    auto ptr = AllocBytes(sizeof(GLOpcode) + sizeof(GLCmdMultiDrawElementsBatch) + commandsSize);
+    *ptr = GLOpcodeMultiDrawElementsBatch;
+
+    auto cmd = reinterpret_cast<GLCmdMultiDrawElementsBatch*>(ptr + sizeof(GLOpcode));
+    {
+        cmd->mode       = drawBatch_.GetMode();
+        cmd->type       = drawBatch_.GetType();
+        cmd->drawcount  = static_cast<GLsizei>(commands.size());
+        ::memcpy(cmd + 1, commands.data(), commandsSize);
+    }
+
+    drawBatch_.Clear();
+}
+
+void GLDeferredCommandBuffer::FlushResourceBindings()
+{
+    if (bindingsChanged_)
+    {
+        AllocOpCode(GLOpcodeFlushResourceBindings);
+        bindingsChanged_ = false;
+    }
+}
+
+void GLDeferredCommandBuffer::FlushMemoryBarriers(bool drawCommand, GLuint indirectBuffer)
+{
+    if (memoryBarriers_)
+    {
+        auto cmd = AllocCommand<GLCmdFlushMemoryBarriers>(GLOpcodeFlushMemoryBarriers);
+        {
+            cmd->drawCommand    = drawCommand;
+            cmd->indirectBuffer = indirectBuffer;
+        }
+    }
+}
+
+void GLDeferredCommandBuffer::SetStorageBufferAccess(std::uint32_t slot, bool writable)
+{
+    if (memoryBarriers_ && slot < GLStateManager::g_maxNumResourceSlots)
+    {
+        const auto slotMask = (std::uint64_t(1) << slot);
+        auto cmd = AllocCommand<GLCmdSetStorageBufferWriteMask>(GLOpcodeSetStorageBufferWriteMask);
+        {
+            cmd->slotMask   = slotMask;
+            cmd->writeMask  = (writable ? slotMask : 0);
+        }
+    }
+}
+
+void GLDeferredCommandBuffer::OptimizeCommands()
+{
+    if (firstChunk_ != nullptr)
+    {
+        /* Replace chunk list by optimized command stream */
+        auto optimizedChunk = OptimizeGLCommandChunks(firstChunk_);
+        GLCommandChunkPool::Instance().FreeChunks(firstChunk_);
+        firstChunk_ = optimizedChunk;
+
+        /* Find new last chunk */
+        for (lastChunk_ = firstChunk_; lastChunk_ != nullptr && lastChunk_->next != nullptr; lastChunk_ = lastChunk_->next);
+    }
 }
 
 void GLDeferredCommandBuffer::AllocOpCode(const GLOpcode opcode)
 {
-    buffer_.push_back(opcode);
+    if (!drawBatch_.Empty())
+        FlushDrawBatch();
+    *AllocBytes(sizeof(opcode)) = opcode;
 }
 
 template <typename T>
 T* GLDeferredCommandBuffer::AllocCommand(const GLOpcode opcode, std::size_t extraSize)
 {
-    /* Resize internal buffer for opcode, command structure, and extra size */
-    auto offset = buffer_.size();
-    {
-        buffer_.resize(offset + sizeof(opcode) + sizeof(T) + extraSize);
-        buffer_[offset] = opcode;
-    }
-    return reinterpret_cast<T*>(&(buffer_[offset + sizeof(opcode)]));
+    /* Encode pending batched draw commands first to preserve the command order */
+    if (!drawBatch_.Empty())
+        FlushDrawBatch();
+
+    /* Allocate bytes for opcode, command structure, and extra size */
+    auto ptr = AllocBytes(sizeof(opcode) + sizeof(T) + extraSize);
+    *ptr = opcode;
+    return reinterpret_cast<T*>(ptr + sizeof(opcode));
 }
 
 
@@ -11,6 +11,9 @@
 
 #include "GLCommandBuffer.h"
 #include "GLCommandOpcode.h"
+#include "GLCommandChunkPool.h"
+#include "GLCommandExecutor.h"
+#include "GLDrawBatch.h"
 #include "../RenderState/GLState.h"
 #include "../OpenGL.h"
 #include <memory>
@@ -35,7 +38,11 @@ class GLDeferredCommandBuffer final : public GLCommandBuffer
 
     public:
 
-        GLDeferredCommandBuffer(long flags, std::size_t reservedSize = 0);
+        GLDeferredCommandBuffer(const GLDeferredCommandBuffer&) = delete;
+        GLDeferredCommandBuffer& operator = (const GLDeferredCommandBuffer&) = delete;
+
+        GLDeferredCommandBuffer(long flags);
+        ~GLDeferredCommandBuffer();
 
         bool IsImmediateCmdBuffer() const override;
 
@@ -112,6 +119,8 @@ class GLDeferredCommandBuffer final : public GLCommandBuffer
         void BeginQuery(QueryHeap& queryHeap, std::uint32_t query = 0) override;
         void EndQuery(QueryHeap& queryHeap, std::uint32_t query = 0) override;
 
+        void ResolveQueries(QueryHeap& queryHeap, std::uint32_t firstQuery, std::uint32_t numQueries, Buffer& dstBuffer, std::uint64_t dstOffset) override;
+
         void BeginRenderCondition(QueryHeap& queryHeap, std::uint32_t query = 0, const RenderConditionMode mode = RenderConditionMode::Wait) override;
         void EndRenderCondition() override;
 
@@ -168,12 +177,18 @@ class GLDeferredCommandBuffer final : public GLCommandBuffer
         // Returns true if this is a primary command buffer.
         bool IsPrimary() const;
 
-        // Returns the internal command buffer as raw byte buffer.
-        inline const std::vector<std::uint8_t>& GetRawBuffer() const
+        // Returns the first chunk of the internal command buffer, or null if no commands have been recorded yet.
+        inline const GLCommandChunk* GetFirstChunk() const
         {
-            return buffer_;
+            return firstChunk_;
         }
     
+        // Returns the list of pre-decoded commands, or an empty list if this command buffer is not pre-decoded.
+        inline const std::vector<GLDecodedCommand>& GetDecodedCommands() const
+        {
+            return decodedCommands_;
+        }
+
         // Returns the flags this command buffer was created with (see CommandBufferDescriptor::flags).
         inline long GetFlags() const
         {
@@ -208,6 +223,36 @@ class GLDeferredCommandBuffer final : public GLCommandBuffer
         void SetGenericBufferArray(const GLBufferTarget bufferTarget, BufferArray& bufferArray, std::uint32_t startSlot);
         void SetResourceHeap(ResourceHeap& resourceHeap);
 
+        /* Encodes the vertex buffer bindings for the vertex format of the current pipeline, and the VAO that is bound if there is no vertex format */
+        void BindVertexBuffers(GLuint vao, GLsizei count, const GLuint* buffers, const GLintptr* offsets, const GLsizei* strides);
+
+        /* Appends an indexed draw command to the current draw batch, or returns false if the command cannot be batched */
+        bool BatchDrawElements(
+            GLintptr        indices,
+            std::uint32_t   numIndices,
+            std::uint32_t   numInstances    = 1,
+            std::int32_t    vertexOffset    = 0,
+            std::uint32_t   firstInstance   = 0
+        );
+
+        /* Encodes the current draw batch as a single command and clears the batch */
+        void FlushDrawBatch();
+
+        /* Encodes a command to apply deferred resource bindings if any resource has been bound since the last draw or dispatch command */
+        void FlushResourceBindings();
+
+        /* Encodes a command to insert memory barriers for the next draw or dispatch command if automatic memory barriers are enabled */
+        void FlushMemoryBarriers(bool drawCommand, GLuint indirectBuffer = 0);
+
+        /* Encodes a command to specify whether the shader storage buffer slot is bound with write access if automatic memory barriers are enabled */
+        void SetStorageBufferAccess(std::uint32_t slot, bool writable);
+
+        /* Replaces the recorded command stream by an optimized version of it */
+        void OptimizeCommands();
+
+        /* Allocates the specified number of bytes in the current chunk, or appends a new chunk if the current one is exhausted */
+        std::uint8_t* AllocBytes(std::size_t size);
+
         /* Allocates only an opcode for empty commands */
         void AllocOpCode(const GLOpcode opcode);
 
@@ -217,16 +262,23 @@ class GLDeferredCommandBuffer final : public GLCommandBuffer
 
     private:
 
-        GLRenderState               renderState_;
-        GLClearValue                clearValue_;
+        GLRenderState                   renderState_;
+        GLClearValue                    clearValue_;
+
+        long                            flags_              = 0;
+        GLCommandChunk*                 firstChunk_         = nullptr;
+        GLCommandChunk*                 lastChunk_          = nullptr;
+        std::vector<GLDecodedCommand>   decodedCommands_;
 
-        long                        flags_              = 0;
-        std::vector<std::uint8_t>   buffer_;
+        GLDrawElementsBatch             drawBatch_;
+        bool                            batchIndexedDraws_  = false;
+        bool                            bindingsChanged_    = true;
+        bool                            memoryBarriers_     = false;
     
         #ifdef LLGL_ENABLE_JIT_COMPILER
-        std::unique_ptr<JITProgram> executable_;
-        std::uint32_t               maxNumViewports_    = 0;
-        std::uint32_t               maxNumScissors_     = 0;
+        std::unique_ptr<JITProgram>     executable_;
+        std::uint32_t                   maxNumViewports_    = 0;
+        std::uint32_t                   maxNumScissors_     = 0;
         #endif // /LLGL_ENABLE_JIT_COMPILER
 
 };
@@ -0,0 +1,200 @@
+/*
+ * GLDrawBatch.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLDrawBatch.h"
+#include "../Ext/GLExtensions.h"
+#include "../Ext/GLExtensionLoader.h"
+#include "../RenderState/GLStateManager.h"
+#include "../../GLCommon/GLCore.h"
+
+
+namespace LLGL
+{
+
+
+static GLintptr GetIndexSize(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:  return 1;
+        case GL_UNSIGNED_SHORT: return 2;
+        default:                return 4;
+    }
+}
+
+bool GLDrawElementsBatch::Append(
+    GLenum      mode,
+    GLenum      type,
+    GLintptr    indices,
+    GLsizei     count,
+    GLsizei     instanceCount,
+    GLint       baseVertex,
+    GLuint      baseInstance)
+{
+    /* Indirect commands specify the first index rather than a byte offset */
+    const auto indexSize = GetIndexSize(type);
+    if (indices % indexSize != 0)
+        return false;
+
+    if (commands_.empty())
+    {
+        mode_ = mode;
+        type_ = type;
+    }
+    else if (mode_ != mode || type_ != type)
+        return false;
+
+    GLDrawElementsIndirectCommand cmd;
+    {
+        cmd.count           = static_cast<GLuint>(count);
+        cmd.instanceCount   = static_cast<GLuint>(instanceCount);
+        cmd.firstIndex      = static_cast<GLuint>(indices / indexSize);
+        cmd.baseVertex      = baseVertex;
+        cmd.baseInstance    = baseInstance;
+    }
+    commands_.push_back(cmd);
+
+    return true;
+}
+
+void GLDrawElementsBatch::Submit(GLStateManager& stateMngr)
+{
+    if (!commands_.empty())
+    {
+        GLMultiDrawElementsBatch(stateMngr, mode_, type_, static_cast<GLsizei>(commands_.size()), commands_.data());
+        Clear();
+    }
+}
+
+void GLDrawElementsBatch::Clear()
+{
+    commands_.clear();
+}
+
+
+/*
+ * Global functions
+ */
+
+static void DrawElementsIndirectCommand(GLenum mode, GLenum type, const GLDrawElementsIndirectCommand& cmd)
+{
+    const GLintptr indices = static_cast<GLintptr>(cmd.firstIndex) * GetIndexSize(type);
+
+    if (cmd.baseInstance != 0)
+    {
+        #ifndef __APPLE__
+        glDrawElementsInstancedBaseVertexBaseInstance(
+            mode,
+            static_cast<GLsizei>(cmd.count),
+            type,
+            reinterpret_cast<const GLvoid*>(indices),
+            static_cast<GLsizei>(cmd.instanceCount),
+            cmd.baseVertex,
+            cmd.baseInstance
+        );
+        #else
+        ErrUnsupportedGLProc("glDrawElementsInstancedBaseVertexBaseInstance");
+        #endif
+    }
+    else if (cmd.instanceCount != 1)
+    {
+        glDrawElementsInstancedBaseVertex(
+            mode,
+            static_cast<GLsizei>(cmd.count),
+            type,
+            reinterpret_cast<const GLvoid*>(indices),
+            static_cast<GLsizei>(cmd.instanceCount),
+            cmd.baseVertex
+        );
+    }
+    else if (cmd.baseVertex != 0)
+    {
+        glDrawElementsBaseVertex(
+            mode,
+            static_cast<GLsizei>(cmd.count),
+            type,
+            reinterpret_cast<const GLvoid*>(indices),
+            cmd.baseVertex
+        );
+    }
+    else
+    {
+        glDrawElements(
+            mode,
+            static_cast<GLsizei>(cmd.count),
+            type,
+            reinterpret_cast<const GLvoid*>(indices)
+        );
+    }
+}
+
+// Returns true if none of the specified commands uses instancing, i.e. they can be submitted with glMultiDrawElementsBaseVertex.
+static bool AreCommandsNonInstanced(GLsizei drawCount, const GLDrawElementsIndirectCommand* commands)
+{
+    for (GLsizei i = 0; i < drawCount; ++i)
+    {
+        if (commands[i].instanceCount != 1 || commands[i].baseInstance != 0)
+            return false;
+    }
+    return true;
+}
+
+void GLMultiDrawElementsBatch(
+    GLStateManager&                         stateMngr,
+    GLenum                                  mode,
+    GLenum                                  type,
+    GLsizei                                 drawCount,
+    const GLDrawElementsIndirectCommand*    commands)
+{
+    if (drawCount == 1)
+    {
+        /* Submit single command directly */
+        DrawElementsIndirectCommand(mode, type, commands[0]);
+    }
+    #ifndef __APPLE__
+    else if (HasExtension(GLExt::ARB_multi_draw_indirect))
+    {
+        /* Upload commands into transient indirect argument buffer and submit them with a single draw call */
+        auto indirect = stateMngr.StreamDrawIndirectArguments(
+            commands,
+            static_cast<GLsizeiptr>(sizeof(GLDrawElementsIndirectCommand) * drawCount)
+        );
+        glMultiDrawElementsIndirect(mode, type, reinterpret_cast<const GLvoid*>(indirect), drawCount, 0);
+    }
+    #endif // /__APPLE__
+    else if (HasExtension(GLExt::ARB_draw_elements_base_vertex) && AreCommandsNonInstanced(drawCount, commands))
+    {
+        /* Convert commands into separate arrays for glMultiDrawElementsBaseVertex */
+        std::vector<GLsizei>        counts(drawCount);
+        std::vector<const GLvoid*>  indices(drawCount);
+        std::vector<GLint>          baseVertices(drawCount);
+
+        const auto indexSize = GetIndexSize(type);
+
+        for (GLsizei i = 0; i < drawCount; ++i)
+        {
+            counts[i]       = static_cast<GLsizei>(commands[i].count);
+            indices[i]      = reinterpret_cast<const GLvoid*>(static_cast<GLintptr>(commands[i].firstIndex) * indexSize);
+            baseVertices[i] = commands[i].baseVertex;
+        }
+
+        glMultiDrawElementsBaseVertex(mode, counts.data(), type, indices.data(), drawCount, baseVertices.data());
+    }
+    else
+    {
+        /* Emulate multi draw command */
+        for (GLsizei i = 0; i < drawCount; ++i)
+            DrawElementsIndirectCommand(mode, type, commands[i]);
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
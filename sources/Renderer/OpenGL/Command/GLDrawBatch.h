@@ -0,0 +1,104 @@
+/*
+ * GLDrawBatch.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_DRAW_BATCH_H
+#define LLGL_GL_DRAW_BATCH_H
+
+
+#include "GLCommand.h"
+#include "../OpenGL.h"
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+class GLStateManager;
+
+// Collects consecutive indexed draw commands that can be submitted with a single multi-draw command.
+class GLDrawElementsBatch
+{
+
+    public:
+
+        /*
+        Appends an indexed draw command to this batch, where 'indices' specifies the byte offset into the index buffer.
+        Returns false if the command is incompatible with the already batched commands (i.e. different primitive mode or index type),
+        or if the byte offset is not aligned to the index size. In that case, the batch must be submitted before the command is appended again.
+        */
+        bool Append(
+            GLenum      mode,
+            GLenum      type,
+            GLintptr    indices,
+            GLsizei     count,
+            GLsizei     instanceCount   = 1,
+            GLint       baseVertex      = 0,
+            GLuint      baseInstance    = 0
+        );
+
+        // Submits all batched commands and clears the batch.
+        void Submit(GLStateManager& stateMngr);
+
+        // Returns true if this batch does not contain any commands.
+        inline bool Empty() const
+        {
+            return commands_.empty();
+        }
+
+        // Returns the primitive mode of all batched commands.
+        inline GLenum GetMode() const
+        {
+            return mode_;
+        }
+
+        // Returns the index type of all batched commands.
+        inline GLenum GetType() const
+        {
+            return type_;
+        }
+
+        // Returns the list of batched commands.
+        inline const std::vector<GLDrawElementsIndirectCommand>& GetCommands() const
+        {
+            return commands_;
+        }
+
+        // Removes all commands from this batch.
+        void Clear();
+
+    private:
+
+        GLenum                                      mode_       = 0;
+        GLenum                                      type_       = 0;
+        std::vector<GLDrawElementsIndirectCommand>  commands_;
+
+};
+
+
+/*
+Submits the specified indexed draw commands with as few GL calls as possible:
+either with glMultiDrawElementsIndirect (using the transient indirect argument buffer of the state manager),
+with glMultiDrawElementsBaseVertex if none of the commands is instanced, or with one draw call per command.
+*/
+void GLMultiDrawElementsBatch(
+    GLStateManager&                         stateMngr,
+    GLenum                                  mode,
+    GLenum                                  type,
+    GLsizei                                 drawCount,
+    const GLDrawElementsIndirectCommand*    commands
+);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -53,22 +53,27 @@ bool GLImmediateCommandBuffer::IsImmediateCmdBuffer() const
 
 void GLImmediateCommandBuffer::Begin()
 {
-    // dummy
+    drawBatch_.Clear();
 }
 
 void GLImmediateCommandBuffer::End()
 {
-    // dummy
+    /* Submit remaining batched draw commands */
+    FlushDrawBatch();
 }
 
 void GLImmediateCommandBuffer::UpdateBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, const void* data, std::uint16_t dataSize)
 {
+    FlushDrawBatch();
+
     auto& dstBufferGL = LLGL_CAST(GLBuffer&, dstBuffer);
     dstBufferGL.BufferSubData(static_cast<GLintptr>(dstOffset), static_cast<GLsizeiptr>(dataSize), data);
 }
 
 void GLImmediateCommandBuffer::CopyBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, Buffer& srcBuffer, std::uint64_t srcOffset, std::uint64_t size)
 {
+    FlushDrawBatch();
+
     auto& dstBufferGL = LLGL_CAST(GLBuffer&, dstBuffer);
     auto& srcBufferGL = LLGL_CAST(GLBuffer&, srcBuffer);
     dstBufferGL.CopyBufferSubData(
@@ -81,6 +86,8 @@ void GLImmediateCommandBuffer::CopyBuffer(Buffer& dstBuffer, std::uint64_t dstOf
 
 void GLImmediateCommandBuffer::Execute(CommandBuffer& deferredCommandBuffer)
 {
+    FlushDrawBatch();
+
     auto& cmdBufferGL = LLGL_CAST(const GLCommandBuffer&, deferredCommandBuffer);
     ExecuteGLCommandBuffer(cmdBufferGL, *stateMngr_);
 }
@@ -91,9 +98,10 @@ void GLImmediateCommandBuffer::SetGraphicsAPIDependentState(const void* stateDes
 {
     if (stateDesc != nullptr && stateDescSize == sizeof(OpenGLDependentStateDescriptor))
     {
-        stateMngr_->SetGraphicsAPIDependentState(
-            *reinterpret_cast<const OpenGLDependentStateDescriptor*>(stateDesc)
-        );
+        FlushDrawBatch();
+        const auto& stateDescGL = *reinterpret_cast<const OpenGLDependentStateDescriptor*>(stateDesc);
+        stateMngr_->SetGraphicsAPIDependentState(stateDescGL);
+        batchIndexedDraws_ = stateDescGL.batchIndexedDraws;
     }
 }
 
@@ -101,6 +109,8 @@ void GLImmediateCommandBuffer::SetGraphicsAPIDependentState(const void* stateDes
 
 void GLImmediateCommandBuffer::SetViewport(const Viewport& viewport)
 {
+    FlushDrawBatch();
+
     /* Setup GL viewport and depth-range */
     GLViewport viewportGL{ viewport.x, viewport.y, viewport.width, viewport.height };
     GLDepthRange depthRangeGL{ viewport.minDepth, viewport.maxDepth };
@@ -112,6 +122,8 @@ void GLImmediateCommandBuffer::SetViewport(const Viewport& viewport)
 
 void GLImmediateCommandBuffer::SetViewports(std::uint32_t numViewports, const Viewport* viewports)
 {
+    FlushDrawBatch();
+
     GLViewport viewportsGL[LLGL_MAX_NUM_VIEWPORTS_AND_SCISSORS];
     GLDepthRange depthRangesGL[LLGL_MAX_NUM_VIEWPORTS_AND_SCISSORS];
 
@@ -138,6 +150,8 @@ void GLImmediateCommandBuffer::SetViewports(std::uint32_t numViewports, const Vi
 
 void GLImmediateCommandBuffer::SetScissor(const Scissor& scissor)
 {
+    FlushDrawBatch();
+
     /* Setup and submit GL scissor to state manager */
     GLScissor scissorGL{ scissor.x, scissor.y, scissor.width, scissor.height };
     stateMngr_->SetScissor(scissorGL);
@@ -145,6 +159,8 @@ void GLImmediateCommandBuffer::SetScissor(const Scissor& scissor)
 
 void GLImmediateCommandBuffer::SetScissors(std::uint32_t numScissors, const Scissor* scissors)
 {
+    FlushDrawBatch();
+
     GLScissor scissorsGL[LLGL_MAX_NUM_VIEWPORTS_AND_SCISSORS];
 
     /* Setup GL scissors */
@@ -167,6 +183,8 @@ void GLImmediateCommandBuffer::SetScissors(std::uint32_t numScissors, const Scis
 
 void GLImmediateCommandBuffer::SetClearColor(const ColorRGBAf& color)
 {
+    FlushDrawBatch();
+
     /* Submit clear value to GL */
     glClearColor(color.r, color.g, color.b, color.a);
 
@@ -179,6 +197,8 @@ void GLImmediateCommandBuffer::SetClearColor(const ColorRGBAf& color)
 
 void GLImmediateCommandBuffer::SetClearDepth(float depth)
 {
+    FlushDrawBatch();
+
     /* Submit clear value to GL */
     glClearDepth(depth);
 
@@ -188,6 +208,8 @@ void GLImmediateCommandBuffer::SetClearDepth(float depth)
 
 void GLImmediateCommandBuffer::SetClearStencil(std::uint32_t stencil)
 {
+    FlushDrawBatch();
+
     /* Submit clear value to GL */
     glClearStencil(static_cast<GLint>(stencil));
 
@@ -197,11 +219,15 @@ void GLImmediateCommandBuffer::SetClearStencil(std::uint32_t stencil)
 
 void GLImmediateCommandBuffer::Clear(long flags)
 {
+    FlushDrawBatch();
+
     stateMngr_->Clear(flags);
 }
 
 void GLImmediateCommandBuffer::ClearAttachments(std::uint32_t numAttachments, const AttachmentClear* attachments)
 {
+    FlushDrawBatch();
+
     stateMngr_->ClearBuffers(numAttachments, attachments);
 }
 
@@ -209,26 +235,43 @@ void GLImmediateCommandBuffer::ClearAttachments(std::uint32_t numAttachments, co
 
 void GLImmediateCommandBuffer::SetVertexBuffer(Buffer& buffer)
 {
+    FlushDrawBatch();
+
     if ((buffer.GetBindFlags() & BindFlags::VertexBuffer) != 0)
     {
-        /* Bind vertex buffer */
+        /* Bind vertex buffer to the vertex format of the current pipeline, or bind its VAO if there is no vertex format */
         auto& vertexBufferGL = LLGL_CAST(GLBufferWithVAO&, buffer);
-        stateMngr_->BindVertexArray(vertexBufferGL.GetVaoID());
+
+        const GLuint    id      = vertexBufferGL.GetID();
+        const GLintptr  offset  = 0;
+        const GLsizei   stride  = static_cast<GLsizei>(vertexBufferGL.GetVertexFormat().stride);
+
+        stateMngr_->BindVertexBuffers(vertexBufferGL.GetVaoID(), 1, &id, &offset, &stride);
     }
 }
 
 void GLImmediateCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
 {
+    FlushDrawBatch();
+
     if ((bufferArray.GetBindFlags() & BindFlags::VertexBuffer) != 0)
     {
-        /* Bind vertex buffer */
+        /* Bind vertex buffers to the vertex format of the current pipeline, or bind their VAO if there is no vertex format */
         auto& vertexBufferArrayGL = LLGL_CAST(GLBufferArrayWithVAO&, bufferArray);
-        stateMngr_->BindVertexArray(vertexBufferArrayGL.GetVaoID());
+        stateMngr_->BindVertexBuffers(
+            vertexBufferArrayGL.GetVaoID(),
+            static_cast<GLsizei>(vertexBufferArrayGL.GetIDArray().size()),
+            vertexBufferArrayGL.GetIDArray().data(),
+            vertexBufferArrayGL.GetOffsetArray().data(),
+            vertexBufferArrayGL.GetStrideArray().data()
+        );
     }
 }
 
 void GLImmediateCommandBuffer::SetIndexBuffer(Buffer& buffer)
 {
+    FlushDrawBatch();
+
     /* Bind index buffer deferred (can only be bound to the active VAO) */
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
     stateMngr_->BindElementArrayBufferToVAO(bufferGL.GetID());
@@ -237,6 +280,8 @@ void GLImmediateCommandBuffer::SetIndexBuffer(Buffer& buffer)
 
 void GLImmediateCommandBuffer::SetIndexBuffer(Buffer& buffer, const Format format, std::uint64_t offset)
 {
+    FlushDrawBatch();
+
     /* Bind index buffer deferred (can only be bound to the active VAO) */
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
     stateMngr_->BindElementArrayBufferToVAO(bufferGL.GetID());
@@ -247,11 +292,15 @@ void GLImmediateCommandBuffer::SetIndexBuffer(Buffer& buffer, const Format forma
 
 void GLImmediateCommandBuffer::SetStreamOutputBuffer(Buffer& buffer)
 {
+    FlushDrawBatch();
+
     SetGenericBuffer(GLBufferTarget::TRANSFORM_FEEDBACK_BUFFER, buffer, 0);
 }
 
 void GLImmediateCommandBuffer::SetStreamOutputBufferArray(BufferArray& bufferArray)
 {
+    FlushDrawBatch();
+
     SetGenericBufferArray(GLBufferTarget::TRANSFORM_FEEDBACK_BUFFER, bufferArray, 0);
 }
 
@@ -267,6 +316,8 @@ static void ErrTransformFeedbackNotSupported(const char* funcName)
 
 void GLImmediateCommandBuffer::BeginStreamOutput(const PrimitiveType primitiveType)
 {
+    FlushDrawBatch();
+
     #ifdef __APPLE__
     glBeginTransformFeedback(GLTypes::Map(primitiveType));
     #else
@@ -281,6 +332,8 @@ void GLImmediateCommandBuffer::BeginStreamOutput(const PrimitiveType primitiveTy
 
 void GLImmediateCommandBuffer::EndStreamOutput()
 {
+    FlushDrawBatch();
+
     #ifdef __APPLE__
     glEndTransformFeedback();
     #else
@@ -297,11 +350,15 @@ void GLImmediateCommandBuffer::EndStreamOutput()
 
 void GLImmediateCommandBuffer::SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t /*startSlot*/)
 {
+    FlushDrawBatch();
+
     SetResourceHeap(resourceHeap);
 }
 
 void GLImmediateCommandBuffer::SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t /*startSlot*/)
 {
+    FlushDrawBatch();
+
     SetResourceHeap(resourceHeap);
 }
 
@@ -313,11 +370,15 @@ void GLImmediateCommandBuffer::BeginRenderPass(
     std::uint32_t       numClearValues,
     const ClearValue*   clearValues)
 {
+    FlushDrawBatch();
+
     stateMngr_->BindRenderPass(renderTarget, renderPass, numClearValues, clearValues, clearValue_);
 }
 
 void GLImmediateCommandBuffer::EndRenderPass()
 {
+    FlushDrawBatch();
+
     // dummy
 }
 
@@ -325,6 +386,8 @@ void GLImmediateCommandBuffer::EndRenderPass()
 
 void GLImmediateCommandBuffer::SetGraphicsPipeline(GraphicsPipeline& graphicsPipeline)
 {
+    FlushDrawBatch();
+
     /* Bind graphics pipeline render states */
     auto& graphicsPipelineGL = LLGL_CAST(GLGraphicsPipeline&, graphicsPipeline);
     graphicsPipelineGL.Bind(*stateMngr_);
@@ -335,6 +398,8 @@ void GLImmediateCommandBuffer::SetGraphicsPipeline(GraphicsPipeline& graphicsPip
 
 void GLImmediateCommandBuffer::SetComputePipeline(ComputePipeline& computePipeline)
 {
+    FlushDrawBatch();
+
     auto& computePipelineGL = LLGL_CAST(GLComputePipeline&, computePipeline);
     computePipelineGL.Bind(*stateMngr_);
 }
@@ -343,6 +408,8 @@ void GLImmediateCommandBuffer::SetComputePipeline(ComputePipeline& computePipeli
 
 void GLImmediateCommandBuffer::BeginQuery(QueryHeap& queryHeap, std::uint32_t query)
 {
+    FlushDrawBatch();
+
     /* Begin query with internal target */
     auto& queryHeapGL = LLGL_CAST(GLQueryHeap&, queryHeap);
     queryHeapGL.Begin(query);
@@ -350,19 +417,33 @@ void GLImmediateCommandBuffer::BeginQuery(QueryHeap& queryHeap, std::uint32_t qu
 
 void GLImmediateCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t query)
 {
+    FlushDrawBatch();
+
     /* Begin query with internal target */
     auto& queryHeapGL = LLGL_CAST(GLQueryHeap&, queryHeap);
     queryHeapGL.End(query);
 }
 
+void GLImmediateCommandBuffer::ResolveQueries(QueryHeap& queryHeap, std::uint32_t firstQuery, std::uint32_t numQueries, Buffer& dstBuffer, std::uint64_t dstOffset)
+{
+    /* Write query results into destination buffer */
+    auto& queryHeapGL = LLGL_CAST(GLQueryHeap&, queryHeap);
+    auto& dstBufferGL = LLGL_CAST(GLBuffer&, dstBuffer);
+    queryHeapGL.Resolve(*stateMngr_, firstQuery, numQueries, dstBufferGL.GetID(), static_cast<GLintptr>(dstOffset));
+}
+
 void GLImmediateCommandBuffer::BeginRenderCondition(QueryHeap& queryHeap, std::uint32_t query, const RenderConditionMode mode)
 {
+    FlushDrawBatch();
+
     auto& queryHeapGL = LLGL_CAST(GLQueryHeap&, queryHeap);
     glBeginConditionalRender(queryHeapGL.GetFirstID(query), GLTypes::Map(mode));
 }
 
 void GLImmediateCommandBuffer::EndRenderCondition()
 {
+    FlushDrawBatch();
+
     glEndConditionalRender();
 }
 
@@ -376,6 +457,10 @@ The indices actually store the index start offset, but must be passed to GL as a
 
 void GLImmediateCommandBuffer::Draw(std::uint32_t numVertices, std::uint32_t firstVertex)
 {
+    FlushDrawBatch();
+    stateMngr_->FlushResourceBindings();
+    stateMngr_->FlushMemoryBarriers(true);
+
     glDrawArrays(
         renderState_.drawMode,
         static_cast<GLint>(firstVertex),
@@ -385,7 +470,14 @@ void GLImmediateCommandBuffer::Draw(std::uint32_t numVertices, std::uint32_t fir
 
 void GLImmediateCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex)
 {
+    stateMngr_->FlushResourceBindings();
+    if (drawBatch_.Empty())
+        stateMngr_->FlushMemoryBarriers(true);
+
     const GLintptr indices = (renderState_.indexBufferOffset + firstIndex * renderState_.indexBufferStride);
+    if (batchIndexedDraws_ && BatchDrawElements(indices, numIndices))
+        return;
+
     glDrawElements(
         renderState_.drawMode,
         static_cast<GLsizei>(numIndices),
@@ -396,7 +488,14 @@ void GLImmediateCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32
 
 void GLImmediateCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex, std::int32_t vertexOffset)
 {
+    stateMngr_->FlushResourceBindings();
+    if (drawBatch_.Empty())
+        stateMngr_->FlushMemoryBarriers(true);
+
     const GLintptr indices = (renderState_.indexBufferOffset + firstIndex * renderState_.indexBufferStride);
+    if (batchIndexedDraws_ && BatchDrawElements(indices, numIndices, 1, vertexOffset))
+        return;
+
     glDrawElementsBaseVertex(
         renderState_.drawMode,
         static_cast<GLsizei>(numIndices),
@@ -408,6 +507,10 @@ void GLImmediateCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32
 
 void GLImmediateCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances)
 {
+    FlushDrawBatch();
+    stateMngr_->FlushResourceBindings();
+    stateMngr_->FlushMemoryBarriers(true);
+
     glDrawArraysInstanced(
         renderState_.drawMode,
         static_cast<GLint>(firstVertex),
@@ -418,6 +521,10 @@ void GLImmediateCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uin
 
 void GLImmediateCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances, std::uint32_t firstInstance)
 {
+    FlushDrawBatch();
+    stateMngr_->FlushResourceBindings();
+    stateMngr_->FlushMemoryBarriers(true);
+
     #ifndef __APPLE__
     glDrawArraysInstancedBaseInstance(
         renderState_.drawMode,
@@ -433,7 +540,14 @@ void GLImmediateCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uin
 
 void GLImmediateCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex)
 {
+    stateMngr_->FlushResourceBindings();
+    if (drawBatch_.Empty())
+        stateMngr_->FlushMemoryBarriers(true);
+
     const GLintptr indices = (renderState_.indexBufferOffset + firstIndex * renderState_.indexBufferStride);
+    if (batchIndexedDraws_ && BatchDrawElements(indices, numIndices, numInstances))
+        return;
+
     glDrawElementsInstanced(
         renderState_.drawMode,
         static_cast<GLsizei>(numIndices),
@@ -445,7 +559,14 @@ void GLImmediateCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, st
 
 void GLImmediateCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset)
 {
+    stateMngr_->FlushResourceBindings();
+    if (drawBatch_.Empty())
+        stateMngr_->FlushMemoryBarriers(true);
+
     const GLintptr indices = (renderState_.indexBufferOffset + firstIndex * renderState_.indexBufferStride);
+    if (batchIndexedDraws_ && BatchDrawElements(indices, numIndices, numInstances, vertexOffset))
+        return;
+
     glDrawElementsInstancedBaseVertex(
         renderState_.drawMode,
         static_cast<GLsizei>(numIndices),
@@ -458,8 +579,15 @@ void GLImmediateCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, st
 
 void GLImmediateCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset, std::uint32_t firstInstance)
 {
+    stateMngr_->FlushResourceBindings();
+    if (drawBatch_.Empty())
+        stateMngr_->FlushMemoryBarriers(true);
+
     #ifndef __APPLE__
     const GLintptr indices = (renderState_.indexBufferOffset + firstIndex * renderState_.indexBufferStride);
+    if (batchIndexedDraws_ && BatchDrawElements(indices, numIndices, numInstances, vertexOffset, firstInstance))
+        return;
+
     glDrawElementsInstancedBaseVertexBaseInstance(
         renderState_.drawMode,
         static_cast<GLsizei>(numIndices),
@@ -476,6 +604,10 @@ void GLImmediateCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, st
 
 void GLImmediateCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
 {
+    FlushDrawBatch();
+    stateMngr_->FlushResourceBindings();
+    stateMngr_->FlushMemoryBarriers(true, LLGL_CAST(GLBuffer&, buffer).GetID());
+
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
     stateMngr_->BindBuffer(GLBufferTarget::DRAW_INDIRECT_BUFFER, bufferGL.GetID());
 
@@ -488,6 +620,10 @@ void GLImmediateCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset
 
 void GLImmediateCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
 {
+    FlushDrawBatch();
+    stateMngr_->FlushResourceBindings();
+    stateMngr_->FlushMemoryBarriers(true, LLGL_CAST(GLBuffer&, buffer).GetID());
+
     /* Bind indirect argument buffer */
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
     stateMngr_->BindBuffer(GLBufferTarget::DRAW_INDIRECT_BUFFER, bufferGL.GetID());
@@ -521,6 +657,10 @@ void GLImmediateCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset
 
 void GLImmediateCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
 {
+    FlushDrawBatch();
+    stateMngr_->FlushResourceBindings();
+    stateMngr_->FlushMemoryBarriers(true, LLGL_CAST(GLBuffer&, buffer).GetID());
+
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
     stateMngr_->BindBuffer(GLBufferTarget::DRAW_INDIRECT_BUFFER, bufferGL.GetID());
 
@@ -534,6 +674,10 @@ void GLImmediateCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t
 
 void GLImmediateCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
 {
+    FlushDrawBatch();
+    stateMngr_->FlushResourceBindings();
+    stateMngr_->FlushMemoryBarriers(true, LLGL_CAST(GLBuffer&, buffer).GetID());
+
     /* Bind indirect argument buffer */
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
     stateMngr_->BindBuffer(GLBufferTarget::DRAW_INDIRECT_BUFFER, bufferGL.GetID());
@@ -571,6 +715,10 @@ void GLImmediateCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t
 
 void GLImmediateCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
 {
+    FlushDrawBatch();
+    stateMngr_->FlushResourceBindings();
+    stateMngr_->FlushMemoryBarriers(false);
+
     #ifndef __APPLE__
     glDispatchCompute(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
     #else
@@ -580,6 +728,10 @@ void GLImmediateCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint3
 
 void GLImmediateCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
 {
+    FlushDrawBatch();
+    stateMngr_->FlushResourceBindings();
+    stateMngr_->FlushMemoryBarriers(false, LLGL_CAST(GLBuffer&, buffer).GetID());
+
     #ifndef __APPLE__
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
     stateMngr_->BindBuffer(GLBufferTarget::DISPATCH_INDIRECT_BUFFER, bufferGL.GetID());
@@ -593,11 +745,15 @@ void GLImmediateCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t of
 
 void GLImmediateCommandBuffer::PushDebugGroup(const char* name)
 {
+    FlushDrawBatch();
+
     //TODO
 }
 
 void GLImmediateCommandBuffer::PopDebugGroup()
 {
+    FlushDrawBatch();
+
     //TODO
 }
 
@@ -605,28 +761,39 @@ void GLImmediateCommandBuffer::PopDebugGroup()
 
 void GLImmediateCommandBuffer::SetConstantBuffer(Buffer& buffer, std::uint32_t slot, long /*stageFlags*/)
 {
+    FlushDrawBatch();
+
     SetGenericBuffer(GLBufferTarget::UNIFORM_BUFFER, buffer, slot);
 }
 
 void GLImmediateCommandBuffer::SetSampleBuffer(Buffer& buffer, std::uint32_t slot, long /*stageFlags*/)
 {
+    FlushDrawBatch();
+
     SetGenericBuffer(GLBufferTarget::SHADER_STORAGE_BUFFER, buffer, slot);
+    SetStorageBufferAccess(slot, false);
 }
 
 void GLImmediateCommandBuffer::SetRWStorageBuffer(Buffer& buffer, std::uint32_t slot, long /*stageFlags*/)
 {
+    FlushDrawBatch();
+
     SetGenericBuffer(GLBufferTarget::SHADER_STORAGE_BUFFER, buffer, slot);
+    SetStorageBufferAccess(slot, true);
 }
 
 void GLImmediateCommandBuffer::SetTexture(Texture& texture, std::uint32_t slot, long /*stageFlags*/)
 {
+    FlushDrawBatch();
+
     auto& textureGL = LLGL_CAST(GLTexture&, texture);
-    stateMngr_->ActiveTexture(slot);
-    stateMngr_->BindGLTexture(textureGL);
+    stateMngr_->BindTextureSlot(slot, GLStateManager::GetTextureTarget(textureGL.GetType()), textureGL.GetID());
 }
 
 void GLImmediateCommandBuffer::SetSampler(Sampler& sampler, std::uint32_t slot, long /*stageFlags*/)
 {
+    FlushDrawBatch();
+
     auto& samplerGL = LLGL_CAST(GLSampler&, sampler);
     stateMngr_->BindSampler(slot, samplerGL.GetID());
 }
@@ -638,6 +805,8 @@ void GLImmediateCommandBuffer::ResetResourceSlots(
     long                bindFlags,
     long                /*stageFlags*/)
 {
+    FlushDrawBatch();
+
     if (numSlots > 0)
     {
         auto first = static_cast<GLuint>(std::min(firstSlot, GLStateManager::g_maxNumResourceSlots - 1u));
@@ -684,6 +853,31 @@ void GLImmediateCommandBuffer::ResetResourceSlots(
  * ======= Private: =======
  */
 
+bool GLImmediateCommandBuffer::BatchDrawElements(GLintptr indices, std::uint32_t numIndices, std::uint32_t numInstances, std::int32_t vertexOffset, std::uint32_t firstInstance)
+{
+    const auto mode             = renderState_.drawMode;
+    const auto type             = renderState_.indexBufferDataType;
+    const auto count            = static_cast<GLsizei>(numIndices);
+    const auto instanceCount    = static_cast<GLsizei>(numInstances);
+
+    if (!drawBatch_.Append(mode, type, indices, count, instanceCount, vertexOffset, firstInstance))
+    {
+        /* Start new batch if the command is incompatible with the current one */
+        if (drawBatch_.Empty())
+            return false;
+        FlushDrawBatch();
+        return drawBatch_.Append(mode, type, indices, count, instanceCount, vertexOffset, firstInstance);
+    }
+
+    return true;
+}
+
+void GLImmediateCommandBuffer::FlushDrawBatch()
+{
+    if (!drawBatch_.Empty())
+        drawBatch_.Submit(*stateMngr_);
+}
+
 void GLImmediateCommandBuffer::SetGenericBuffer(const GLBufferTarget bufferTarget, Buffer& buffer, std::uint32_t slot)
 {
     /* Bind buffer with BindBufferBase */
@@ -709,6 +903,15 @@ void GLImmediateCommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap)
     resourceHeapGL.Bind(*stateMngr_);
 }
 
+void GLImmediateCommandBuffer::SetStorageBufferAccess(std::uint32_t slot, bool writable)
+{
+    if (slot < GLStateManager::g_maxNumResourceSlots)
+    {
+        const auto slotMask = (std::uint64_t(1) << slot);
+        stateMngr_->SetStorageBufferWriteMask(slotMask, (writable ? slotMask : 0));
+    }
+}
+
 
 } // /namespace LLGL
 
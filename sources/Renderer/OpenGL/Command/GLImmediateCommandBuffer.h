@@ -10,6 +10,7 @@
 
 
 #include "GLCommandBuffer.h"
+#include "GLDrawBatch.h"
 #include "../RenderState/GLState.h"
 #include "../OpenGL.h"
 #include <memory>
@@ -108,6 +109,8 @@ class GLImmediateCommandBuffer final : public GLCommandBuffer
         void BeginQuery(QueryHeap& queryHeap, std::uint32_t query = 0) override;
         void EndQuery(QueryHeap& queryHeap, std::uint32_t query = 0) override;
 
+        void ResolveQueries(QueryHeap& queryHeap, std::uint32_t firstQuery, std::uint32_t numQueries, Buffer& dstBuffer, std::uint64_t dstOffset) override;
+
         void BeginRenderCondition(QueryHeap& queryHeap, std::uint32_t query = 0, const RenderConditionMode mode = RenderConditionMode::Wait) override;
         void EndRenderCondition() override;
 
@@ -159,17 +162,35 @@ class GLImmediateCommandBuffer final : public GLCommandBuffer
 
     private:
 
+        // Appends an indexed draw command to the current draw batch, or returns false if the command cannot be batched.
+        bool BatchDrawElements(
+            GLintptr        indices,
+            std::uint32_t   numIndices,
+            std::uint32_t   numInstances    = 1,
+            std::int32_t    vertexOffset    = 0,
+            std::uint32_t   firstInstance   = 0
+        );
+
+        // Submits all pending batched draw commands.
+        void FlushDrawBatch();
+
         void SetGenericBuffer(const GLBufferTarget bufferTarget, Buffer& buffer, std::uint32_t slot);
         void SetGenericBufferArray(const GLBufferTarget bufferTarget, BufferArray& bufferArray, std::uint32_t startSlot);
 
         void SetResourceHeap(ResourceHeap& resourceHeap);
 
+        // Specifies whether the shader storage buffer slot is bound with write access (see OpenGLDependentStateDescriptor::automaticMemoryBarriers).
+        void SetStorageBufferAccess(std::uint32_t slot, bool writable);
+
     private:
 
         std::shared_ptr<GLStateManager> stateMngr_;
         GLRenderState                   renderState_;
         GLClearValue                    clearValue_;
 
+        GLDrawElementsBatch             drawBatch_;
+        bool                            batchIndexedDraws_  = false;
+
 };
 
 
@@ -0,0 +1,333 @@
+/*
+ * GLRenderThread.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLRenderThread.h"
+#include "GLCommand.h"
+#include "GLCommandExecutor.h"
+#include "GLDeferredCommandBuffer.h"
+#include "../GLRenderContext.h"
+#include "../RenderState/GLStateManager.h"
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+static std::atomic<GLRenderThread*> g_activeRenderThread { nullptr };
+
+// Synchronous job that is passed to the render thread with 'GLRenderThread::Invoke'.
+struct GLRenderThreadJob
+{
+    const std::function<void()>*    func;
+    std::exception_ptr              exception;
+    bool                            done;
+    std::mutex*                     mutex;
+    std::condition_variable*        doneSignal;
+};
+
+static void InvokeJobFunc(void* userData)
+{
+    auto job = reinterpret_cast<GLRenderThreadJob*>(userData);
+
+    try
+    {
+        (*job->func)();
+    }
+    catch (...)
+    {
+        job->exception = std::current_exception();
+    }
+
+    /* Notify waiting application thread */
+    {
+        std::lock_guard<std::mutex> guard { *job->mutex };
+        job->done = true;
+    }
+    job->doneSignal->notify_all();
+}
+
+GLRenderThread::GLRenderThread(GLRenderContext& renderContext, std::size_t ringSize) :
+    ring_          { ringSize          },
+    threadID_      { std::thread::id() },
+    renderContext_ { &renderContext    },
+    waiting_       { false             },
+    queuedFrames_  { 0                 }
+{
+    /* Activate this render thread before it starts, since forwarded calls depend on it (see 'IsForwardingRequired') */
+    g_activeRenderThread = this;
+
+    /* Start render thread; it also stores its own ID before it executes any command, so both threads agree on it */
+    thread_     = std::thread(&GLRenderThread::Run, this, &renderContext);
+    threadID_   = thread_.get_id();
+}
+
+GLRenderThread::~GLRenderThread()
+{
+    /* Let the render thread quit after all pending commands have been executed */
+    Post(GLRenderThread::QuitFunc, this);
+    thread_.join();
+
+    g_activeRenderThread = nullptr;
+
+    /* Make render context current on the calling thread again */
+    GLRenderContext::GLMakeCurrent(renderContext_);
+}
+
+GLRenderThread* GLRenderThread::Active()
+{
+    return g_activeRenderThread;
+}
+
+bool GLRenderThread::IsForwardingRequired()
+{
+    auto renderThread = g_activeRenderThread.load();
+    return (renderThread != nullptr && renderThread->threadID_.load() != std::this_thread::get_id());
+}
+
+void GLRenderThread::Submit(const GLDeferredCommandBuffer& cmdBuffer)
+{
+    /* Ensure all chunks fit into the command ring, otherwise execute the command buffer synchronously */
+    for (auto chunk = cmdBuffer.GetFirstChunk(); chunk != nullptr; chunk = chunk->next)
+    {
+        if (chunk->size > ring_.GetMaxRecordSize())
+        {
+            Invoke(
+                [&]()
+                {
+                    ExecuteGLDeferredCommandBuffer(cmdBuffer, *(renderContext_->GetStateManager()));
+                }
+            );
+            return;
+        }
+    }
+
+    /* Copy each chunk as a single record into the command ring, since commands never cross chunk boundaries */
+    std::lock_guard<std::mutex> guard { producerMutex_ };
+    for (auto chunk = cmdBuffer.GetFirstChunk(); chunk != nullptr; chunk = chunk->next)
+    {
+        if (chunk->size > 0)
+            WriteBytes(chunk->Data(), chunk->size);
+    }
+}
+
+bool GLRenderThread::UpdateBuffer(GLBuffer& buffer, GLintptr offset, const void* data, GLsizeiptr size)
+{
+    const auto dataSize = static_cast<std::size_t>(size);
+    if (sizeof(GLOpcode) + sizeof(GLCmdUpdateBuffer) + dataSize > ring_.GetMaxRecordSize())
+        return false;
+
+    GLCmdUpdateBuffer cmd;
+    {
+        cmd.buffer  = &buffer;
+        cmd.offset  = offset;
+        cmd.size    = size;
+    }
+    {
+        std::lock_guard<std::mutex> guard { producerMutex_ };
+        WriteCommand(GLOpcodeUpdateBuffer, &cmd, sizeof(cmd), data, dataSize);
+    }
+
+    return true;
+}
+
+void GLRenderThread::Post(void (*func)(void* userData), void* userData)
+{
+    GLCmdInvoke cmd;
+    {
+        cmd.func        = func;
+        cmd.userData    = userData;
+    }
+    std::lock_guard<std::mutex> guard { producerMutex_ };
+    WriteCommand(GLOpcodeInvoke, &cmd, sizeof(cmd));
+}
+
+void GLRenderThread::Invoke(const std::function<void()>& func)
+{
+    if (threadID_.load() == std::this_thread::get_id())
+    {
+        /* Call function directly if we are already on the render thread */
+        func();
+        return;
+    }
+
+    GLRenderThreadJob job;
+    {
+        job.func        = &func;
+        job.done        = false;
+        job.mutex       = &mutex_;
+        job.doneSignal  = &doneSignal_;
+    }
+    Post(InvokeJobFunc, &job);
+
+    /* Wait until the render thread has executed the job and take over any exception of a previous command */
+    std::exception_ptr pendingException;
+    {
+        std::unique_lock<std::mutex> lock { mutex_ };
+        doneSignal_.wait(lock, [&job]() { return job.done; });
+        std::swap(pendingException, pendingException_);
+    }
+
+    if (pendingException)
+        std::rethrow_exception(pendingException);
+    if (job.exception)
+        std::rethrow_exception(job.exception);
+}
+
+void GLRenderThread::Present(GLRenderContext& renderContext)
+{
+    /* Throttle application thread if too many frames are queued */
+    if (++queuedFrames_ > g_maxQueuedFrames)
+    {
+        std::unique_lock<std::mutex> lock { mutex_ };
+        doneSignal_.wait(lock, [this]() { return (queuedFrames_.load() <= g_maxQueuedFrames); });
+    }
+    Post(GLRenderThread::PresentFunc, &renderContext);
+}
+
+void GLRenderThread::WaitIdle()
+{
+    Invoke([]() {});
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void GLRenderThread::Run(GLRenderContext* renderContext)
+{
+    /* Store thread ID before any command is executed (see constructor) */
+    threadID_ = std::this_thread::get_id();
+
+    /* Make render context current on this thread */
+    GLRenderContext::GLMakeCurrent(renderContext);
+
+    while (!quit_)
+    {
+        std::size_t size = 0;
+        if (auto data = ring_.BeginRead(size))
+        {
+            /* Execute next contiguous range of commands */
+            ExecuteCommands(data, size);
+            ring_.EndRead(size);
+        }
+        else
+        {
+            /*
+            Wait for new commands. The fence pairs with the one in 'NotifyRenderThread': either the producer sees the waiting flag
+            and notifies under the lock (which it can only acquire once this thread is waiting), or this thread sees the new commands.
+            */
+            std::unique_lock<std::mutex> lock { mutex_ };
+            waiting_ = true;
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            wakeSignal_.wait(lock, [this]() { return !ring_.IsEmpty(); });
+            waiting_ = false;
+        }
+    }
+
+    /* Release render context from this thread */
+    GLRenderContext::GLMakeCurrent(nullptr);
+}
+
+void GLRenderThread::WriteCommand(const GLOpcode opcode, const void* cmd, std::size_t cmdSize, const void* data, std::size_t dataSize)
+{
+    auto dst = ring_.BeginWrite(sizeof(GLOpcode) + cmdSize + dataSize);
+    {
+        *dst = opcode;
+        ::memcpy(dst + sizeof(GLOpcode), cmd, cmdSize);
+        if (dataSize > 0)
+            ::memcpy(dst + sizeof(GLOpcode) + cmdSize, data, dataSize);
+    }
+    ring_.EndWrite();
+    NotifyRenderThread();
+}
+
+void GLRenderThread::WriteBytes(const void* data, std::size_t size)
+{
+    auto dst = ring_.BeginWrite(size);
+    ::memcpy(dst, data, size);
+    ring_.EndWrite();
+    NotifyRenderThread();
+}
+
+void GLRenderThread::NotifyRenderThread()
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (waiting_.load())
+    {
+        std::lock_guard<std::mutex> guard { mutex_ };
+        wakeSignal_.notify_one();
+    }
+}
+
+void GLRenderThread::ExecuteCommands(const std::uint8_t* data, std::size_t size)
+{
+    auto& stateMngr = *(renderContext_->GetStateManager());
+
+    for (auto pc = data, pcEnd = data + size; pc < pcEnd;)
+    {
+        /* Read opcode and skip remaining bytes of this range on a wrap marker */
+        auto opcode = *reinterpret_cast<const GLOpcode*>(pc);
+        if (opcode == GLCommandRing::g_wrapMarker)
+            break;
+        pc += sizeof(GLOpcode);
+
+        /* Execute command and increment program counter; an exception must not terminate the render thread */
+        try
+        {
+            pc += ExecuteGLCommand(opcode, pc, stateMngr);
+        }
+        catch (...)
+        {
+            StorePendingException();
+            pc += GetGLCommandSize(opcode, pc);
+        }
+    }
+}
+
+void GLRenderThread::StorePendingException()
+{
+    std::lock_guard<std::mutex> guard { mutex_ };
+    if (!pendingException_)
+        pendingException_ = std::current_exception();
+}
+
+void GLRenderThread::QuitFunc(void* userData)
+{
+    auto self = reinterpret_cast<GLRenderThread*>(userData);
+    self->quit_ = true;
+}
+
+void GLRenderThread::PresentFunc(void* userData)
+{
+    auto renderContext = reinterpret_cast<GLRenderContext*>(userData);
+    auto self = g_activeRenderThread.load();
+
+    try
+    {
+        renderContext->Present();
+    }
+    catch (...)
+    {
+        self->StorePendingException();
+    }
+
+    /* Release queued frame and notify throttled application thread */
+    {
+        std::lock_guard<std::mutex> guard { self->mutex_ };
+        --(self->queuedFrames_);
+    }
+    self->doneSignal_.notify_all();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,162 @@
+/*
+ * GLRenderThread.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_RENDER_THREAD_H
+#define LLGL_GL_RENDER_THREAD_H
+
+
+#include "GLCommandRing.h"
+#include "GLCommandOpcode.h"
+#include "../OpenGL.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <atomic>
+#include <exception>
+
+
+namespace LLGL
+{
+
+
+class GLRenderContext;
+class GLDeferredCommandBuffer;
+class GLBuffer;
+
+/*
+Dedicated thread that owns the GL context and executes all GL commands.
+Command buffers are copied into a lock-free command ring on submission,
+all other GL calls are forwarded to this thread and block until they have been executed (see 'GLInvokeOnRenderThread').
+Commands can be enqueued from any thread (e.g. the application and the loader thread); the producers are serialized by a mutex,
+since the command ring only supports a single producer.
+*/
+class GLRenderThread
+{
+
+    public:
+
+        GLRenderThread(const GLRenderThread&) = delete;
+        GLRenderThread& operator = (const GLRenderThread&) = delete;
+
+        // Starts the render thread and makes the specified render context current on it. The render context must not be current on the calling thread.
+        GLRenderThread(GLRenderContext& renderContext, std::size_t ringSize);
+
+        // Executes all pending commands, stops the render thread, and makes the render context current on the calling thread again.
+        ~GLRenderThread();
+
+        // Returns the active render thread, or null if there is none.
+        static GLRenderThread* Active();
+
+        // Returns true if there is an active render thread and the calling thread is not the render thread itself.
+        static bool IsForwardingRequired();
+
+        // Copies the commands of the specified deferred command buffer into the command ring.
+        void Submit(const GLDeferredCommandBuffer& cmdBuffer);
+
+        // Copies the specified data into the command ring to update the buffer asynchronously. Returns false if the data is too large for the ring.
+        bool UpdateBuffer(GLBuffer& buffer, GLintptr offset, const void* data, GLsizeiptr size);
+
+        // Enqueues the specified function. It will be called on the render thread after all previously enqueued commands.
+        void Post(void (*func)(void* userData), void* userData);
+
+        /*
+        Calls the specified function on the render thread and waits until it returns. Exceptions are re-thrown on the calling thread.
+        If a previously enqueued command has thrown an exception on the render thread, that exception is re-thrown instead.
+        */
+        void Invoke(const std::function<void()>& func);
+
+        // Enqueues a buffer swap for the specified render context. Blocks if too many frames are already queued.
+        void Present(GLRenderContext& renderContext);
+
+        // Blocks until the render thread has executed all enqueued commands.
+        void WaitIdle();
+
+    private:
+
+        void Run(GLRenderContext* renderContext);
+
+        // Writes a single record into the command ring. The caller must hold the producer lock.
+        void WriteCommand(const GLOpcode opcode, const void* cmd, std::size_t cmdSize, const void* data = nullptr, std::size_t dataSize = 0);
+        void WriteBytes(const void* data, std::size_t size);
+        void NotifyRenderThread();
+
+        void ExecuteCommands(const std::uint8_t* data, std::size_t size);
+
+        // Stores the current exception to be re-thrown by the next call to 'Invoke'. Only the first pending exception is kept.
+        void StorePendingException();
+
+        static void QuitFunc(void* userData);
+        static void PresentFunc(void* userData);
+
+    private:
+
+        // Maximal number of frames that can be queued before 'Present' blocks.
+        static const int g_maxQueuedFrames = 2;
+
+        GLCommandRing           ring_;
+
+        std::thread                     thread_;
+        std::atomic<std::thread::id>    threadID_;
+        GLRenderContext*                renderContext_      = nullptr;
+        bool                            quit_               = false;
+
+        std::mutex                      producerMutex_;
+
+        std::mutex                      mutex_;
+        std::condition_variable         wakeSignal_;
+        std::condition_variable         doneSignal_;
+        std::atomic<bool>               waiting_;
+        std::atomic<int>                queuedFrames_;
+        std::exception_ptr              pendingException_;
+
+};
+
+
+template <typename T>
+struct GLInvokeResult
+{
+    template <typename TFunc>
+    static T Call(TFunc&& func)
+    {
+        T result {};
+        GLRenderThread::Active()->Invoke([&]() { result = func(); });
+        return result;
+    }
+};
+
+template <>
+struct GLInvokeResult<void>
+{
+    template <typename TFunc>
+    static void Call(TFunc&& func)
+    {
+        GLRenderThread::Active()->Invoke(func);
+    }
+};
+
+// Calls the specified function on the active render thread and returns its result.
+template <typename TFunc>
+auto GLInvokeOnRenderThread(TFunc&& func) -> decltype(func())
+{
+    return GLInvokeResult<decltype(func())>::Call(std::forward<TFunc>(func));
+}
+
+// Forwards the enclosing function call to the active render thread if it is not called from the render thread itself.
+#define LLGL_GL_FORWARD_TO_RENDER_THREAD(EXPR)                  \
+    if (GLRenderThread::IsForwardingRequired())                 \
+        return GLInvokeOnRenderThread([&]() { return EXPR; })
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -9,7 +9,14 @@
 #include "GLExtensions.h"
 #include "GLExtensionsNull.h"
 #include <LLGL/Log.h>
-#include <functional>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <cstdlib>
+
+#if defined(__linux__) && defined(LLGL_GL_ENABLE_EGL)
+#include <EGL/egl.h>
+#endif
 
 
 namespace LLGL
@@ -28,6 +35,11 @@ bool LoadGLProc(T& procAddr, const char* procName)
     #if defined(_WIN32)
     procAddr = reinterpret_cast<T>(wglGetProcAddress(procName));
     #elif defined(__linux__)
+    #ifdef LLGL_GL_ENABLE_EGL
+    if (eglGetCurrentContext() != EGL_NO_CONTEXT)
+        procAddr = reinterpret_cast<T>(eglGetProcAddress(procName));
+    else
+    #endif // /LLGL_GL_ENABLE_EGL
     procAddr = reinterpret_cast<T>(glXGetProcAddress(reinterpret_cast<const GLubyte*>(procName)));
     #else
     Log::PostReport(Log::ReportType::Error, "OS not supported for loading OpenGL extensions");
@@ -61,21 +73,135 @@ static void ExtractExtensionsFromString(GLExtensionList& extensions, const std::
 
 #ifndef __APPLE__
 
+/* --- Deferred extension loading --- */
+
+// Modes for the extension loading procedures.
+enum class GLProcLoadMode
+{
+    Load,           // Load all procedures of the extension.
+    Check,          // Only check whether all procedures of the extension are available, without setting them.
+    Placeholder,    // Set all procedures to their placeholders (see GLExtensionsNull.h).
+    Deferred,       // Set all procedures to trampolines that load the respective procedure on first use.
+};
+
+using GLExtLoadingProc = bool (*)(GLProcLoadMode);
+
+// Trampoline of a GL procedure, which loads the actual procedure on first use.
+struct GLDeferredProc
+{
+    const void*         procAddr;
+    const char*         procName;
+};
+
+static std::mutex                   g_deferredExtMutex;
+static std::vector<GLDeferredProc>  g_deferredProcs;
+
+template <typename T>
+bool CheckGLProc(const T& /*procAddr*/, const char* procName)
+{
+    T proc = nullptr;
+    return LoadGLProc(proc, procName);
+}
+
+static const char* FindDeferredGLProcName(const void* procAddr)
+{
+    std::lock_guard<std::mutex> guard { g_deferredExtMutex };
+    for (const auto& proc : g_deferredProcs)
+    {
+        if (proc.procAddr == procAddr)
+            return proc.procName;
+    }
+    return nullptr;
+}
+
+/*
+Loads the actual procedure of the specified deferred GL procedure.
+The procedure has already been checked when its extension was registered (see GLProcLoadMode::Check),
+so this can only fail if the driver is inconsistent. GL entry points must not throw, so the error is reported and the application is terminated.
+*/
+template <typename Proc>
+Proc ResolveDeferredGLProc(Proc* procAddr)
+{
+    Proc proc = nullptr;
+    auto procName = FindDeferredGLProcName(procAddr);
+    if (procName == nullptr || !LoadGLProc(proc, procName))
+    {
+        Log::PostReport(Log::ReportType::Error, "failed to resolve deferred OpenGL procedure: " + std::string(procName != nullptr ? procName : "<unknown>"));
+        std::abort();
+    }
+    return proc;
+}
+
+template <typename T>
+struct GLProcTrampoline;
+
+template <typename R, typename... Args>
+struct GLProcTrampoline<R (APIENTRY*)(Args...)>
+{
+    using Proc = R (APIENTRY*)(Args...);
+
+    template <Proc* ProcAddr>
+    static R APIENTRY Invoke(Args... args)
+    {
+        /*
+        Load the actual procedure on first use and publish it through an atomic pointer only.
+        The global procedure address is never replaced, i.e. all call sites keep calling this trampoline,
+        which makes it safe to call from any GL thread (e.g. the render thread and the texture loader thread).
+        */
+        static std::atomic<Proc> resolved { nullptr };
+        auto proc = resolved.load(std::memory_order_acquire);
+        if (proc == nullptr)
+        {
+            proc = ResolveDeferredGLProc<Proc>(ProcAddr);
+            resolved.store(proc, std::memory_order_release);
+        }
+        return proc(args...);
+    }
+};
+
+// Registers the specified GL procedure as deferred procedure. Must be called with 'g_deferredExtMutex' locked.
+static void RegisterDeferredGLProc(const void* procAddr, const char* procName)
+{
+    g_deferredProcs.push_back({ procAddr, procName });
+}
+
+#define DEFER_GLPROC(NAME)                                                  \
+    NAME = &GLProcTrampoline<decltype(NAME)>::Invoke<&NAME>;                \
+    RegisterDeferredGLProc(&NAME, #NAME)
+
 #define LOAD_GLPROC_SIMPLE(NAME) \
     LoadGLProc(NAME, #NAME)
 
 #ifdef LLGL_GL_ENABLE_EXT_PLACEHOLDERS
 
-#define LOAD_GLPROC(NAME)               \
-    if (usePlaceholder)                 \
-        NAME = Dummy_##NAME;            \
-    else if (!LoadGLProc(NAME, #NAME))  \
+#define LOAD_GLPROC(NAME)                           \
+    if (mode == GLProcLoadMode::Deferred)           \
+    {                                               \
+        DEFER_GLPROC(NAME);                         \
+    }                                               \
+    else if (mode == GLProcLoadMode::Check)         \
+    {                                               \
+        if (!CheckGLProc(NAME, #NAME))              \
+            return false;                           \
+    }                                               \
+    else if (mode == GLProcLoadMode::Placeholder)   \
+        NAME = Dummy_##NAME;                        \
+    else if (!LoadGLProc(NAME, #NAME))              \
         return false
 
 #else
 
-#define LOAD_GLPROC(NAME)           \
-    if (!LoadGLProc(NAME, #NAME))   \
+#define LOAD_GLPROC(NAME)                           \
+    if (mode == GLProcLoadMode::Deferred)           \
+    {                                               \
+        DEFER_GLPROC(NAME);                         \
+    }                                               \
+    else if (mode == GLProcLoadMode::Check)         \
+    {                                               \
+        if (!CheckGLProc(NAME, #NAME))              \
+            return false;                           \
+    }                                               \
+    else if (!LoadGLProc(NAME, #NAME))              \
         return false
 
 #endif // /LLGL_GL_ENABLE_EXT_PLACEHOLDERS
@@ -113,7 +239,7 @@ bool LoadCreateContextProcs()
 
 /* --- Hardware buffer extensions --- */
 
-static bool Load_GL_ARB_vertex_buffer_object(bool usePlaceholder)
+static bool Load_GL_ARB_vertex_buffer_object(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glGenBuffers           );
     LOAD_GLPROC( glDeleteBuffers        );
@@ -136,7 +262,7 @@ static bool Load_GL_ARB_vertex_buffer_object(bool usePlaceholder)
     return true;
 }
 
-static bool Load_GL_ARB_vertex_array_object(bool usePlaceholder)
+static bool Load_GL_ARB_vertex_array_object(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glGenVertexArrays    );
     LOAD_GLPROC( glDeleteVertexArrays );
@@ -145,7 +271,7 @@ static bool Load_GL_ARB_vertex_array_object(bool usePlaceholder)
     return true;
 }
 
-static bool Load_GL_ARB_framebuffer_object(bool usePlaceholder)
+static bool Load_GL_ARB_framebuffer_object(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glGenRenderbuffers                    );
     LOAD_GLPROC( glDeleteRenderbuffers                 );
@@ -174,7 +300,7 @@ static bool Load_GL_ARB_framebuffer_object(bool usePlaceholder)
     return true;
 }
 
-static bool Load_GL_ARB_uniform_buffer_object(bool usePlaceholder)
+static bool Load_GL_ARB_uniform_buffer_object(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glGetUniformBlockIndex      );
     LOAD_GLPROC( glGetActiveUniformBlockiv   );
@@ -184,7 +310,7 @@ static bool Load_GL_ARB_uniform_buffer_object(bool usePlaceholder)
     return true;
 }
 
-static bool Load_GL_ARB_shader_storage_buffer_object(bool usePlaceholder)
+static bool Load_GL_ARB_shader_storage_buffer_object(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glShaderStorageBlockBinding );
     return true;
@@ -192,14 +318,14 @@ static bool Load_GL_ARB_shader_storage_buffer_object(bool usePlaceholder)
 
 /* --- Drawing extensions --- */
 
-static bool Load_GL_ARB_draw_instanced(bool usePlaceholder)
+static bool Load_GL_ARB_draw_instanced(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glDrawArraysInstanced   );
     LOAD_GLPROC( glDrawElementsInstanced );
     return true;
 }
 
-static bool Load_GL_ARB_base_instance(bool usePlaceholder)
+static bool Load_GL_ARB_base_instance(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glDrawArraysInstancedBaseInstance             );
     LOAD_GLPROC( glDrawElementsInstancedBaseInstance           );
@@ -207,16 +333,17 @@ static bool Load_GL_ARB_base_instance(bool usePlaceholder)
     return true;
 }
 
-static bool Load_GL_ARB_draw_elements_base_vertex(bool usePlaceholder)
+static bool Load_GL_ARB_draw_elements_base_vertex(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glDrawElementsBaseVertex          );
     LOAD_GLPROC( glDrawElementsInstancedBaseVertex );
+    LOAD_GLPROC( glMultiDrawElementsBaseVertex     );
     return true;
 }
 
 /* --- Shader extensions --- */
 
-static bool Load_GL_ARB_shader_objects(bool usePlaceholder)
+static bool Load_GL_ARB_shader_objects(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glCreateShader       );
     LOAD_GLPROC( glShaderSource       );
@@ -262,27 +389,27 @@ static bool Load_GL_ARB_shader_objects(bool usePlaceholder)
     return true;
 }
 
-static bool Load_GL_ARB_instanced_arrays(bool usePlaceholder)
+static bool Load_GL_ARB_instanced_arrays(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glVertexAttribDivisor );
     return true;
 }
 
-static bool Load_GL_ARB_tessellation_shader(bool usePlaceholder)
+static bool Load_GL_ARB_tessellation_shader(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glPatchParameteri  );
     LOAD_GLPROC( glPatchParameterfv );
     return true;
 }
 
-static bool Load_GL_ARB_compute_shader(bool usePlaceholder)
+static bool Load_GL_ARB_compute_shader(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glDispatchCompute         );
     LOAD_GLPROC( glDispatchComputeIndirect );
     return true;
 }
 
-static bool Load_GL_ARB_get_program_binary(bool usePlaceholder)
+static bool Load_GL_ARB_get_program_binary(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glGetProgramBinary  );
     LOAD_GLPROC( glProgramBinary     );
@@ -290,7 +417,20 @@ static bool Load_GL_ARB_get_program_binary(bool usePlaceholder)
     return true;
 }
 
-static bool Load_GL_ARB_program_interface_query(bool usePlaceholder)
+static bool Load_GL_ARB_separate_shader_objects(GLProcLoadMode mode)
+{
+    LOAD_GLPROC( glUseProgramStages          );
+    LOAD_GLPROC( glActiveShaderProgram       );
+    LOAD_GLPROC( glBindProgramPipeline       );
+    LOAD_GLPROC( glDeleteProgramPipelines    );
+    LOAD_GLPROC( glGenProgramPipelines       );
+    LOAD_GLPROC( glGetProgramPipelineiv      );
+    LOAD_GLPROC( glValidateProgramPipeline   );
+    LOAD_GLPROC( glGetProgramPipelineInfoLog );
+    return true;
+}
+
+static bool Load_GL_ARB_program_interface_query(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glGetProgramInterfaceiv           );
     LOAD_GLPROC( glGetProgramResourceIndex         );
@@ -301,7 +441,7 @@ static bool Load_GL_ARB_program_interface_query(bool usePlaceholder)
     return true;
 }
 
-static bool Load_GL_EXT_gpu_shader4(bool usePlaceholder)
+static bool Load_GL_EXT_gpu_shader4(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glVertexAttribIPointer );
     LOAD_GLPROC( glBindFragDataLocation );
@@ -311,27 +451,27 @@ static bool Load_GL_EXT_gpu_shader4(bool usePlaceholder)
 
 /* --- Texture extensions --- */
 
-static bool Load_GL_ARB_multitexture(bool usePlaceholder)
+static bool Load_GL_ARB_multitexture(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glActiveTexture );
     return true;
 }
 
-static bool Load_GL_EXT_texture3D(bool usePlaceholder)
+static bool Load_GL_EXT_texture3D(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glTexImage3D    );
     LOAD_GLPROC( glTexSubImage3D );
     return true;
 }
 
-static bool Load_GL_ARB_clear_texture(bool usePlaceholder)
+static bool Load_GL_ARB_clear_texture(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glClearTexImage    );
     LOAD_GLPROC( glClearTexSubImage );
     return true;
 }
 
-static bool Load_GL_ARB_texture_compression(bool usePlaceholder)
+static bool Load_GL_ARB_texture_compression(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glCompressedTexImage1D    );
     LOAD_GLPROC( glCompressedTexImage2D    );
@@ -343,7 +483,7 @@ static bool Load_GL_ARB_texture_compression(bool usePlaceholder)
     return true;
 }
 
-static bool Load_GL_ARB_texture_multisample(bool usePlaceholder)
+static bool Load_GL_ARB_texture_multisample(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glTexImage2DMultisample );
     LOAD_GLPROC( glTexImage3DMultisample );
@@ -352,7 +492,7 @@ static bool Load_GL_ARB_texture_multisample(bool usePlaceholder)
     return true;
 }
 
-static bool Load_GL_ARB_sampler_objects(bool usePlaceholder)
+static bool Load_GL_ARB_sampler_objects(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glGenSamplers        );
     LOAD_GLPROC( glDeleteSamplers     );
@@ -366,7 +506,7 @@ static bool Load_GL_ARB_sampler_objects(bool usePlaceholder)
 
 /* --- Other extensions --- */
 
-static bool Load_GL_ARB_occlusion_query(bool usePlaceholder)
+static bool Load_GL_ARB_occlusion_query(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glGenQueries        );
     LOAD_GLPROC( glDeleteQueries     );
@@ -377,14 +517,14 @@ static bool Load_GL_ARB_occlusion_query(bool usePlaceholder)
     return true;
 }
 
-static bool Load_GL_NV_conditional_render(bool usePlaceholder)
+static bool Load_GL_NV_conditional_render(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glBeginConditionalRender );
     LOAD_GLPROC( glEndConditionalRender   );
     return true;
 }
 
-static bool Load_GL_ARB_timer_query(bool usePlaceholder)
+static bool Load_GL_ARB_timer_query(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glQueryCounter        );
     LOAD_GLPROC( glGetQueryObjecti64v  );
@@ -392,7 +532,7 @@ static bool Load_GL_ARB_timer_query(bool usePlaceholder)
     return true;
 }
 
-static bool Load_GL_ARB_viewport_array(bool usePlaceholder)
+static bool Load_GL_ARB_viewport_array(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glViewportArrayv   );
     LOAD_GLPROC( glScissorArrayv    );
@@ -400,31 +540,31 @@ static bool Load_GL_ARB_viewport_array(bool usePlaceholder)
     return true;
 }
 
-static bool Load_GL_EXT_blend_minmax(bool usePlaceholder)
+static bool Load_GL_EXT_blend_minmax(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glBlendEquation );
     return true;
 }
 
-static bool Load_GL_EXT_blend_color(bool usePlaceholder)
+static bool Load_GL_EXT_blend_color(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glBlendColor );
     return true;
 }
 
-static bool Load_GL_EXT_blend_func_separate(bool usePlaceholder)
+static bool Load_GL_EXT_blend_func_separate(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glBlendFuncSeparate );
     return true;
 }
 
-static bool Load_GL_EXT_blend_equation_separate(bool usePlaceholder)
+static bool Load_GL_EXT_blend_equation_separate(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glBlendEquationSeparate );
     return true;
 }
 
-static bool Load_GL_ARB_draw_buffers_blend(bool usePlaceholder)
+static bool Load_GL_ARB_draw_buffers_blend(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glBlendEquationi         );
     LOAD_GLPROC( glBlendEquationSeparatei );
@@ -433,7 +573,7 @@ static bool Load_GL_ARB_draw_buffers_blend(bool usePlaceholder)
     return true;
 }
 
-static bool Load_GL_ARB_multi_bind(bool usePlaceholder)
+static bool Load_GL_ARB_multi_bind(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glBindBuffersBase   );
     LOAD_GLPROC( glBindBuffersRange  );
@@ -444,7 +584,7 @@ static bool Load_GL_ARB_multi_bind(bool usePlaceholder)
     return true;
 }
 
-static bool Load_GL_EXT_stencil_two_side(bool usePlaceholder)
+static bool Load_GL_EXT_stencil_two_side(GLProcLoadMode mode)
 {
     //correct extension ??? maybe "GL_ATI_separate_stencil"
     LOAD_GLPROC( glStencilFuncSeparate );
@@ -453,25 +593,25 @@ static bool Load_GL_EXT_stencil_two_side(bool usePlaceholder)
     return true;
 }
 
-static bool Load_GL_KHR_debug(bool usePlaceholder)
+static bool Load_GL_KHR_debug(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glDebugMessageCallback );
     return true;
 }
 
-static bool Load_GL_ARB_clip_control(bool usePlaceholder)
+static bool Load_GL_ARB_clip_control(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glClipControl );
     return true;
 }
 
-static bool Load_GL_ARB_draw_buffers(bool usePlaceholder)
+static bool Load_GL_ARB_draw_buffers(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glDrawBuffers );
     return true;
 }
 
-static bool Load_GL_EXT_draw_buffers2(bool usePlaceholder)
+static bool Load_GL_EXT_draw_buffers2(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glColorMaski    );
     LOAD_GLPROC( glGetBooleani_v );
@@ -482,7 +622,7 @@ static bool Load_GL_EXT_draw_buffers2(bool usePlaceholder)
     return true;
 }
 
-static bool Load_GL_EXT_transform_feedback(bool usePlaceholder)
+static bool Load_GL_EXT_transform_feedback(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glBindBufferRange             );
     LOAD_GLPROC( glBeginTransformFeedback      );
@@ -492,7 +632,7 @@ static bool Load_GL_EXT_transform_feedback(bool usePlaceholder)
     return true;
 }
 
-static bool Load_GL_NV_transform_feedback(bool usePlaceholder)
+static bool Load_GL_NV_transform_feedback(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glBindBufferRangeNV           );
     LOAD_GLPROC( glBeginTransformFeedbackNV    );
@@ -503,7 +643,7 @@ static bool Load_GL_NV_transform_feedback(bool usePlaceholder)
     return true;
 }
 
-static bool Load_GL_ARB_sync(bool usePlaceholder)
+static bool Load_GL_ARB_sync(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glFenceSync      );
     LOAD_GLPROC( glIsSync         );
@@ -515,19 +655,19 @@ static bool Load_GL_ARB_sync(bool usePlaceholder)
     return true;
 }
 
-static bool Load_GL_ARB_internalformat_query(bool usePlaceholder)
+static bool Load_GL_ARB_internalformat_query(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glGetInternalformativ );
     return true;
 }
 
-static bool Load_GL_ARB_internalformat_query2(bool usePlaceholder)
+static bool Load_GL_ARB_internalformat_query2(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glGetInternalformati64v );
     return true;
 }
 
-static bool Load_GL_ARB_ES2_compatibility(bool usePlaceholder)
+static bool Load_GL_ARB_ES2_compatibility(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glReleaseShaderCompiler    );
     LOAD_GLPROC( glShaderBinary             );
@@ -537,13 +677,13 @@ static bool Load_GL_ARB_ES2_compatibility(bool usePlaceholder)
     return true;
 }
 
-static bool Load_GL_ARB_gl_spirv(bool usePlaceholder)
+static bool Load_GL_ARB_gl_spirv(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glSpecializeShader );
     return true;
 }
 
-static bool Load_GL_ARB_texture_storage(bool usePlaceholder)
+static bool Load_GL_ARB_texture_storage(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glTexStorage1D );
     LOAD_GLPROC( glTexStorage2D );
@@ -551,73 +691,103 @@ static bool Load_GL_ARB_texture_storage(bool usePlaceholder)
     return true;
 }
 
-static bool Load_GL_ARB_texture_storage_multisample(bool usePlaceholder)
+static bool Load_GL_ARB_texture_storage_multisample(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glTexStorage2DMultisample );
     LOAD_GLPROC( glTexStorage3DMultisample );
     return true;
 }
 
-static bool Load_GL_ARB_buffer_storage(bool usePlaceholder)
+static bool Load_GL_ARB_buffer_storage(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glBufferStorage );
     return true;
 }
 
-static bool Load_GL_ARB_copy_buffer(bool usePlaceholder)
+static bool Load_GL_ARB_map_buffer_range(GLProcLoadMode mode)
+{
+    LOAD_GLPROC( glMapBufferRange         );
+    LOAD_GLPROC( glFlushMappedBufferRange );
+    return true;
+}
+
+static bool Load_GL_ARB_copy_buffer(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glCopyBufferSubData );
     return true;
 }
 
-static bool Load_GL_ARB_polygon_offset_clamp(bool usePlaceholder)
+static bool Load_GL_ARB_polygon_offset_clamp(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glPolygonOffsetClamp );
     return true;
 }
 
-static bool Load_GL_ARB_texture_view(bool usePlaceholder)
+static bool Load_GL_ARB_texture_view(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glTextureView );
     return true;
 }
 
-static bool Load_GL_ARB_shader_image_load_store(bool usePlaceholder)
+static bool Load_GL_ARB_shader_image_load_store(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glBindImageTexture );
     LOAD_GLPROC( glMemoryBarrier    );
     return true;
 }
 
-static bool Load_GL_ARB_framebuffer_no_attachments(bool usePlaceholder)
+static bool Load_GL_ARB_framebuffer_no_attachments(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glFramebufferParameteri     );
     LOAD_GLPROC( glGetFramebufferParameteriv );
     return true;
 }
 
-static bool Load_GL_ARB_clear_buffer_object(bool usePlaceholder)
+static bool Load_GL_ARB_clear_buffer_object(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glClearBufferData    );
     LOAD_GLPROC( glClearBufferSubData );
     return true;
 }
 
-static bool Load_GL_ARB_draw_indirect(bool usePlaceholder)
+static bool Load_GL_ARB_draw_indirect(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glDrawArraysIndirect   );
     LOAD_GLPROC( glDrawElementsIndirect );
     return true;
 }
 
-static bool Load_GL_ARB_multi_draw_indirect(bool usePlaceholder)
+static bool Load_GL_ARB_multi_draw_indirect(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glMultiDrawArraysIndirect   );
     LOAD_GLPROC( glMultiDrawElementsIndirect );
     return true;
 }
 
-static bool Load_GL_ARB_direct_state_access(bool usePlaceholder)
+static bool Load_GL_ARB_parallel_shader_compile(GLProcLoadMode mode)
+{
+    LOAD_GLPROC( glMaxShaderCompilerThreadsARB );
+    return true;
+}
+
+static bool Load_GL_KHR_parallel_shader_compile(GLProcLoadMode mode)
+{
+    LOAD_GLPROC( glMaxShaderCompilerThreadsKHR );
+    return true;
+}
+
+static bool Load_GL_ARB_vertex_attrib_binding(GLProcLoadMode mode)
+{
+    LOAD_GLPROC( glBindVertexBuffer     );
+    LOAD_GLPROC( glVertexAttribFormat   );
+    LOAD_GLPROC( glVertexAttribIFormat  );
+    LOAD_GLPROC( glVertexAttribLFormat  );
+    LOAD_GLPROC( glVertexAttribBinding  );
+    LOAD_GLPROC( glVertexBindingDivisor );
+    return true;
+}
+
+static bool Load_GL_ARB_direct_state_access(GLProcLoadMode mode)
 {
     LOAD_GLPROC( glCreateTransformFeedbacks                 );
     LOAD_GLPROC( glTransformFeedbackBufferBase              );
@@ -719,6 +889,7 @@ static bool Load_GL_ARB_direct_state_access(bool usePlaceholder)
     return true;
 }
 
+#undef DEFER_GLPROC
 #undef LOAD_GLPROC_SIMPLE
 #undef LOAD_GLPROC
 
@@ -789,6 +960,10 @@ void LoadAllExtensions(GLExtensionList& extensions, bool coreProfile)
     if (g_extAlreadyLoaded)
         return;
 
+    #ifndef __APPLE__
+    std::lock_guard<std::mutex> guard { g_deferredExtMutex };
+    #endif
+
     #ifdef __APPLE__
 
     /* Enable OpenGL extension support by host MacOS version */
@@ -811,6 +986,7 @@ void LoadAllExtensions(GLExtensionList& extensions, bool coreProfile)
     ENABLE_GLEXT( ARB_tessellation_shader          );
     ENABLE_GLEXT( ARB_get_program_binary           );
     ENABLE_GLEXT( ARB_program_interface_query      );
+    ENABLE_GLEXT( ARB_separate_shader_objects      );
     ENABLE_GLEXT( EXT_gpu_shader4                  );
 
     /* Enable texture extensions */
@@ -839,6 +1015,7 @@ void LoadAllExtensions(GLExtensionList& extensions, bool coreProfile)
     ENABLE_GLEXT( EXT_transform_feedback           );
     ENABLE_GLEXT( ARB_sync                         );
     ENABLE_GLEXT( ARB_polygon_offset_clamp         );
+    ENABLE_GLEXT( ARB_map_buffer_range             );
     ENABLE_GLEXT( ARB_copy_buffer                  );
     ENABLE_GLEXT( ARB_draw_indirect                );
     ENABLE_GLEXT( ARB_multi_draw_indirect          );
@@ -853,30 +1030,34 @@ void LoadAllExtensions(GLExtensionList& extensions, bool coreProfile)
 
     #else
 
-    auto LoadExtension = [&](const std::string& extName, const std::function<bool(bool)>& extLoadingProc, GLExt extensionID) -> void
+    auto LoadExtension = [&](const std::string& extName, GLExtLoadingProc extLoadingProc, GLExt extensionID) -> void
     {
         /* Try to load OpenGL extension */
         auto it = extensions.find(extName);
         if (it != extensions.end())
         {
-            if (extLoadingProc(false))
+            /* Check all procedures up front, so HasExtension only returns true if all of them are available */
+            if (extLoadingProc(GLProcLoadMode::Check))
             {
+                /*
+                Defer loading of the extension procedures until each of them is used the first time,
+                since most applications only use a fraction of all extensions that are supported by the driver
+                */
+                extLoadingProc(GLProcLoadMode::Deferred);
+
                 /* Enable extension in registry */
                 RegisterExtension(extensionID);
                 it->second = true;
+                return;
             }
-            else
-            {
-                /* Loading extension failed */
-                Log::PostReport(Log::ReportType::Error, "failed to load OpenGL extension: " + extName);
-            }
+
+            /* Loading extension failed */
+            Log::PostReport(Log::ReportType::Error, "failed to load OpenGL extension: " + extName);
         }
+
         #ifdef LLGL_GL_ENABLE_EXT_PLACEHOLDERS
-        else
-        {
-            /* If failed, use dummy procedures to detect illegal use of OpenGL extension */
-            extLoadingProc(true);
-        }
+        /* If failed, use dummy procedures to detect illegal use of OpenGL extension */
+        extLoadingProc(GLProcLoadMode::Placeholder);
         #endif
     };
 
@@ -893,12 +1074,26 @@ void LoadAllExtensions(GLExtensionList& extensions, bool coreProfile)
     #define ENABLE_GLEXT(NAME) \
         EnableExtension("GL_" + std::string(#NAME), GLExt::NAME)
 
-    /* Add standard extensions */
+    /*
+    Add standard extensions: core profiles require at least OpenGL 3.2, and drivers don't report
+    the extensions that were promoted to core before that (e.g. Mesa doesn't report GL_EXT_blend_color)
+    */
     if (coreProfile)
     {
-        extensions[ "GL_ARB_shader_objects"       ] = false;
-        extensions[ "GL_ARB_vertex_buffer_object" ] = false;
-        extensions[ "GL_EXT_texture3D"            ] = false;
+        extensions[ "GL_ARB_shader_objects"            ] = false;
+        extensions[ "GL_ARB_vertex_buffer_object"      ] = false;
+        extensions[ "GL_EXT_texture3D"                 ] = false;
+        extensions[ "GL_ARB_multitexture"              ] = false; // GL 1.3
+        extensions[ "GL_ARB_texture_compression"       ] = false; // GL 1.3
+        extensions[ "GL_EXT_blend_color"               ] = false; // GL 1.4
+        extensions[ "GL_EXT_blend_minmax"              ] = false; // GL 1.4
+        extensions[ "GL_EXT_blend_func_separate"       ] = false; // GL 1.4
+        extensions[ "GL_ARB_occlusion_query"           ] = false; // GL 1.5
+        extensions[ "GL_EXT_blend_equation_separate"   ] = false; // GL 2.0
+        extensions[ "GL_ARB_draw_buffers"              ] = false; // GL 2.0
+        extensions[ "GL_EXT_gpu_shader4"               ] = false; // GL 3.0
+        extensions[ "GL_EXT_draw_buffers2"             ] = false; // GL 3.0
+        extensions[ "GL_EXT_transform_feedback"        ] = false; // GL 3.0
     }
 
     /* Load hardware buffer extensions */
@@ -920,6 +1115,7 @@ void LoadAllExtensions(GLExtensionList& extensions, bool coreProfile)
     LOAD_GLEXT( ARB_compute_shader               );
     LOAD_GLEXT( ARB_get_program_binary           );
     LOAD_GLEXT( ARB_program_interface_query      );
+    LOAD_GLEXT( ARB_separate_shader_objects      );
     LOAD_GLEXT( EXT_gpu_shader4                  );
 
     /* Load texture extensions */
@@ -958,6 +1154,7 @@ void LoadAllExtensions(GLExtensionList& extensions, bool coreProfile)
     LOAD_GLEXT( ARB_texture_storage              );
     LOAD_GLEXT( ARB_texture_storage_multisample  );
     LOAD_GLEXT( ARB_buffer_storage               );
+    LOAD_GLEXT( ARB_map_buffer_range             );
     LOAD_GLEXT( ARB_copy_buffer                  );
     LOAD_GLEXT( ARB_polygon_offset_clamp         );
     LOAD_GLEXT( ARB_texture_view                 );
@@ -966,6 +1163,9 @@ void LoadAllExtensions(GLExtensionList& extensions, bool coreProfile)
     LOAD_GLEXT( ARB_clear_buffer_object          );
     LOAD_GLEXT( ARB_draw_indirect                );
     LOAD_GLEXT( ARB_multi_draw_indirect          );
+    LOAD_GLEXT( ARB_parallel_shader_compile      );
+    LOAD_GLEXT( KHR_parallel_shader_compile      );
+    LOAD_GLEXT( ARB_vertex_attrib_binding        );
     #ifdef LLGL_GL_ENABLE_DSA_EXT
     LOAD_GLEXT( ARB_direct_state_access          );
     #endif
@@ -978,6 +1178,7 @@ void LoadAllExtensions(GLExtensionList& extensions, bool coreProfile)
     ENABLE_GLEXT( NV_conservative_raster           );
     ENABLE_GLEXT( INTEL_conservative_rasterization );
     ENABLE_GLEXT( ARB_pipeline_statistics_query    );
+    ENABLE_GLEXT( ARB_query_buffer_object          );
 
     #undef LOAD_GLEXT
     #undef ENABLE_GLEXT
@@ -32,10 +32,10 @@ The hash-map can be used for faster single-extension queries.
 GLExtensionList QueryExtensions(bool coreProfile);
 
 /**
-Loads all available extensions and prints errors if an extension is available,
-but their respective functions could not be loaded.
+Registers all available extensions. The functions of each extension are loaded on first use,
+and an error is printed if an extension is available, but its respective functions could not be loaded.
 \param[in,out] extensions Specifies the extension map. This can be queried by the "QueryExtensions" function.
-The respective entry will be set to true if all its functions have been loaded successfully.
+The respective entry will be set to true if the extension has been registered for loading.
 \see QueryExtensions
 */
 void LoadAllExtensions(GLExtensionList& extensions, bool coreProfile);
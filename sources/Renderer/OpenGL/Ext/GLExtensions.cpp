@@ -200,6 +200,7 @@ PFNGLDRAWELEMENTSINSTANCEDPROC                          glDrawElementsInstanced
 
 PFNGLDRAWELEMENTSBASEVERTEXPROC                         glDrawElementsBaseVertex                        = nullptr;
 PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC                glDrawElementsInstancedBaseVertex               = nullptr;
+PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC                    glMultiDrawElementsBaseVertex                   = nullptr;
 
 /* GL_ARB_base_instance */
 
@@ -267,6 +268,17 @@ PFNGLGETPROGRAMBINARYPROC                               glGetProgramBinary
 PFNGLPROGRAMBINARYPROC                                  glProgramBinary                                 = nullptr;
 PFNGLPROGRAMPARAMETERIPROC                              glProgramParameteri                             = nullptr;
 
+/* GL_ARB_separate_shader_objects */
+
+PFNGLUSEPROGRAMSTAGESPROC                               glUseProgramStages                              = nullptr;
+PFNGLACTIVESHADERPROGRAMPROC                            glActiveShaderProgram                           = nullptr;
+PFNGLBINDPROGRAMPIPELINEPROC                            glBindProgramPipeline                           = nullptr;
+PFNGLDELETEPROGRAMPIPELINESPROC                         glDeleteProgramPipelines                        = nullptr;
+PFNGLGENPROGRAMPIPELINESPROC                            glGenProgramPipelines                           = nullptr;
+PFNGLGETPROGRAMPIPELINEIVPROC                           glGetProgramPipelineiv                          = nullptr;
+PFNGLVALIDATEPROGRAMPIPELINEPROC                        glValidateProgramPipeline                       = nullptr;
+PFNGLGETPROGRAMPIPELINEINFOLOGPROC                      glGetProgramPipelineInfoLog                     = nullptr;
+
 /* GL_ARB_program_interface_query */
 
 PFNGLGETPROGRAMINTERFACEIVPROC                          glGetProgramInterfaceiv                         = nullptr;
@@ -390,6 +402,11 @@ PFNGLTEXSTORAGE3DMULTISAMPLEPROC                        glTexStorage3DMultisampl
 
 PFNGLBUFFERSTORAGEPROC                                  glBufferStorage                                 = nullptr;
 
+/* GL_ARB_map_buffer_range */
+
+PFNGLMAPBUFFERRANGEPROC                                 glMapBufferRange                                = nullptr;
+PFNGLFLUSHMAPPEDBUFFERRANGEPROC                         glFlushMappedBufferRange                        = nullptr;
+
 /* ARB_copy_buffer */
 
 PFNGLCOPYBUFFERSUBDATAPROC                              glCopyBufferSubData                             = nullptr;
@@ -427,6 +444,23 @@ PFNGLDRAWELEMENTSINDIRECTPROC                           glDrawElementsIndirect
 PFNGLMULTIDRAWARRAYSINDIRECTPROC                        glMultiDrawArraysIndirect                       = nullptr;
 PFNGLMULTIDRAWELEMENTSINDIRECTPROC                      glMultiDrawElementsIndirect                     = nullptr;
 
+/* GL_ARB_parallel_shader_compile */
+
+PFNGLMAXSHADERCOMPILERTHREADSARBPROC                    glMaxShaderCompilerThreadsARB                   = nullptr;
+
+/* GL_KHR_parallel_shader_compile */
+
+PFNGLMAXSHADERCOMPILERTHREADSKHRPROC                    glMaxShaderCompilerThreadsKHR                   = nullptr;
+
+/* GL_ARB_vertex_attrib_binding */
+
+PFNGLBINDVERTEXBUFFERPROC                               glBindVertexBuffer                              = nullptr;
+PFNGLVERTEXATTRIBFORMATPROC                             glVertexAttribFormat                            = nullptr;
+PFNGLVERTEXATTRIBIFORMATPROC                            glVertexAttribIFormat                           = nullptr;
+PFNGLVERTEXATTRIBLFORMATPROC                            glVertexAttribLFormat                           = nullptr;
+PFNGLVERTEXATTRIBBINDINGPROC                            glVertexAttribBinding                           = nullptr;
+PFNGLVERTEXBINDINGDIVISORPROC                           glVertexBindingDivisor                          = nullptr;
+
 /* GL_ARB_direct_state_access */
 
 PFNGLCREATETRANSFORMFEEDBACKSPROC                       glCreateTransformFeedbacks                      = nullptr;
@@ -203,6 +203,7 @@ extern PFNGLDRAWELEMENTSINSTANCEDPROC                       glDrawElementsInstan
 
 extern PFNGLDRAWELEMENTSBASEVERTEXPROC                      glDrawElementsBaseVertex;
 extern PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC             glDrawElementsInstancedBaseVertex;
+extern PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC                 glMultiDrawElementsBaseVertex;
 
 /* GL_ARB_base_instance */
 
@@ -270,6 +271,17 @@ extern PFNGLGETPROGRAMBINARYPROC                            glGetProgramBinary;
 extern PFNGLPROGRAMBINARYPROC                               glProgramBinary;
 extern PFNGLPROGRAMPARAMETERIPROC                           glProgramParameteri;
 
+/* GL_ARB_separate_shader_objects */
+
+extern PFNGLUSEPROGRAMSTAGESPROC                            glUseProgramStages;
+extern PFNGLACTIVESHADERPROGRAMPROC                         glActiveShaderProgram;
+extern PFNGLBINDPROGRAMPIPELINEPROC                         glBindProgramPipeline;
+extern PFNGLDELETEPROGRAMPIPELINESPROC                      glDeleteProgramPipelines;
+extern PFNGLGENPROGRAMPIPELINESPROC                         glGenProgramPipelines;
+extern PFNGLGETPROGRAMPIPELINEIVPROC                        glGetProgramPipelineiv;
+extern PFNGLVALIDATEPROGRAMPIPELINEPROC                     glValidateProgramPipeline;
+extern PFNGLGETPROGRAMPIPELINEINFOLOGPROC                   glGetProgramPipelineInfoLog;
+
 /* GL_ARB_program_interface_query */
 
 extern PFNGLGETPROGRAMINTERFACEIVPROC                       glGetProgramInterfaceiv;
@@ -393,6 +405,11 @@ extern PFNGLTEXSTORAGE3DMULTISAMPLEPROC                     glTexStorage3DMultis
 
 extern PFNGLBUFFERSTORAGEPROC                               glBufferStorage;
 
+/* GL_ARB_map_buffer_range */
+
+extern PFNGLMAPBUFFERRANGEPROC                              glMapBufferRange;
+extern PFNGLFLUSHMAPPEDBUFFERRANGEPROC                      glFlushMappedBufferRange;
+
 /* ARB_copy_buffer */
 
 extern PFNGLCOPYBUFFERSUBDATAPROC                           glCopyBufferSubData;
@@ -430,6 +447,23 @@ extern PFNGLDRAWELEMENTSINDIRECTPROC                        glDrawElementsIndire
 extern PFNGLMULTIDRAWARRAYSINDIRECTPROC                     glMultiDrawArraysIndirect;
 extern PFNGLMULTIDRAWELEMENTSINDIRECTPROC                   glMultiDrawElementsIndirect;
 
+/* GL_ARB_parallel_shader_compile */
+
+extern PFNGLMAXSHADERCOMPILERTHREADSARBPROC                 glMaxShaderCompilerThreadsARB;
+
+/* GL_KHR_parallel_shader_compile */
+
+extern PFNGLMAXSHADERCOMPILERTHREADSKHRPROC                 glMaxShaderCompilerThreadsKHR;
+
+/* GL_ARB_vertex_attrib_binding */
+
+extern PFNGLBINDVERTEXBUFFERPROC                            glBindVertexBuffer;
+extern PFNGLVERTEXATTRIBFORMATPROC                          glVertexAttribFormat;
+extern PFNGLVERTEXATTRIBIFORMATPROC                         glVertexAttribIFormat;
+extern PFNGLVERTEXATTRIBLFORMATPROC                         glVertexAttribLFormat;
+extern PFNGLVERTEXATTRIBBINDINGPROC                         glVertexAttribBinding;
+extern PFNGLVERTEXBINDINGDIVISORPROC                        glVertexBindingDivisor;
+
 /* GL_ARB_direct_state_access */
 
 extern PFNGLCREATETRANSFORMFEEDBACKSPROC                    glCreateTransformFeedbacks;
@@ -230,6 +230,7 @@ DECL_GLPROC(void, glDrawElementsInstanced, (GLenum, GLsizei, GLenum, const void*
 
 DECL_GLPROC(void, glDrawElementsBaseVertex, (GLenum, GLsizei, GLenum, const void*, GLint));
 DECL_GLPROC(void, glDrawElementsInstancedBaseVertex, (GLenum, GLsizei, GLenum, const void*, GLsizei, GLint));
+DECL_GLPROC(void, glMultiDrawElementsBaseVertex, (GLenum, const GLsizei*, GLenum, const void* const*, GLsizei, const GLint*));
 
 /* GL_ARB_base_instance */
 
@@ -297,6 +298,17 @@ DECL_GLPROC(void, glGetProgramBinary, (GLuint, GLsizei, GLsizei*, GLenum*, void*
 DECL_GLPROC(void, glProgramBinary, (GLuint, GLenum, const void*, GLsizei));
 DECL_GLPROC(void, glProgramParameteri, (GLuint, GLenum, GLint));
 
+/* GL_ARB_separate_shader_objects */
+
+DECL_GLPROC(void, glUseProgramStages, (GLuint, GLbitfield, GLuint));
+DECL_GLPROC(void, glActiveShaderProgram, (GLuint, GLuint));
+DECL_GLPROC(void, glBindProgramPipeline, (GLuint));
+DECL_GLPROC(void, glDeleteProgramPipelines, (GLsizei, const GLuint*));
+DECL_GLPROC(void, glGenProgramPipelines, (GLsizei, GLuint*));
+DECL_GLPROC(void, glGetProgramPipelineiv, (GLuint, GLenum, GLint*));
+DECL_GLPROC(void, glValidateProgramPipeline, (GLuint));
+DECL_GLPROC(void, glGetProgramPipelineInfoLog, (GLuint, GLsizei, GLsizei*, GLchar*));
+
 /* GL_ARB_program_interface_query */
 
 DECL_GLPROC(void, glGetProgramInterfaceiv, (GLuint, GLenum, GLenum, GLint*));
@@ -420,6 +432,11 @@ DECL_GLPROC(void, glTexStorage3DMultisample, (GLenum, GLsizei, GLenum, GLsizei,
 
 DECL_GLPROC(void, glBufferStorage, (GLenum, GLsizeiptr, const void*, GLbitfield));
 
+/* GL_ARB_map_buffer_range */
+
+DECL_GLPROC(void*, glMapBufferRange, (GLenum, GLintptr, GLsizeiptr, GLbitfield));
+DECL_GLPROC(void, glFlushMappedBufferRange, (GLenum, GLintptr, GLsizeiptr));
+
 /* ARB_copy_buffer */
 
 DECL_GLPROC(void, glCopyBufferSubData, (GLenum, GLenum, GLintptr, GLintptr, GLsizeiptr));
@@ -457,6 +474,23 @@ DECL_GLPROC(void, glDrawElementsIndirect, (GLenum, GLenum, const void*));
 DECL_GLPROC(void, glMultiDrawArraysIndirect, (GLenum, const void*, GLsizei, GLsizei));
 DECL_GLPROC(void, glMultiDrawElementsIndirect, (GLenum, GLenum, const void*, GLsizei, GLsizei));
 
+/* GL_ARB_parallel_shader_compile */
+
+DECL_GLPROC(void, glMaxShaderCompilerThreadsARB, (GLuint));
+
+/* GL_KHR_parallel_shader_compile */
+
+DECL_GLPROC(void, glMaxShaderCompilerThreadsKHR, (GLuint));
+
+/* GL_ARB_vertex_attrib_binding */
+
+DECL_GLPROC(void, glBindVertexBuffer, (GLuint, GLuint, GLintptr, GLsizei));
+DECL_GLPROC(void, glVertexAttribFormat, (GLuint, GLint, GLenum, GLboolean, GLuint));
+DECL_GLPROC(void, glVertexAttribIFormat, (GLuint, GLint, GLenum, GLuint));
+DECL_GLPROC(void, glVertexAttribLFormat, (GLuint, GLint, GLenum, GLuint));
+DECL_GLPROC(void, glVertexAttribBinding, (GLuint, GLuint));
+DECL_GLPROC(void, glVertexBindingDivisor, (GLuint, GLuint));
+
 /* GL_ARB_direct_state_access */
 
 DECL_GLPROC(void, glCreateTransformFeedbacks, (GLsizei, GLuint*));
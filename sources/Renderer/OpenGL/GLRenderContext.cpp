@@ -6,22 +6,58 @@
  */
 
 #include "GLRenderContext.h"
+#include "Command/GLRenderThread.h"
+#include "Buffer/GLUploadRing.h"
+#include "../GLCommon/GLExtensionRegistry.h"
+#include <cstdlib>
+
+#ifdef __linux__
+#include "Platform/Linux/LinuxGLOffscreenSurface.h"
+#endif
 
 
 namespace LLGL
 {
 
 
-GLRenderContext::GLRenderContext(RenderContextDescriptor desc, const std::shared_ptr<Surface>& surface, GLRenderContext* sharedRenderContext) :
-    RenderContext  { desc.videoMode, desc.vsync                           },
-    contextHeight_ { static_cast<GLint>(desc.videoMode.resolution.height) }
+GLRenderContext::GLRenderContext(RenderContextDescriptor desc, const std::shared_ptr<Surface>& surface, GLRenderContext* sharedRenderContext, bool headless) :
+    RenderContext       { desc.videoMode, desc.vsync                           },
+    contextHeight_      { static_cast<GLint>(desc.videoMode.resolution.height) },
+    maxFramesInFlight_  { desc.maxFramesInFlight                               }
 {
+    GLContext* sharedGLContext = (sharedRenderContext != nullptr ? sharedRenderContext->context_.get() : nullptr);
+
+    /* Headless contexts can only share their GL objects with other headless contexts */
+    if (sharedGLContext != nullptr)
+        headless = sharedGLContext->IsHeadless();
+
+    #if defined __linux__ && defined LLGL_GL_ENABLE_EGL
+
+    /* Fall back to a headless context if there is neither a surface nor an X display to create a window on */
+    if (!headless && !surface && std::getenv("DISPLAY") == nullptr)
+        headless = true;
+
+    #endif
+
     #ifdef __linux__
 
-    /* Setup surface for the render context and pass native context handle */
-    NativeContextHandle windowContext;
-    GetNativeContextHandle(windowContext, desc.videoMode, desc.multiSampling);
-    SetOrCreateSurface(surface, desc.videoMode, &windowContext);
+    if (headless)
+    {
+        /* Setup off-screen surface for the render context; fullscreen mode is not available without a display */
+        desc.videoMode.fullscreen = false;
+        SetOrCreateSurface(
+            (surface ? surface : std::make_shared<LinuxGLOffscreenSurface>(desc.videoMode.resolution)),
+            desc.videoMode,
+            nullptr
+        );
+    }
+    else
+    {
+        /* Setup surface for the render context and pass native context handle */
+        NativeContextHandle windowContext;
+        GetNativeContextHandle(windowContext, desc.videoMode, desc.multiSampling);
+        SetOrCreateSurface(surface, desc.videoMode, &windowContext);
+    }
 
     #else
 
@@ -34,11 +70,17 @@ GLRenderContext::GLRenderContext(RenderContextDescriptor desc, const std::shared
     desc.videoMode = GetVideoMode();
 
     /* Create platform dependent OpenGL context */
-    GLContext* sharedGLContext = (sharedRenderContext != nullptr ? sharedRenderContext->context_.get() : nullptr);
-    context_ = GLContext::Create(desc, GetSurface(), sharedGLContext);
+    if (headless)
+    {
+        context_ = GLContext::CreateHeadless(desc, sharedGLContext);
+        if (!context_)
+            throw std::runtime_error("headless OpenGL render contexts are not supported on this platform (requires LLGL_GL_ENABLE_EGL on Linux)");
+    }
+    else
+        context_ = GLContext::Create(desc, GetSurface(), sharedGLContext);
 
-    /* Setup swap interval (for v-sync) */
-    OnSetVsync(desc.vsync);
+    /* Setup swap interval (for v-sync) on the calling thread, since the new GL context is current on it */
+    context_->SetSwapInterval(GetSwapInterval(desc.vsync));
 
     /* Get state manager and notify about the current render context */
     stateMngr_ = context_->GetStateManager();
@@ -51,7 +93,33 @@ GLRenderContext::GLRenderContext(RenderContextDescriptor desc, const std::shared
 
 void GLRenderContext::Present()
 {
-    context_->SwapBuffers();
+    if (GLRenderThread::IsForwardingRequired())
+        GLRenderThread::Active()->Present(*this);
+    else
+    {
+        context_->SwapBuffers();
+
+        /* Limit the number of frames the CPU can be ahead of the GPU */
+        if (!frameFences_.empty())
+            WaitForFrameInFlight();
+
+        /* Continue with next frame segment of the upload ring */
+        if (auto uploadRing = stateMngr_->GetUploadRing())
+            uploadRing->NextFrame();
+
+        /* Start new frame for resource binding statistics */
+        stateMngr_->NextFrame();
+    }
+
+    /*
+    Advance frame index on the application thread only, i.e. not when this is called again by the render thread.
+    The render thread throttles the application thread by itself if too many frames are queued (see GLRenderThread::Present),
+    so the application thread can be up to GLRenderThread::g_maxQueuedFrames frames ahead of the fence ring.
+    This is not an issue for buffer updates and mappings, because they are forwarded to the render thread,
+    which has waited for the respective frame fence by the time it executes them.
+    */
+    if (!frameFences_.empty() && (GLRenderThread::Active() == nullptr || GLRenderThread::IsForwardingRequired()))
+        currentFrame_ = (currentFrame_ + 1) % static_cast<std::uint32_t>(frameFences_.size());
 }
 
 Format GLRenderContext::QueryColorFormat() const
@@ -66,6 +134,29 @@ Format GLRenderContext::QueryDepthStencilFormat() const
     return Format::D24UNormS8UInt;
 }
 
+std::uint32_t GLRenderContext::GetCurrentFrame() const
+{
+    return currentFrame_;
+}
+
+void GLRenderContext::CreateFrameFences()
+{
+    /* Without sync objects, GLFence::Wait falls back to glFinish, which would serialize CPU and GPU entirely; keep the frame index at 0 */
+    if (maxFramesInFlight_ > 0 && HasExtension(GLExt::ARB_sync))
+    {
+        frameFences_ = std::vector<GLFence>(maxFramesInFlight_);
+        frameFencesPending_.resize(maxFramesInFlight_, false);
+    }
+}
+
+bool GLRenderContext::QueryResourceBindingStatistics(ResourceBindingStatistics& stats) const
+{
+    /* Statistics are written by the GL thread */
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(QueryResourceBindingStatistics(stats));
+    stats = stateMngr_->GetResourceBindingStats();
+    return true;
+}
+
 const RenderPass* GLRenderContext::GetRenderPass() const
 {
     return nullptr; // dummy
@@ -89,14 +180,27 @@ bool GLRenderContext::GLMakeCurrent(GLRenderContext* renderContext)
  * ======= Private: =======
  */
 
-bool GLRenderContext::OnSetVideoMode(const VideoModeDescriptor& videoModeDesc)
+int GLRenderContext::GetSwapInterval(const VsyncDescriptor& vsyncDesc)
 {
+    return (vsyncDesc.enabled ? static_cast<int>(vsyncDesc.interval) : 0);
+}
+
+void GLRenderContext::ResizeGLContext(const Extent2D& resolution)
+{
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(ResizeGLContext(resolution));
+
     /* Update context height */
-    contextHeight_ = static_cast<GLint>(videoModeDesc.resolution.height);
+    contextHeight_ = static_cast<GLint>(resolution.height);
     stateMngr_->NotifyRenderTargetHeight(contextHeight_);
 
     /* Notify GL context of a resize */
-    context_->Resize(videoModeDesc.resolution);
+    context_->Resize(resolution);
+}
+
+bool GLRenderContext::OnSetVideoMode(const VideoModeDescriptor& videoModeDesc)
+{
+    /* Resize GL context (on the render thread if there is one) */
+    ResizeGLContext(videoModeDesc.resolution);
 
     /* Switch fullscreen mode */
     if (!SwitchFullscreenMode(videoModeDesc))
@@ -107,8 +211,8 @@ bool GLRenderContext::OnSetVideoMode(const VideoModeDescriptor& videoModeDesc)
 
 bool GLRenderContext::OnSetVsync(const VsyncDescriptor& vsyncDesc)
 {
-    int swapInterval = (vsyncDesc.enabled ? static_cast<int>(vsyncDesc.interval) : 0);
-    return context_->SetSwapInterval(swapInterval);
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(OnSetVsync(vsyncDesc));
+    return context_->SetSwapInterval(GetSwapInterval(vsyncDesc));
 }
 
 void GLRenderContext::InitRenderStates()
@@ -128,6 +232,22 @@ void GLRenderContext::InitRenderStates()
     //glPixelStorei(GL_PACK_ALIGNMENT, 1); //???
 }
 
+void GLRenderContext::WaitForFrameInFlight()
+{
+    /* Fence the frame that has just been presented */
+    frameFences_[frameFenceIndex_].Submit();
+    frameFencesPending_[frameFenceIndex_] = true;
+
+    /* Continue with the next slot and wait until the GPU has finished the frame that was presented in that slot */
+    frameFenceIndex_ = (frameFenceIndex_ + 1) % static_cast<std::uint32_t>(frameFences_.size());
+
+    if (frameFencesPending_[frameFenceIndex_])
+    {
+        frameFences_[frameFenceIndex_].Wait(~0ull);
+        frameFencesPending_[frameFenceIndex_] = false;
+    }
+}
+
 
 } // /namespace LLGL
 
@@ -13,8 +13,10 @@
 #include <LLGL/RenderContext.h>
 #include "OpenGL.h"
 #include "RenderState/GLStateManager.h"
+#include "RenderState/GLFence.h"
 #include "Platform/GLContext.h"
 #include <memory>
+#include <vector>
 
 #ifdef __linux__
 #include <LLGL/Platform/NativeHandle.h>
@@ -34,13 +36,21 @@ class GLRenderContext final : public RenderContext
 
         /* ----- Common ----- */
 
-        GLRenderContext(RenderContextDescriptor desc, const std::shared_ptr<Surface>& surface, GLRenderContext* sharedRenderContext);
+        /*
+        Creates a render context for the specified surface. If 'headless' is true, the GL context renders into an off-screen surface
+        without a display server (see RenderSystemConfiguration::headlessRenderContexts).
+        */
+        GLRenderContext(RenderContextDescriptor desc, const std::shared_ptr<Surface>& surface, GLRenderContext* sharedRenderContext, bool headless = false);
 
         void Present() override;
 
         Format QueryColorFormat() const override;
         Format QueryDepthStencilFormat() const override;
 
+        std::uint32_t GetCurrentFrame() const override;
+
+        bool QueryResourceBindingStatistics(ResourceBindingStatistics& stats) const override;
+
         const RenderPass* GetRenderPass() const override;
 
         /* ----- GLRenderContext specific functions ----- */
@@ -52,6 +62,15 @@ class GLRenderContext final : public RenderContext
             return stateMngr_;
         }
 
+        // Returns the platform specific GL context.
+        inline GLContext& GetGLContext() const
+        {
+            return *context_;
+        }
+
+        // Creates the fence ring to limit the frames in flight. Must be called once after the GL extensions have been loaded (used by GLRenderSystem).
+        void CreateFrameFences();
+
     private:
 
         struct RenderState
@@ -64,8 +83,15 @@ class GLRenderContext final : public RenderContext
         bool OnSetVideoMode(const VideoModeDescriptor& videoModeDesc) override;
         bool OnSetVsync(const VsyncDescriptor& vsyncDesc) override;
 
+        static int GetSwapInterval(const VsyncDescriptor& vsyncDesc);
+
+        void ResizeGLContext(const Extent2D& resolution);
+
         void InitRenderStates();
 
+        // Submits the fence for the presented frame and blocks until the GPU has finished the frame that occupies the next slot of the ring.
+        void WaitForFrameInFlight();
+
         #ifdef __linux__
         void GetNativeContextHandle(
             NativeContextHandle& windowContext,
@@ -79,7 +105,16 @@ class GLRenderContext final : public RenderContext
         std::shared_ptr<GLStateManager> stateMngr_;
         RenderState                     renderState_;
 
-        GLint                           contextHeight_  = 0;
+        GLint                           contextHeight_      = 0;
+
+        // Frame index on the application thread (see GetCurrentFrame). Remains 0 if the fence ring is empty.
+        std::uint32_t                   currentFrame_       = 0;
+        std::uint32_t                   maxFramesInFlight_  = 0;
+
+        // Fence ring on the GL thread, one fence per frame in flight. Empty if the frames in flight are not limited or GL_ARB_sync is not supported.
+        std::vector<GLFence>            frameFences_;
+        std::vector<bool>               frameFencesPending_;
+        std::uint32_t                   frameFenceIndex_    = 0;
 
 };
 
@@ -15,17 +15,23 @@
 
 #include "Command/GLCommandQueue.h"
 #include "Command/GLCommandBuffer.h"
+#include "Command/GLRenderThread.h"
 #include "GLRenderContext.h"
 
 #include "Buffer/GLBuffer.h"
 #include "Buffer/GLBufferArray.h"
+#include "Buffer/GLUploadRing.h"
 
 #include "Shader/GLShader.h"
 #include "Shader/GLShaderProgram.h"
+#include "Shader/GLProgramBinaryCache.h"
 
 #include "Texture/GLTexture.h"
 #include "Texture/GLSampler.h"
 #include "Texture/GLRenderTarget.h"
+#include "Texture/GLReadbackRing.h"
+#include "Texture/GLTextureLoader.h"
+#include "Texture/GLMipGenerator.h"
 
 #include "RenderState/GLQueryHeap.h"
 #include "RenderState/GLFence.h"
@@ -90,6 +96,9 @@ class GLRenderSystem final : public RenderSystem
         void* MapBuffer(Buffer& buffer, const CPUAccess access) override;
         void UnmapBuffer(Buffer& buffer) override;
 
+        void* MapBufferRange(Buffer& buffer, std::uint64_t offset, std::uint64_t size, long flags) override;
+        void FlushMappedBufferRange(Buffer& buffer, std::uint64_t offset, std::uint64_t size) override;
+
         /* ----- Textures ----- */
 
         Texture* CreateTexture(const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc = nullptr) override;
@@ -99,9 +108,16 @@ class GLRenderSystem final : public RenderSystem
         void WriteTexture(Texture& texture, const TextureRegion& textureRegion, const SrcImageDescriptor& imageDesc) override;
         void ReadTexture(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc) override;
 
+        bool IsTextureResident(const Texture& texture) override;
+
         void GenerateMips(Texture& texture) override;
         void GenerateMips(Texture& texture, std::uint32_t baseMipLevel, std::uint32_t numMipLevels, std::uint32_t baseArrayLayer = 0, std::uint32_t numArrayLayers = 1) override;
 
+        std::uint64_t ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel, ImageFormat format, DataType dataType) override;
+        bool QueryReadback(std::uint64_t ticket, bool wait = false) override;
+        const void* MapReadback(std::uint64_t ticket, std::size_t& dataSize) override;
+        void ReleaseReadback(std::uint64_t ticket) override;
+
         /* ----- Sampler States ---- */
 
         Sampler* CreateSampler(const SamplerDescriptor& desc) override;
@@ -130,6 +146,7 @@ class GLRenderSystem final : public RenderSystem
 
         Shader* CreateShader(const ShaderDescriptor& desc) override;
         ShaderProgram* CreateShaderProgram(const ShaderProgramDescriptor& desc) override;
+        void CreateShaderPrograms(std::uint32_t numShaderPrograms, const ShaderProgramDescriptor* descs, ShaderProgram** shaderPrograms) override;
 
         void Release(Shader& shader) override;
         void Release(ShaderProgram& shaderProgram) override;
@@ -148,6 +165,8 @@ class GLRenderSystem final : public RenderSystem
         void Release(GraphicsPipeline& graphicsPipeline) override;
         void Release(ComputePipeline& computePipeline) override;
 
+        bool QueryPipelineStateCacheStatistics(PipelineStateCacheStatistics& stats) const override;
+
         /* ----- Queries ----- */
 
         QueryHeap* CreateQueryHeap(const QueryHeapDescriptor& desc) override;
@@ -176,26 +195,27 @@ class GLRenderSystem final : public RenderSystem
 
         GLRenderContext* GetSharedRenderContext() const;
 
+        // Makes the specified render context no longer current on the calling thread, so it can be made current on the render thread.
+        void ReleaseFromCallingThread(GLRenderContext& renderContext);
+
         GLBuffer* CreateGLBuffer(const BufferDescriptor& desc, const void* initialData);
 
+        // Returns the texture loader for asynchronous uploads, or null if it is not supported.
+        GLTextureLoader* GetOrCreateTextureLoader();
+
+        // Returns the program binary cache, or null if no cache directory is configured or program binaries are not supported.
+        GLProgramBinaryCache* GetOrCreateProgramBinaryCache();
+
+        // Returns the linkage for the specified shader program (see RenderSystemConfiguration::separableShaderPrograms).
+        GLProgramLinkage GetShaderProgramLinkage(const ShaderProgramDescriptor& desc) const;
+
+        // Returns the compute shader based MIP-map generator, or null if it is not supported.
+        GLMipGenerator* GetOrCreateMipGenerator();
+
         void GenerateMipsPrimary(GLuint texID, const TextureType texType);
         void GenerateSubMipsWithFBO(GLTexture& textureGL, const Extent3D& extent, GLint baseMipLevel, GLint numMipLevels, GLint baseArrayLayer, GLint numArrayLayers);
         void GenerateSubMipsWithTextureView(GLTexture& textureGL, GLuint baseMipLevel, GLuint numMipLevels, GLuint baseArrayLayer, GLuint numArrayLayers);
 
-    private:
-    
-        #ifdef LLGL_ENABLE_CUSTOM_SUB_MIPGEN
-        struct MipGenerationFBOPair
-        {
-            ~MipGenerationFBOPair();
-
-            void CreateFBOs();
-            void ReleaseFBOs();
-
-            GLuint fbos[2] = { 0, 0 };
-        };
-        #endif // /LLGL_ENABLE_CUSTOM_SUB_MIPGEN
-    
     private:
 
         /* ----- Hardware object containers ----- */
@@ -220,9 +240,12 @@ class GLRenderSystem final : public RenderSystem
 
         DebugCallback                           debugCallback_;
 
-        #ifdef LLGL_ENABLE_CUSTOM_SUB_MIPGEN
-        MipGenerationFBOPair                    mipGenerationFBOPair_;
-        #endif // /LLGL_ENABLE_CUSTOM_SUB_MIPGEN
+        std::unique_ptr<GLRenderThread>         renderThread_;
+        std::unique_ptr<GLUploadRing>           uploadRing_;
+        std::unique_ptr<GLReadbackRing>         readbackRing_;
+        std::unique_ptr<GLTextureLoader>        textureLoader_;
+        std::unique_ptr<GLProgramBinaryCache>   programBinaryCache_;
+        std::unique_ptr<GLMipGenerator>         mipGenerator_;
 
 };
 
@@ -60,6 +60,8 @@ static void GLBufferStorage(GLBuffer& bufferGL, const BufferDescriptor& desc, co
 
 Buffer* GLRenderSystem::CreateBuffer(const BufferDescriptor& desc, const void* initialData)
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(CreateBuffer(desc, initialData));
+
     AssertCreateBuffer(desc, static_cast<std::uint64_t>(std::numeric_limits<GLsizeiptr>::max()));
 
     auto bufferGL = CreateGLBuffer(desc, initialData);
@@ -98,6 +100,8 @@ GLBuffer* GLRenderSystem::CreateGLBuffer(const BufferDescriptor& desc, const voi
 
 BufferArray* GLRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer* const * bufferArray)
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(CreateBufferArray(numBuffers, bufferArray));
+
     AssertCreateBufferArray(numBuffers, bufferArray);
 
     auto refBindFlags = bufferArray[0]->GetBindFlags();
@@ -114,32 +118,93 @@ BufferArray* GLRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer*
 
 void GLRenderSystem::Release(Buffer& buffer)
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(Release(buffer));
+
     RemoveFromUniqueSet(buffers_, &buffer);
 }
 
 void GLRenderSystem::Release(BufferArray& bufferArray)
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(Release(bufferArray));
+
     RemoveFromUniqueSet(bufferArrays_, &bufferArray);
 }
 
 void GLRenderSystem::WriteBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, const void* data, std::uint64_t dataSize)
 {
     auto& dstBufferGL = LLGL_CAST(GLBuffer&, dstBuffer);
+
+    /* Copy data into command ring of render thread, or forward synchronously if it's too large */
+    if (GLRenderThread::IsForwardingRequired())
+    {
+        if (GLRenderThread::Active()->UpdateBuffer(dstBufferGL, static_cast<GLintptr>(dstOffset), data, static_cast<GLsizeiptr>(dataSize)))
+            return;
+        LLGL_GL_FORWARD_TO_RENDER_THREAD(WriteBuffer(dstBuffer, dstOffset, data, dataSize));
+    }
+
     dstBufferGL.BufferSubData(static_cast<GLintptr>(dstOffset), static_cast<GLsizeiptr>(dataSize), data);
 }
 
 void* GLRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access)
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(MapBuffer(buffer, access));
+
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
     return bufferGL.MapBuffer(GLTypes::Map(access));
 }
 
 void GLRenderSystem::UnmapBuffer(Buffer& buffer)
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(UnmapBuffer(buffer));
+
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
     bufferGL.UnmapBuffer();
 }
 
+static GLbitfield GetGLMapBufferRangeFlags(long flags)
+{
+    GLbitfield flagsGL = 0;
+
+    if ((flags & MapBufferFlags::Read) != 0)
+        flagsGL |= GL_MAP_READ_BIT;
+    if ((flags & MapBufferFlags::Write) != 0)
+        flagsGL |= GL_MAP_WRITE_BIT;
+    if ((flags & MapBufferFlags::InvalidateRange) != 0)
+        flagsGL |= GL_MAP_INVALIDATE_RANGE_BIT;
+    if ((flags & MapBufferFlags::InvalidateBuffer) != 0)
+        flagsGL |= GL_MAP_INVALIDATE_BUFFER_BIT;
+    if ((flags & MapBufferFlags::FlushExplicit) != 0)
+        flagsGL |= GL_MAP_FLUSH_EXPLICIT_BIT;
+    if ((flags & MapBufferFlags::Unsynchronized) != 0)
+        flagsGL |= GL_MAP_UNSYNCHRONIZED_BIT;
+
+    return flagsGL;
+}
+
+void* GLRenderSystem::MapBufferRange(Buffer& buffer, std::uint64_t offset, std::uint64_t size, long flags)
+{
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(MapBufferRange(buffer, offset, size, flags));
+
+    auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
+
+    /* Fall back to mapping the entire buffer if ranged mapping is not supported */
+    if (!HasExtension(GLExt::ARB_map_buffer_range))
+        return RenderSystem::MapBufferRange(buffer, offset, size, flags);
+
+    return bufferGL.MapBufferRange(static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size), GetGLMapBufferRangeFlags(flags));
+}
+
+void GLRenderSystem::FlushMappedBufferRange(Buffer& buffer, std::uint64_t offset, std::uint64_t size)
+{
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(FlushMappedBufferRange(buffer, offset, size));
+
+    if (HasExtension(GLExt::ARB_map_buffer_range))
+    {
+        auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
+        bufferGL.FlushMappedBufferRange(static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size));
+    }
+}
+
 
 } // /namespace LLGL
 
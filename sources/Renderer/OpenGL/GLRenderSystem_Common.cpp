@@ -25,8 +25,38 @@ namespace LLGL
 
 /* ----- Common ----- */
 
+// Size (in bytes) of the command ring of the dedicated render thread.
+static const std::size_t g_renderThreadRingSize = (4u << 20);
+
+// Size (in bytes) of each frame segment of the upload ring for small buffer updates.
+static const GLsizeiptr g_uploadRingSegmentSize = (2 << 20);
+
 GLRenderSystem::~GLRenderSystem()
 {
+    /* Stop render thread first, so all GL objects are released on the calling thread */
+    renderThread_.reset();
+
+    /* Release upload ring while its GL context is still alive */
+    if (uploadRing_)
+    {
+        if (auto sharedContext = GetSharedRenderContext())
+            sharedContext->GetStateManager()->SetUploadRing(nullptr);
+        uploadRing_.reset();
+    }
+
+    /* Release readback PBOs while their GL context is still alive */
+    readbackRing_.reset();
+
+    /* Release transient buffers of all state managers while their GL contexts are still alive */
+    for (auto& renderContext : renderContexts_)
+        renderContext->GetStateManager()->ReleaseTransientResources();
+
+    /* Stop texture loader before its shared GL context is destroyed */
+    textureLoader_.reset();
+
+    /* Report program binary cache statistics */
+    programBinaryCache_.reset();
+
     /* Clear all render state containers first, the rest will be deleted automatically */
     GLStatePool::Instance().Clear();
 }
@@ -47,11 +77,43 @@ GLRenderContext* GLRenderSystem::GetSharedRenderContext() const
 
 RenderContext* GLRenderSystem::CreateRenderContext(const RenderContextDescriptor& desc, const std::shared_ptr<Surface>& surface)
 {
-    return AddRenderContext(MakeUnique<GLRenderContext>(desc, surface, GetSharedRenderContext()), desc);
+    if (renderThread_)
+    {
+        /* Create render context on the calling thread (which owns the surface) and release its GL context for the render thread */
+        renderThread_->WaitIdle();
+        auto renderContext = MakeUnique<GLRenderContext>(desc, surface, GetSharedRenderContext(), GetConfiguration().headlessRenderContexts);
+        ReleaseFromCallingThread(*renderContext);
+
+        /* Finish initialization on the render thread */
+        return GLInvokeOnRenderThread(
+            [&]()
+            {
+                GLRenderContext::GLMakeCurrent(renderContext.get());
+                return AddRenderContext(std::move(renderContext), desc);
+            }
+        );
+    }
+
+    auto renderContext = AddRenderContext(
+        MakeUnique<GLRenderContext>(desc, surface, GetSharedRenderContext(), GetConfiguration().headlessRenderContexts),
+        desc
+    );
+
+    if (GetConfiguration().dedicatedRenderThread)
+    {
+        /* Hand over GL context of the first render context to a dedicated render thread */
+        auto& renderContextGL = LLGL_CAST(GLRenderContext&, *renderContext);
+        ReleaseFromCallingThread(renderContextGL);
+        renderThread_ = MakeUnique<GLRenderThread>(renderContextGL, g_renderThreadRingSize);
+    }
+
+    return renderContext;
 }
 
 void GLRenderSystem::Release(RenderContext& renderContext)
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(Release(renderContext));
+    LLGL_CAST(GLRenderContext&, renderContext).GetStateManager()->ReleaseTransientResources();
     RemoveFromUniqueSet(renderContexts_, &renderContext);
 }
 
@@ -74,7 +136,8 @@ CommandBufferExt* GLRenderSystem::CreateCommandBufferExt(const CommandBufferDesc
     /* Get state manager from shared render context */
     if (auto sharedContext = GetSharedRenderContext())
     {
-        if ((desc.flags & (CommandBufferFlags::DeferredSubmit | CommandBufferFlags::MultiSubmit)) != 0)
+        /* Command buffers are always deferred with a dedicated render thread, since they are copied into its command ring on submission */
+        if (renderThread_ || (desc.flags & (CommandBufferFlags::DeferredSubmit | CommandBufferFlags::MultiSubmit)) != 0)
         {
             /* Create deferred command buffer */
             return TakeOwnership(
@@ -112,6 +175,8 @@ void GLRenderSystem::Release(CommandBuffer& commandBuffer)
 
 Sampler* GLRenderSystem::CreateSampler(const SamplerDescriptor& desc)
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(CreateSampler(desc));
+
     LLGL_ASSERT_FEATURE_SUPPORT(hasSamplers);
     auto sampler = MakeUnique<GLSampler>();
     sampler->SetDesc(desc);
@@ -120,6 +185,8 @@ Sampler* GLRenderSystem::CreateSampler(const SamplerDescriptor& desc)
 
 void GLRenderSystem::Release(Sampler& sampler)
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(Release(sampler));
+
     RemoveFromUniqueSet(samplers_, &sampler);
 }
 
@@ -127,11 +194,15 @@ void GLRenderSystem::Release(Sampler& sampler)
 
 ResourceHeap* GLRenderSystem::CreateResourceHeap(const ResourceHeapDescriptor& desc)
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(CreateResourceHeap(desc));
+
     return TakeOwnership(resourceHeaps_, MakeUnique<GLResourceHeap>(desc));
 }
 
 void GLRenderSystem::Release(ResourceHeap& resourceHeap)
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(Release(resourceHeap));
+
     RemoveFromUniqueSet(resourceHeaps_, &resourceHeap);
 }
 
@@ -139,12 +210,16 @@ void GLRenderSystem::Release(ResourceHeap& resourceHeap)
 
 RenderPass* GLRenderSystem::CreateRenderPass(const RenderPassDescriptor& desc)
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(CreateRenderPass(desc));
+
     AssertCreateRenderPass(desc);
     return TakeOwnership(renderPasses_, MakeUnique<GLRenderPass>(desc));
 }
 
 void GLRenderSystem::Release(RenderPass& renderPass)
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(Release(renderPass));
+
     RemoveFromUniqueSet(renderPasses_, &renderPass);
 }
 
@@ -152,6 +227,8 @@ void GLRenderSystem::Release(RenderPass& renderPass)
 
 RenderTarget* GLRenderSystem::CreateRenderTarget(const RenderTargetDescriptor& desc)
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(CreateRenderTarget(desc));
+
     LLGL_ASSERT_FEATURE_SUPPORT(hasRenderTargets);
     AssertCreateRenderTarget(desc);
     return TakeOwnership(renderTargets_, MakeUnique<GLRenderTarget>(desc));
@@ -159,6 +236,8 @@ RenderTarget* GLRenderSystem::CreateRenderTarget(const RenderTargetDescriptor& d
 
 void GLRenderSystem::Release(RenderTarget& renderTarget)
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(Release(renderTarget));
+
     RemoveFromUniqueSet(renderTargets_, &renderTarget);
 }
 
@@ -166,6 +245,8 @@ void GLRenderSystem::Release(RenderTarget& renderTarget)
 
 Shader* GLRenderSystem::CreateShader(const ShaderDescriptor& desc)
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(CreateShader(desc));
+
     AssertCreateShader(desc);
 
     /* Validate rendering capabilities for required shader type */
@@ -191,17 +272,47 @@ Shader* GLRenderSystem::CreateShader(const ShaderDescriptor& desc)
 
 ShaderProgram* GLRenderSystem::CreateShaderProgram(const ShaderProgramDescriptor& desc)
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(CreateShaderProgram(desc));
+
     AssertCreateShaderProgram(desc);
-    return TakeOwnership(shaderPrograms_, MakeUnique<GLShaderProgram>(desc));
+
+    auto binaryCache = GetOrCreateProgramBinaryCache();
+    if (binaryCache)
+        binaryCache->Flush();
+
+    return TakeOwnership(shaderPrograms_, MakeUnique<GLShaderProgram>(desc, binaryCache, GetShaderProgramLinkage(desc)));
+}
+
+void GLRenderSystem::CreateShaderPrograms(std::uint32_t numShaderPrograms, const ShaderProgramDescriptor* descs, ShaderProgram** shaderPrograms)
+{
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(CreateShaderPrograms(numShaderPrograms, descs, shaderPrograms));
+
+    for (std::uint32_t i = 0; i < numShaderPrograms; ++i)
+        AssertCreateShaderProgram(descs[i]);
+
+    auto binaryCache = GetOrCreateProgramBinaryCache();
+    if (binaryCache)
+        binaryCache->Flush();
+
+    /* Issue all link commands without querying any link status, so the driver can link the shader programs concurrently */
+    for (std::uint32_t i = 0; i < numShaderPrograms; ++i)
+        shaderPrograms[i] = TakeOwnership(shaderPrograms_, MakeUnique<GLShaderProgram>(descs[i], binaryCache, GetShaderProgramLinkage(descs[i])));
 }
 
 void GLRenderSystem::Release(Shader& shader)
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(Release(shader));
+
     RemoveFromUniqueSet(shaders_, &shader);
 }
 
 void GLRenderSystem::Release(ShaderProgram& shaderProgram)
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(Release(shaderProgram));
+
+    if (programBinaryCache_)
+        programBinaryCache_->Discard(LLGL_CAST(GLShaderProgram&, shaderProgram).GetID());
+
     RemoveFromUniqueSet(shaderPrograms_, &shaderProgram);
 }
 
@@ -209,11 +320,15 @@ void GLRenderSystem::Release(ShaderProgram& shaderProgram)
 
 PipelineLayout* GLRenderSystem::CreatePipelineLayout(const PipelineLayoutDescriptor& desc)
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(CreatePipelineLayout(desc));
+
     return TakeOwnership(pipelineLayouts_, MakeUnique<GLPipelineLayout>(desc));
 }
 
 void GLRenderSystem::Release(PipelineLayout& pipelineLayout)
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(Release(pipelineLayout));
+
     RemoveFromUniqueSet(pipelineLayouts_, &pipelineLayout);
 }
 
@@ -221,33 +336,52 @@ void GLRenderSystem::Release(PipelineLayout& pipelineLayout)
 
 GraphicsPipeline* GLRenderSystem::CreateGraphicsPipeline(const GraphicsPipelineDescriptor& desc)
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(CreateGraphicsPipeline(desc));
+
     return TakeOwnership(graphicsPipelines_, MakeUnique<GLGraphicsPipeline>(desc, GetRenderingCaps().limits));
 }
 
 ComputePipeline* GLRenderSystem::CreateComputePipeline(const ComputePipelineDescriptor& desc)
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(CreateComputePipeline(desc));
+
     return TakeOwnership(computePipelines_, MakeUnique<GLComputePipeline>(desc));
 }
 
 void GLRenderSystem::Release(GraphicsPipeline& graphicsPipeline)
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(Release(graphicsPipeline));
+
     RemoveFromUniqueSet(graphicsPipelines_, &graphicsPipeline);
 }
 
 void GLRenderSystem::Release(ComputePipeline& computePipeline)
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(Release(computePipeline));
+
     RemoveFromUniqueSet(computePipelines_, &computePipeline);
 }
 
+bool GLRenderSystem::QueryPipelineStateCacheStatistics(PipelineStateCacheStatistics& stats) const
+{
+    /* State pool is thread-safe, so this must not be forwarded to the render thread */
+    stats = GLStatePool::Instance().GetStatistics();
+    return true;
+}
+
 /* ----- Queries ----- */
 
 QueryHeap* GLRenderSystem::CreateQueryHeap(const QueryHeapDescriptor& desc)
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(CreateQueryHeap(desc));
+
     return TakeOwnership(queryHeaps_, MakeUnique<GLQueryHeap>(desc));
 }
 
 void GLRenderSystem::Release(QueryHeap& queryHeap)
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(Release(queryHeap));
+
     RemoveFromUniqueSet(queryHeaps_, &queryHeap);
 }
 
@@ -255,11 +389,15 @@ void GLRenderSystem::Release(QueryHeap& queryHeap)
 
 Fence* GLRenderSystem::CreateFence()
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(CreateFence());
+
     return TakeOwnership(fences_, MakeUnique<GLFence>());
 }
 
 void GLRenderSystem::Release(Fence& fence)
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(Release(fence));
+
     RemoveFromUniqueSet(fences_, &fence);
 }
 
@@ -278,6 +416,9 @@ RenderContext* GLRenderSystem::AddRenderContext(std::unique_ptr<GLRenderContext>
     GLStateManager::active->DetermineExtensionsAndLimits();
     GLStateManager::active->SetClipControl(GL_UPPER_LEFT, GL_ZERO_TO_ONE);
 
+    /* Create fence ring for the frames in flight, which depends on the extensions that have been loaded above */
+    renderContext->CreateFrameFences();
+
     /* Take ownership and return raw pointer */
     return TakeOwnership(renderContexts_, std::move(renderContext));
 }
@@ -287,6 +428,13 @@ RenderContext* GLRenderSystem::AddRenderContext(std::unique_ptr<GLRenderContext>
  * ======= Private: =======
  */
 
+void GLRenderSystem::ReleaseFromCallingThread(GLRenderContext& renderContext)
+{
+    /* Register render context as current context first, since it might have been activated by the platform layer directly */
+    GLRenderContext::GLMakeCurrent(&renderContext);
+    GLRenderContext::GLMakeCurrent(nullptr);
+}
+
 void GLRenderSystem::CreateGLContextDependentDevices(GLRenderContext& renderContext, const RenderContextDescriptor& desc)
 {
     /* Load all OpenGL extensions */
@@ -295,6 +443,13 @@ void GLRenderSystem::CreateGLContextDependentDevices(GLRenderContext& renderCont
     
     /* Create command queue instance */
     commandQueue_ = MakeUnique<GLCommandQueue>(renderContext.GetStateManager());
+
+    /* Create upload ring for small buffer updates if persistent mapping is supported */
+    if (GLUploadRing::IsSupported())
+    {
+        uploadRing_ = MakeUnique<GLUploadRing>(g_uploadRingSegmentSize);
+        renderContext.GetStateManager()->SetUploadRing(uploadRing_.get());
+    }
 }
 
 void GLRenderSystem::LoadGLExtensions(const ProfileOpenGLDescriptor& profileDesc)
@@ -308,6 +463,14 @@ void GLRenderSystem::LoadGLExtensions(const ProfileOpenGLDescriptor& profileDesc
         auto extensions = QueryExtensions(coreProfile);
         LoadAllExtensions(extensions, coreProfile);
 
+        /* Let the driver compile and link shaders on as many threads as it supports */
+        #ifndef __APPLE__
+        if (HasExtension(GLExt::KHR_parallel_shader_compile))
+            glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+        else if (HasExtension(GLExt::ARB_parallel_shader_compile))
+            glMaxShaderCompilerThreadsARB(0xFFFFFFFF);
+        #endif // /__APPLE__
+
         /* Query and store all renderer information and capabilities */
         QueryRendererInfo();
         QueryRenderingCaps();
@@ -382,36 +545,33 @@ void GLRenderSystem::QueryRenderingCaps()
     SetRenderingCaps(caps);
 }
 
-
-#ifdef LLGL_ENABLE_CUSTOM_SUB_MIPGEN
-
-/*
- * MipGenerationFBOPair structure
- */
-
-GLRenderSystem::MipGenerationFBOPair::~MipGenerationFBOPair()
+GLProgramBinaryCache* GLRenderSystem::GetOrCreateProgramBinaryCache()
 {
-    ReleaseFBOs();
+    if (!programBinaryCache_)
+    {
+        const auto& directory = GetConfiguration().programCacheDirectory;
+        if (!directory.empty() && GLProgramBinaryCache::IsSupported())
+            programBinaryCache_ = MakeUnique<GLProgramBinaryCache>(directory);
+    }
+    return programBinaryCache_.get();
 }
 
-void GLRenderSystem::MipGenerationFBOPair::CreateFBOs()
+GLProgramLinkage GLRenderSystem::GetShaderProgramLinkage(const ShaderProgramDescriptor& desc) const
 {
-    if (!fbos[0])
-        glGenFramebuffers(2, fbos);
+    /* Compute shader programs only have a single stage, so they don't benefit from program pipelines */
+    if (GetConfiguration().separableShaderPrograms && desc.computeShader == nullptr && GLShaderProgram::IsProgramPipelineSupported())
+        return GLProgramLinkage::Pipeline;
+    else
+        return GLProgramLinkage::Monolithic;
 }
 
-void GLRenderSystem::MipGenerationFBOPair::ReleaseFBOs()
+GLMipGenerator* GLRenderSystem::GetOrCreateMipGenerator()
 {
-    if (fbos[0])
-    {
-        glDeleteFramebuffers(2, fbos);
-        fbos[0] = 0;
-        fbos[1] = 0;
-    }
+    if (!mipGenerator_ && GLMipGenerator::IsSupported())
+        mipGenerator_ = MakeUnique<GLMipGenerator>();
+    return mipGenerator_.get();
 }
 
-#endif // /LLGL_ENABLE_CUSTOM_SUB_MIPGEN
-
 
 } // /namespace LLGL
 
@@ -21,90 +21,97 @@ namespace LLGL
 
 /* ----- Textures ----- */
 
-static GLint GetGlTextureMinFilter(const TextureDescriptor& textureDesc)
-{
-    if (IsMipMappedTexture(textureDesc))
-        return GL_LINEAR_MIPMAP_LINEAR;
-    else
-        return GL_LINEAR;
-}
-
 Texture* GLRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc)
 {
-    auto texture = MakeUnique<GLTexture>(textureDesc.type);
-
-    /* Bind texture */
-    GLStateManager::active->BindGLTexture(*texture);
-
-    /* Initialize texture parameters for the first time */
-    auto target = GLTypes::Map(textureDesc.type);
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(CreateTexture(textureDesc, imageDesc));
 
-    glTexParameteri(target, GL_TEXTURE_MIN_FILTER, GetGlTextureMinFilter(textureDesc));
-    glTexParameteri(target, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
-    /* Build texture storage and upload image dataa */
+    /* Validate rendering features for texture type */
     switch (textureDesc.type)
     {
-        case TextureType::Texture1D:
-            GLTexImage1D(textureDesc, imageDesc);
-            break;
-
-        case TextureType::Texture2D:
-            GLTexImage2D(textureDesc, imageDesc);
-            break;
-
         case TextureType::Texture3D:
             LLGL_ASSERT_FEATURE_SUPPORT(has3DTextures);
-            GLTexImage3D(textureDesc, imageDesc);
             break;
-
         case TextureType::TextureCube:
             LLGL_ASSERT_FEATURE_SUPPORT(hasCubeTextures);
-            GLTexImageCube(textureDesc, imageDesc);
             break;
-
         case TextureType::Texture1DArray:
-            LLGL_ASSERT_FEATURE_SUPPORT(hasArrayTextures);
-            GLTexImage1DArray(textureDesc, imageDesc);
-            break;
-
         case TextureType::Texture2DArray:
             LLGL_ASSERT_FEATURE_SUPPORT(hasArrayTextures);
-            GLTexImage2DArray(textureDesc, imageDesc);
             break;
-
         case TextureType::TextureCubeArray:
             LLGL_ASSERT_FEATURE_SUPPORT(hasCubeArrayTextures);
-            GLTexImageCubeArray(textureDesc, imageDesc);
             break;
-
         case TextureType::Texture2DMS:
-            LLGL_ASSERT_FEATURE_SUPPORT(hasMultiSampleTextures);
-            GLTexImage2DMS(textureDesc);
-            break;
-
         case TextureType::Texture2DMSArray:
             LLGL_ASSERT_FEATURE_SUPPORT(hasMultiSampleTextures);
-            GLTexImage2DMSArray(textureDesc);
             break;
-
         default:
-            throw std::invalid_argument("failed to create texture with invalid texture type");
             break;
     }
 
+    auto texture = MakeUnique<GLTexture>(textureDesc.type);
+
+    /* Upload image data on the loader thread for asynchronous texture creation */
+    if ((textureDesc.miscFlags & MiscFlags::AsyncUpload) != 0 &&
+        imageDesc != nullptr                                    &&
+        !IsCompressedFormat(textureDesc.format)                 &&
+        !IsMultiSampleTexture(textureDesc.type))
+    {
+        if (auto textureLoader = GetOrCreateTextureLoader())
+        {
+            textureLoader->Upload(*texture, textureDesc, *imageDesc);
+            return TakeOwnership(textures_, std::move(texture));
+        }
+    }
+
+    /* Bind texture, initialize its parameters, and build texture storage */
+    texture->BuildStorage(*GLStateManager::active, textureDesc, imageDesc);
+
     return TakeOwnership(textures_, std::move(texture));
 }
 
 void GLRenderSystem::Release(Texture& texture)
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(Release(texture));
+
+    /* Remove texture from loader before it is deleted */
+    if (textureLoader_)
+        textureLoader_->Remove(LLGL_CAST(const GLTexture&, texture));
+
     RemoveFromUniqueSet(textures_, &texture);
 }
 
+bool GLRenderSystem::IsTextureResident(const Texture& texture)
+{
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(IsTextureResident(texture));
+
+    if (textureLoader_)
+        return textureLoader_->IsResident(LLGL_CAST(const GLTexture&, texture));
+    else
+        return true;
+}
+
+// private
+GLTextureLoader* GLRenderSystem::GetOrCreateTextureLoader()
+{
+    if (!textureLoader_ && HasExtension(GLExt::ARB_sync))
+    {
+        /* Create loader context that shares all GL objects with the primary render context */
+        if (auto sharedContext = GetSharedRenderContext())
+        {
+            if (auto loaderContext = GLContext::CreateLoaderContext(sharedContext->GetGLContext()))
+                textureLoader_ = MakeUnique<GLTextureLoader>(std::move(loaderContext));
+        }
+    }
+    return textureLoader_.get();
+}
+
 /* ----- "WriteTexture..." functions ----- */
 
 void GLRenderSystem::WriteTexture(Texture& texture, const TextureRegion& textureRegion, const SrcImageDescriptor& imageDesc)
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(WriteTexture(texture, textureRegion, imageDesc));
+
     /* Bind texture and write texture sub data */
     auto& textureGL = LLGL_CAST(GLTexture&, texture);
     GLStateManager::active->BindGLTexture(textureGL);
@@ -152,6 +159,8 @@ void GLRenderSystem::WriteTexture(Texture& texture, const TextureRegion& texture
 
 void GLRenderSystem::ReadTexture(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc)
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(ReadTexture(texture, mipLevel, imageDesc));
+
     LLGL_ASSERT_PTR(imageDesc.data);
 
     auto& textureGL = LLGL_CAST(const GLTexture&, texture);
@@ -186,14 +195,34 @@ void GLRenderSystem::ReadTexture(const Texture& texture, std::uint32_t mipLevel,
 
 void GLRenderSystem::GenerateMips(Texture& texture)
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(GenerateMips(texture));
+
     auto& textureGL = LLGL_CAST(GLTexture&, texture);
+
+    /* Generate MIP-maps with compute shader if supported for this texture (the range is clamped to all MIP levels and layers) */
+    if (auto mipGenerator = GetOrCreateMipGenerator())
+    {
+        if (mipGenerator->GenerateMips(textureGL, 0, ~0u, 0, ~0u))
+            return;
+    }
+
     GenerateMipsPrimary(textureGL.GetID(), textureGL.GetType());
 }
 
 void GLRenderSystem::GenerateMips(Texture& texture, std::uint32_t baseMipLevel, std::uint32_t numMipLevels, std::uint32_t baseArrayLayer, std::uint32_t numArrayLayers)
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(GenerateMips(texture, baseMipLevel, numMipLevels, baseArrayLayer, numArrayLayers));
+
     if (numMipLevels > 0 && numArrayLayers > 0)
     {
+        /* Generate MIP-maps with compute shader if supported for this texture */
+        if (auto mipGenerator = GetOrCreateMipGenerator())
+        {
+            auto& textureGL = LLGL_CAST(GLTexture&, texture);
+            if (mipGenerator->GenerateMips(textureGL, baseMipLevel, numMipLevels, baseArrayLayer, numArrayLayers))
+                return;
+        }
+
         #ifdef LLGL_ENABLE_CUSTOM_SUB_MIPGEN
 
         if (texture.GetType() == TextureType::Texture3D)
@@ -244,6 +273,48 @@ void GLRenderSystem::GenerateMips(Texture& texture, std::uint32_t baseMipLevel,
     }
 }
 
+std::uint64_t GLRenderSystem::ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel, ImageFormat format, DataType dataType)
+{
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(ReadTextureAsync(texture, mipLevel, format, dataType));
+
+    auto& textureGL = LLGL_CAST(const GLTexture&, texture);
+
+    /* Determine size of the image data */
+    const auto extent   = textureGL.QueryMipExtent(mipLevel);
+    const auto dataSize = ImageDataSize(format, dataType, extent.width * extent.height * extent.depth);
+
+    /* Copy texture image into the next available PBO */
+    if (!readbackRing_)
+        readbackRing_ = MakeUnique<GLReadbackRing>();
+
+    return readbackRing_->ReadTexture(
+        textureGL,
+        static_cast<GLint>(mipLevel),
+        GLTypes::Map(format),
+        GLTypes::Map(dataType),
+        static_cast<GLsizeiptr>(dataSize)
+    );
+}
+
+bool GLRenderSystem::QueryReadback(std::uint64_t ticket, bool wait)
+{
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(QueryReadback(ticket, wait));
+    return (readbackRing_ ? readbackRing_->Query(ticket, wait) : false);
+}
+
+const void* GLRenderSystem::MapReadback(std::uint64_t ticket, std::size_t& dataSize)
+{
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(MapReadback(ticket, dataSize));
+    return (readbackRing_ ? readbackRing_->Map(ticket, dataSize) : nullptr);
+}
+
+void GLRenderSystem::ReleaseReadback(std::uint64_t ticket)
+{
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(ReleaseReadback(ticket));
+    if (readbackRing_)
+        readbackRing_->Release(ticket);
+}
+
 
 /*
  * ======= Private: =======
@@ -284,32 +355,22 @@ static void BlitFramebufferLinear(GLint srcWidth, GLint srcHeight, GLint dstWidt
     glBlitFramebuffer(0, 0, srcWidth, srcHeight, 0, 0, dstWidth, dstHeight, GL_COLOR_BUFFER_BIT, GL_LINEAR);
 }
 
-static void GenerateSubMipsTexture1D(const Extent3D& extent, GLuint texID, GLint baseMipLevel, GLint numMipLevels)
+// Blits each MIP level into the next one with linear filtering, using the cached FBOs of both levels
+static void GenerateSubMipsWithFBOCache(
+    GLStateManager& stateMngr,
+    GLint           width,
+    GLint           height,
+    GLuint          texID,
+    GLenum          texTarget,
+    GLint           baseMipLevel,
+    GLint           numMipLevels,
+    GLint           arrayLayer = 0)
 {
-    /* Get extent of base MIP level */
-    auto srcWidth = static_cast<GLint>(extent.width);
-
-    auto dstWidth = srcWidth;
-
-    /* Blit current MIP level into next MIP level with linear sampling filter */
-    for (auto mipLevel = baseMipLevel; mipLevel + 1 < baseMipLevel + numMipLevels; ++mipLevel)
-    {
-        GetNextMipSize(dstWidth);
+    auto& framebufferCache = GLContext::Active()->GetFramebufferCache();
 
-        glFramebufferTexture1D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_1D, texID, mipLevel);
-        glFramebufferTexture1D(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_1D, texID, mipLevel + 1);
-
-        BlitFramebufferLinear(srcWidth, 1, dstWidth, 1);
-
-        srcWidth = dstWidth;
-    }
-}
-
-static void GenerateSubMipsTexture2D(const Extent3D& extent, GLuint texID, GLenum texTarget, GLint baseMipLevel, GLint numMipLevels)
-{
     /* Get extent of base MIP level */
-    auto srcWidth   = static_cast<GLint>(extent.width);
-    auto srcHeight  = static_cast<GLint>(extent.height);
+    auto srcWidth   = width;
+    auto srcHeight  = height;
 
     auto dstWidth   = srcWidth;
     auto dstHeight  = srcHeight;
@@ -320,33 +381,14 @@ static void GenerateSubMipsTexture2D(const Extent3D& extent, GLuint texID, GLenu
         GetNextMipSize(dstWidth);
         GetNextMipSize(dstHeight);
 
-        glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, texTarget, texID, mipLevel);
-        glFramebufferTexture2D(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, texTarget, texID, mipLevel + 1);
-
-        BlitFramebufferLinear(srcWidth, srcHeight, dstWidth, dstHeight);
-
-        srcWidth    = dstWidth;
-        srcHeight   = dstHeight;
-    }
-}
-
-static void GenerateSubMipsTextureLayer(const Extent3D& extent, GLuint texID, GLint baseMipLevel, GLint numMipLevels, GLint arrayLayer)
-{
-    /* Get extent of base MIP level */
-    auto srcWidth   = static_cast<GLint>(extent.width);
-    auto srcHeight  = static_cast<GLint>(extent.height);
+        const GLFramebufferAttachment srcAttachment { texID, texTarget, mipLevel,     arrayLayer };
+        const GLFramebufferAttachment dstAttachment { texID, texTarget, mipLevel + 1, arrayLayer };
 
-    auto dstWidth   = srcWidth;
-    auto dstHeight  = srcHeight;
-
-    /* Blit current MIP level into next MIP level with linear sampling filter */
-    for (auto mipLevel = baseMipLevel; mipLevel + 1 < baseMipLevel + numMipLevels; ++mipLevel)
-    {
-        GetNextMipSize(dstWidth);
-        GetNextMipSize(dstHeight);
-
-        glFramebufferTextureLayer(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, texID, mipLevel, arrayLayer);
-        glFramebufferTextureLayer(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, texID, mipLevel + 1, arrayLayer);
+        if (!framebufferCache.BindFramebuffer(stateMngr, GLFramebufferTarget::READ_FRAMEBUFFER, srcAttachment) ||
+            !framebufferCache.BindFramebuffer(stateMngr, GLFramebufferTarget::DRAW_FRAMEBUFFER, dstAttachment))
+        {
+            break;
+        }
 
         BlitFramebufferLinear(srcWidth, srcHeight, dstWidth, dstHeight);
 
@@ -362,27 +404,27 @@ void GLRenderSystem::GenerateSubMipsWithFBO(GLTexture& textureGL, const Extent3D
     auto texType    = textureGL.GetType();
     auto texTarget  = GLTypes::Map(texType);
 
-    mipGenerationFBOPair_.CreateFBOs();
+    auto& stateMngr = *GLStateManager::active;
 
-    GLStateManager::active->PushBoundFramebuffer(GLFramebufferTarget::READ_FRAMEBUFFER);
-    GLStateManager::active->PushBoundFramebuffer(GLFramebufferTarget::DRAW_FRAMEBUFFER);
-    {
-        /* Bind read framebuffer for <current> MIP level, and draw framebuffer for <next> MIP level */
-        GLStateManager::active->BindFramebuffer(GLFramebufferTarget::READ_FRAMEBUFFER, mipGenerationFBOPair_.fbos[0]);
-        GLStateManager::active->BindFramebuffer(GLFramebufferTarget::DRAW_FRAMEBUFFER, mipGenerationFBOPair_.fbos[1]);
+    const auto width    = static_cast<GLint>(extent.width);
+    const auto height   = static_cast<GLint>(extent.height);
 
+    stateMngr.PushBoundFramebuffer(GLFramebufferTarget::READ_FRAMEBUFFER);
+    stateMngr.PushBoundFramebuffer(GLFramebufferTarget::DRAW_FRAMEBUFFER);
+    {
+        /* Bind cached read framebuffer for <current> MIP level, and draw framebuffer for <next> MIP level */
         switch (texType)
         {
             case TextureType::Texture1D:
             {
-                GenerateSubMipsTexture1D(extent, texID, baseMipLevel, numMipLevels);
+                GenerateSubMipsWithFBOCache(stateMngr, width, 1, texID, GL_TEXTURE_1D, baseMipLevel, numMipLevels);
             }
             break;
 
             case TextureType::Texture2D:
             case TextureType::Texture2DMS:
             {
-                GenerateSubMipsTexture2D(extent, texID, texTarget, baseMipLevel, numMipLevels);
+                GenerateSubMipsWithFBOCache(stateMngr, width, height, texID, texTarget, baseMipLevel, numMipLevels);
             }
             break;
 
@@ -403,7 +445,7 @@ void GLRenderSystem::GenerateSubMipsWithFBO(GLTexture& textureGL, const Extent3D
                 };
 
                 for (std::size_t i = 0; i < 6; ++i)
-                    GenerateSubMipsTexture2D(extent, texID, g_cubeFaceTexTargets[i], baseMipLevel, numMipLevels);
+                    GenerateSubMipsWithFBOCache(stateMngr, width, height, texID, g_cubeFaceTexTargets[i], baseMipLevel, numMipLevels);
             }
             break;
 
@@ -413,7 +455,7 @@ void GLRenderSystem::GenerateSubMipsWithFBO(GLTexture& textureGL, const Extent3D
             {
                 /* Generate MIP-maps for each specified array layer */
                 for (auto arrayLayer = baseArrayLayer; arrayLayer < baseArrayLayer + numArrayLayers; ++arrayLayer)
-                    GenerateSubMipsTextureLayer(extent, texID, baseMipLevel, numMipLevels, arrayLayer);
+                    GenerateSubMipsWithFBOCache(stateMngr, width, height, texID, texTarget, baseMipLevel, numMipLevels, arrayLayer);
             }
             break;
 
@@ -425,13 +467,13 @@ void GLRenderSystem::GenerateSubMipsWithFBO(GLTexture& textureGL, const Extent3D
 
                 /* Generate MIP-maps for each specified array layer */
                 for (auto arrayLayer = baseArrayLayer; arrayLayer < baseArrayLayer + numArrayLayers; ++arrayLayer)
-                    GenerateSubMipsTextureLayer(extent, texID, baseMipLevel, numMipLevels, arrayLayer);
+                    GenerateSubMipsWithFBOCache(stateMngr, width, height, texID, texTarget, baseMipLevel, numMipLevels, arrayLayer);
             }
             break;
         }
     }
-    GLStateManager::active->PopBoundFramebuffer();
-    GLStateManager::active->PopBoundFramebuffer();
+    stateMngr.PopBoundFramebuffer();
+    stateMngr.PopBoundFramebuffer();
 }
 
 #else
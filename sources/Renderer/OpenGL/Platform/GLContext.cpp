@@ -6,25 +6,37 @@
  */
 
 #include "GLContext.h"
+#include "../../../Core/Helper.h"
+#include <vector>
+#include <mutex>
 
 
 namespace LLGL
 {
 
 
-static GLContext* g_activeGLContext = nullptr;
+// Active GL context per thread, since a GL context can only be current on one thread at a time.
+static thread_local GLContext* g_activeGLContext = nullptr;
 
-GLContext::GLContext(GLContext* sharedContext)
+// List of all GL contexts, e.g. to invalidate their FBO caches. Contexts are created and released on different threads (see CreateLoaderContext).
+static std::mutex               g_GLContextListMutex;
+static std::vector<GLContext*>  g_GLContextList;
+
+GLContext::GLContext(GLContext* sharedContext, bool shareStateManager)
 {
-    if (sharedContext)
+    if (sharedContext && shareStateManager)
         stateMngr_ = sharedContext->stateMngr_;
     else
         stateMngr_ = std::make_shared<GLStateManager>();
+
+    std::lock_guard<std::mutex> guard { g_GLContextListMutex };
+    g_GLContextList.push_back(this);
 }
 
 GLContext::~GLContext()
 {
-    // dummy
+    std::lock_guard<std::mutex> guard { g_GLContextListMutex };
+    RemoveFromList(g_GLContextList, this);
 }
 
 bool GLContext::MakeCurrent(GLContext* context)
@@ -58,6 +70,32 @@ GLContext* GLContext::Active()
     return g_activeGLContext;
 }
 
+bool GLContext::IsHeadless() const
+{
+    return false;
+}
+
+GLFramebufferCache& GLContext::GetFramebufferCache()
+{
+    /* Only the thread this context is current on creates the cache, but other threads read the pointer in NotifyTextureRelease */
+    if (!framebufferCache_)
+    {
+        std::lock_guard<std::mutex> guard { g_GLContextListMutex };
+        framebufferCache_ = MakeUnique<GLFramebufferCache>();
+    }
+    return *framebufferCache_;
+}
+
+void GLContext::NotifyTextureRelease(GLuint texture)
+{
+    std::lock_guard<std::mutex> guard { g_GLContextListMutex };
+    for (auto context : g_GLContextList)
+    {
+        if (context->framebufferCache_)
+            context->framebufferCache_->NotifyTextureRelease(texture);
+    }
+}
+
 
 } // /namespace LLGL
 
@@ -13,6 +13,7 @@
 #include <LLGL/RenderContextFlags.h>
 #include <memory>
 #include "../RenderState/GLStateManager.h"
+#include "../Texture/GLFramebufferCache.h"
 
 
 namespace LLGL
@@ -30,36 +31,61 @@ class GLContext
         // Creates a platform specific GLContext instance.
         static std::unique_ptr<GLContext> Create(const RenderContextDescriptor& desc, Surface& surface, GLContext* sharedContext);
 
+        /*
+        Creates a platform specific GLContext instance for a worker thread. It shares all GL objects with the specified context,
+        but has its own state manager, since GL states are not shared between contexts. Returns null if this is not supported on the current platform.
+        */
+        static std::unique_ptr<GLContext> CreateLoaderContext(GLContext& sharedContext);
+
+        /*
+        Creates a platform specific GLContext instance that does not require a window or display server (Linux: EGL).
+        If a shared context is specified, it must be headless, too. Returns null if this is not supported on the current platform.
+        */
+        static std::unique_ptr<GLContext> CreateHeadless(const RenderContextDescriptor& desc, GLContext* sharedContext);
+
         // Makes the specified GLContext current. If null, the current context will be deactivated.
         static bool MakeCurrent(GLContext* context);
 
         // Returns the active GLContext instance.
         static GLContext* Active();
 
-        // Sets the swap interval for vsync (Win32: wglSwapIntervalEXT, X11: glXSwapIntervalSGI).
+        // Sets the swap interval for vsync (Win32: wglSwapIntervalEXT, X11: glXSwapIntervalSGI, EGL: eglSwapInterval).
         virtual bool SetSwapInterval(int interval) = 0;
 
-        // Swaps the back buffer with the front buffer (Win32: ::SwapBuffers, X11: glXSwapBuffers).
+        // Swaps the back buffer with the front buffer (Win32: ::SwapBuffers, X11: glXSwapBuffers, EGL: glFlush for off-screen surfaces).
         virtual bool SwapBuffers() = 0;
 
         // Resizes the GL context. This is called after the context surface has been resized.
         virtual void Resize(const Extent2D& resolution) = 0;
 
+        // Returns true if this context renders into an off-screen surface without a window. By default false.
+        virtual bool IsHeadless() const;
+
         inline const std::shared_ptr<GLStateManager>& GetStateManager() const
         {
             return stateMngr_;
         }
 
+        /*
+        Returns the cache of FBOs for transient operations of this context, and creates it on first use.
+        The cache is kept per GLContext rather than per state manager, since FBOs are not shared between contexts even if their state manager is.
+        */
+        GLFramebufferCache& GetFramebufferCache();
+
+        // Invalidates the cached FBOs with the specified texture in all contexts. This can be called from any thread.
+        static void NotifyTextureRelease(GLuint texture);
+
     protected:
 
-        GLContext(GLContext* sharedContext);
+        GLContext(GLContext* sharedContext, bool shareStateManager = true);
 
-        // Activates or deactivates this GLContext (Win32: wglMakeCurrent, X11: glXMakeCurrent).
+        // Activates or deactivates this GLContext (Win32: wglMakeCurrent, X11: glXMakeCurrent, EGL: eglMakeCurrent).
         virtual bool Activate(bool activate) = 0;
 
     private:
 
-        std::shared_ptr<GLStateManager> stateMngr_;
+        std::shared_ptr<GLStateManager>     stateMngr_;
+        std::unique_ptr<GLFramebufferCache> framebufferCache_;
 
 };
 
@@ -0,0 +1,311 @@
+/*
+ * LinuxEGLContext.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifdef LLGL_GL_ENABLE_EGL
+
+#include "LinuxEGLContext.h"
+#include <LLGL/Log.h>
+#include <mutex>
+#include <algorithm>
+#include <stdexcept>
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+#ifndef EGL_PLATFORM_SURFACELESS_MESA
+#define EGL_PLATFORM_SURFACELESS_MESA 0x31DD
+#endif
+
+
+/*
+ * EGL display
+ */
+
+// The EGL display is shared between all headless contexts and terminated when the last one is destroyed.
+static std::mutex   g_eglDisplayMutex;
+static EGLDisplay   g_eglDisplay            = EGL_NO_DISPLAY;
+static std::size_t  g_eglDisplayRefCount    = 0;
+
+static bool HasEGLExtension(EGLDisplay display, const char* name)
+{
+    /* Client extensions are queried with EGL_NO_DISPLAY (requires EGL_EXT_client_extensions) */
+    auto extensions = eglQueryString(display, EGL_EXTENSIONS);
+    if (extensions == nullptr)
+        return false;
+
+    /* Find extension name as whole word in space separated list */
+    const auto nameLength = std::strlen(name);
+    for (auto ext = std::strstr(extensions, name); ext != nullptr; ext = std::strstr(ext + nameLength, name))
+    {
+        if ((ext == extensions || ext[-1] == ' ') && (ext[nameLength] == ' ' || ext[nameLength] == '\0'))
+            return true;
+    }
+
+    return false;
+}
+
+static EGLDisplay GetEGLPlatformDisplay()
+{
+    /* Prefer the surfaceless platform, which requires neither a display server nor a GPU device node */
+    if (HasEGLExtension(EGL_NO_DISPLAY, "EGL_MESA_platform_surfaceless"))
+    {
+        auto getPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(eglGetProcAddress("eglGetPlatformDisplayEXT"));
+        if (getPlatformDisplay != nullptr)
+        {
+            auto display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+            if (display != EGL_NO_DISPLAY)
+                return display;
+        }
+    }
+    return eglGetDisplay(EGL_DEFAULT_DISPLAY);
+}
+
+static EGLDisplay AcquireEGLDisplay()
+{
+    std::lock_guard<std::mutex> guard { g_eglDisplayMutex };
+
+    if (g_eglDisplayRefCount == 0)
+    {
+        /* Get and initialize EGL display */
+        auto display = GetEGLPlatformDisplay();
+        if (display == EGL_NO_DISPLAY)
+            throw std::runtime_error("failed to get EGL display for headless OpenGL context");
+
+        EGLint major = 0, minor = 0;
+        if (eglInitialize(display, &major, &minor) != EGL_TRUE)
+            throw std::runtime_error("failed to initialize EGL display for headless OpenGL context");
+
+        g_eglDisplay = display;
+    }
+
+    ++g_eglDisplayRefCount;
+    return g_eglDisplay;
+}
+
+static void ReleaseEGLDisplay()
+{
+    std::lock_guard<std::mutex> guard { g_eglDisplayMutex };
+
+    if (g_eglDisplayRefCount > 0 && --g_eglDisplayRefCount == 0)
+    {
+        eglTerminate(g_eglDisplay);
+        g_eglDisplay = EGL_NO_DISPLAY;
+    }
+}
+
+
+/*
+ * LinuxEGLContext class
+ */
+
+LinuxEGLContext::LinuxEGLContext(const RenderContextDescriptor& desc, LinuxEGLContext* sharedContext) :
+    GLContext { sharedContext              },
+    display_  { AcquireEGLDisplay()        },
+    profile_  { desc.profileOpenGL         }
+{
+    if (sharedContext != nullptr)
+    {
+        /* Use the same config as the shared context, so the contexts are compatible */
+        config_ = sharedContext->config_;
+        CreateContext(sharedContext->context_);
+    }
+    else
+    {
+        ChooseConfig(desc.videoMode);
+        CreateContext(EGL_NO_CONTEXT);
+    }
+
+    CreateSurface(desc.videoMode.resolution);
+
+    /* Make new OpenGL context current */
+    if (!Activate(true))
+        Log::PostReport(Log::ReportType::Error, "failed to make OpenGL render context current (eglMakeCurrent)");
+}
+
+LinuxEGLContext::LinuxEGLContext(LinuxEGLContext& sharedContext) :
+    GLContext { &sharedContext, false },
+    display_  { AcquireEGLDisplay()   },
+    config_   { sharedContext.config_ },
+    profile_  { sharedContext.profile_ }
+{
+    /* Create OpenGL context with the same profile as the shared context and a minimal surface, since the loader context never renders into it */
+    CreateContext(sharedContext.context_);
+    CreateSurface({ 1, 1 });
+}
+
+LinuxEGLContext::~LinuxEGLContext()
+{
+    if (eglGetCurrentContext() == context_)
+        eglMakeCurrent(display_, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+
+    DeleteSurface();
+    eglDestroyContext(display_, context_);
+    ReleaseEGLDisplay();
+}
+
+bool LinuxEGLContext::SetSwapInterval(int interval)
+{
+    /* Swap interval has no effect on pbuffer surfaces, but is still stored by EGL */
+    return (eglSwapInterval(display_, interval) == EGL_TRUE);
+}
+
+bool LinuxEGLContext::SwapBuffers()
+{
+    /* Pbuffer surfaces have no back buffer to swap, so only submit all pending commands like a buffer swap would do */
+    glFlush();
+    return true;
+}
+
+void LinuxEGLContext::Resize(const Extent2D& resolution)
+{
+    /* Re-create pbuffer surface with the new resolution, and re-bind it if this context is current */
+    const bool isCurrent = (eglGetCurrentContext() == context_);
+
+    if (isCurrent)
+        eglMakeCurrent(display_, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+
+    DeleteSurface();
+    CreateSurface(resolution);
+
+    if (isCurrent)
+        Activate(true);
+}
+
+bool LinuxEGLContext::IsHeadless() const
+{
+    return true;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool LinuxEGLContext::Activate(bool activate)
+{
+    /* The rendering API is a per-thread state in EGL */
+    eglBindAPI(EGL_OPENGL_API);
+
+    if (activate)
+        return (eglMakeCurrent(display_, surface_, surface_, context_) == EGL_TRUE);
+    else
+        return (eglMakeCurrent(display_, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT) == EGL_TRUE);
+}
+
+void LinuxEGLContext::ChooseConfig(const VideoModeDescriptor& videoModeDesc)
+{
+    const EGLint configAttribs[] =
+    {
+        EGL_SURFACE_TYPE,       EGL_PBUFFER_BIT,
+        EGL_RENDERABLE_TYPE,    EGL_OPENGL_BIT,
+        EGL_RED_SIZE,           8,
+        EGL_GREEN_SIZE,         8,
+        EGL_BLUE_SIZE,          8,
+        EGL_ALPHA_SIZE,         (videoModeDesc.colorBits == 32 ? 8 : 0),
+        EGL_DEPTH_SIZE,         videoModeDesc.depthBits,
+        EGL_STENCIL_SIZE,       videoModeDesc.stencilBits,
+        EGL_NONE
+    };
+
+    /*
+    Choose config with pbuffer support for the default framebuffer.
+    A surfaceless context (EGL_KHR_surfaceless_context) is not an option, since it has no default framebuffer the render context could render into.
+    */
+    EGLint numConfigs = 0;
+    if (eglChooseConfig(display_, configAttribs, &config_, 1, &numConfigs) != EGL_TRUE || numConfigs == 0)
+        throw std::runtime_error("failed to choose EGL config with pbuffer support for headless OpenGL context");
+}
+
+void LinuxEGLContext::CreateContext(EGLContext sharedContext)
+{
+    /* Desktop OpenGL must be bound before an EGL context is created */
+    if (eglBindAPI(EGL_OPENGL_API) != EGL_TRUE)
+        throw std::runtime_error("failed to bind OpenGL API for EGL context");
+
+    if (profile_.contextProfile == OpenGLContextProfile::CoreProfile)
+        context_ = CreateContextCoreProfile(sharedContext, profile_.majorVersion, profile_.minorVersion);
+
+    if (context_ == EGL_NO_CONTEXT)
+        context_ = CreateContextCompatibilityProfile(sharedContext);
+
+    if (context_ == EGL_NO_CONTEXT)
+        throw std::runtime_error("failed to create headless OpenGL context with EGL");
+}
+
+void LinuxEGLContext::CreateSurface(const Extent2D& resolution)
+{
+    const EGLint pbufferAttribs[] =
+    {
+        EGL_WIDTH,  static_cast<EGLint>(std::max(1u, resolution.width)),
+        EGL_HEIGHT, static_cast<EGLint>(std::max(1u, resolution.height)),
+        EGL_NONE
+    };
+
+    surface_ = eglCreatePbufferSurface(display_, config_, pbufferAttribs);
+    if (surface_ == EGL_NO_SURFACE)
+        throw std::runtime_error("failed to create EGL pbuffer surface for headless OpenGL context");
+}
+
+void LinuxEGLContext::DeleteSurface()
+{
+    if (surface_ != EGL_NO_SURFACE)
+    {
+        eglDestroySurface(display_, surface_);
+        surface_ = EGL_NO_SURFACE;
+    }
+}
+
+EGLContext LinuxEGLContext::CreateContextCoreProfile(EGLContext sharedContext, int major, int minor)
+{
+    if (!HasEGLExtension(display_, "EGL_KHR_create_context"))
+    {
+        Log::PostReport(Log::ReportType::Error, "failed to create OpenGL core profile (EGL_KHR_create_context not supported)");
+        return EGL_NO_CONTEXT;
+    }
+
+    /* Check if highest version possible shall be used */
+    if (major < 0 || minor < 0)
+    {
+        /* Set to fixed value since 'glGetIntegerv' can not be used until a valid GL context has been created */
+        major = 3;
+        minor = 2;
+    }
+
+    const EGLint contextAttribs[] =
+    {
+        EGL_CONTEXT_MAJOR_VERSION_KHR,          major,
+        EGL_CONTEXT_MINOR_VERSION_KHR,          minor,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK_KHR,    EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT_KHR,
+        EGL_NONE
+    };
+
+    auto context = eglCreateContext(display_, config_, sharedContext, contextAttribs);
+
+    if (context == EGL_NO_CONTEXT)
+        Log::PostReport(Log::ReportType::Error, "failed to create OpenGL core profile");
+
+    return context;
+}
+
+EGLContext LinuxEGLContext::CreateContextCompatibilityProfile(EGLContext sharedContext)
+{
+    /* Create compatibility profile */
+    return eglCreateContext(display_, config_, sharedContext, nullptr);
+}
+
+
+} // /namespace LLGL
+
+
+#endif // /LLGL_GL_ENABLE_EGL
+
+
+
+// ================================================================================
@@ -0,0 +1,80 @@
+/*
+ * LinuxEGLContext.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_LINUX_EGL_CONTEXT_H
+#define LLGL_LINUX_EGL_CONTEXT_H
+
+
+#ifdef LLGL_GL_ENABLE_EGL
+
+
+#include "../GLContext.h"
+#include "../../OpenGL.h"
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+
+namespace LLGL
+{
+
+
+/*
+Headless GL context that is created via EGL without a display server.
+The EGL display is taken from the surfaceless platform (EGL_MESA_platform_surfaceless) if available, otherwise from the default display.
+The default framebuffer is a pbuffer surface with the resolution of the video mode.
+EGL configs without pbuffer support are rejected, since a surfaceless context (EGL_KHR_surfaceless_context) has no default framebuffer.
+*/
+class LinuxEGLContext : public GLContext
+{
+
+    public:
+
+        LinuxEGLContext(const RenderContextDescriptor& desc, LinuxEGLContext* sharedContext);
+
+        // Creates a loader context for a worker thread that shares all GL objects with the specified context.
+        LinuxEGLContext(LinuxEGLContext& sharedContext);
+
+        ~LinuxEGLContext();
+
+        bool SetSwapInterval(int interval) override;
+        bool SwapBuffers() override;
+        void Resize(const Extent2D& resolution) override;
+        bool IsHeadless() const override;
+
+    private:
+
+        bool Activate(bool activate) override;
+
+        void ChooseConfig(const VideoModeDescriptor& videoModeDesc);
+        void CreateContext(EGLContext sharedContext);
+        void CreateSurface(const Extent2D& resolution);
+        void DeleteSurface();
+
+        EGLContext CreateContextCoreProfile(EGLContext sharedContext, int major, int minor);
+        EGLContext CreateContextCompatibilityProfile(EGLContext sharedContext);
+
+        EGLDisplay              display_    = EGL_NO_DISPLAY;
+        EGLConfig               config_     = nullptr;
+        EGLContext              context_    = EGL_NO_CONTEXT;
+        EGLSurface              surface_    = EGL_NO_SURFACE;
+
+        ProfileOpenGLDescriptor profile_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif // /LLGL_GL_ENABLE_EGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -6,6 +6,7 @@
  */
 
 #include "LinuxGLContext.h"
+#include "LinuxEGLContext.h"
 #include "../../Ext/GLExtensions.h"
 #include "../../Ext/GLExtensionLoader.h"
 #include "../../../CheckedCast.h"
@@ -39,6 +40,25 @@ std::unique_ptr<GLContext> GLContext::Create(const RenderContextDescriptor& desc
     return MakeUnique<LinuxGLContext>(desc, surface, sharedContextGLX);
 }
 
+std::unique_ptr<GLContext> GLContext::CreateLoaderContext(GLContext& sharedContext)
+{
+    #ifdef LLGL_GL_ENABLE_EGL
+    if (sharedContext.IsHeadless())
+        return std::unique_ptr<GLContext>(new LinuxEGLContext(LLGL_CAST(LinuxEGLContext&, sharedContext)));
+    #endif // /LLGL_GL_ENABLE_EGL
+    return std::unique_ptr<GLContext>(new LinuxGLContext(LLGL_CAST(LinuxGLContext&, sharedContext)));
+}
+
+std::unique_ptr<GLContext> GLContext::CreateHeadless(const RenderContextDescriptor& desc, GLContext* sharedContext)
+{
+    #ifdef LLGL_GL_ENABLE_EGL
+    LinuxEGLContext* sharedContextEGL = (sharedContext != nullptr ? LLGL_CAST(LinuxEGLContext*, sharedContext) : nullptr);
+    return MakeUnique<LinuxEGLContext>(desc, sharedContextEGL);
+    #else
+    return nullptr;
+    #endif // /LLGL_GL_ENABLE_EGL
+}
+
 
 /*
  * LinuxGLContext class
@@ -52,9 +72,43 @@ LinuxGLContext::LinuxGLContext(const RenderContextDescriptor& desc, Surface& sur
     CreateContext(desc, nativeHandle, sharedContext);
 }
 
+LinuxGLContext::LinuxGLContext(LinuxGLContext& sharedContext) :
+    GLContext { &sharedContext, false     },
+    profile_  { sharedContext.profile_    }
+{
+    /*
+    Open a separate connection to the X11 display of the shared context, since Xlib displays must not be used by multiple threads
+    unless XInitThreads has been called before any other Xlib call, which the application might have made already.
+    The window and visual of the shared context are server-side resources and thus valid on this connection, too.
+    The window is only needed to make the context current, the loader context never renders into it.
+    */
+    display_ = XOpenDisplay(DisplayString(sharedContext.display_));
+    if (!display_)
+        throw std::runtime_error("failed to open X11 display for shared OpenGL loader context");
+
+    ownDisplay_ = true;
+    wnd_        = sharedContext.wnd_;
+    visual_     = sharedContext.visual_;
+
+    /* Create OpenGL context with the same profile as the shared context */
+    if (profile_.contextProfile == OpenGLContextProfile::CoreProfile)
+        glc_ = CreateContextCoreProfile(sharedContext.glc_, profile_.majorVersion, profile_.minorVersion);
+
+    if (!glc_)
+        glc_ = CreateContextCompatibilityProfile(sharedContext.glc_);
+
+    if (!glc_)
+    {
+        XCloseDisplay(display_);
+        throw std::runtime_error("failed to create shared OpenGL loader context on X11 client");
+    }
+}
+
 LinuxGLContext::~LinuxGLContext()
 {
     DeleteContext();
+    if (ownDisplay_)
+        XCloseDisplay(display_);
 }
 
 bool LinuxGLContext::SetSwapInterval(int interval)
@@ -87,7 +141,7 @@ bool LinuxGLContext::Activate(bool activate)
     if (activate)
         return glXMakeCurrent(display_, wnd_, glc_);
     else
-        return glXMakeCurrent(nullptr, 0, 0);
+        return glXMakeCurrent(display_, None, nullptr);
 }
 
 void LinuxGLContext::CreateContext(const RenderContextDescriptor& contextDesc, const NativeHandle& nativeHandle, LinuxGLContext* sharedContext)
@@ -104,6 +158,7 @@ void LinuxGLContext::CreateContext(const RenderContextDescriptor& contextDesc, c
 
     /* Create OpenGL context with X11 lib */
     const auto& profileDesc = contextDesc.profileOpenGL;
+    profile_ = profileDesc;
 
     if (profileDesc.contextProfile == OpenGLContextProfile::CoreProfile)
     {
@@ -181,7 +236,7 @@ GLXContext LinuxGLContext::CreateContextCoreProfile(GLXContext glcShared, int ma
                 None
             };
 
-            auto glc = glXCreateContextAttribsARB(display_, fbcList[0], nullptr, True, contextAttribs);
+            auto glc = glXCreateContextAttribsARB(display_, fbcList[0], glcShared, True, contextAttribs);
 
             XFree(fbcList);
 
@@ -25,6 +25,10 @@ class LinuxGLContext : public GLContext
     public:
 
         LinuxGLContext(const RenderContextDescriptor& desc, Surface& surface, LinuxGLContext* sharedContext);
+
+        // Creates a loader context for a worker thread that shares all GL objects with the specified context.
+        LinuxGLContext(LinuxGLContext& sharedContext);
+
         ~LinuxGLContext();
 
         bool SetSwapInterval(int interval) override;
@@ -45,6 +49,9 @@ class LinuxGLContext : public GLContext
         ::Window        wnd_        = 0;
         XVisualInfo*    visual_     = nullptr;
         GLXContext      glc_        = nullptr;
+        bool            ownDisplay_ = false;    // Loader contexts have their own display connection
+
+        ProfileOpenGLDescriptor profile_;
 
 };
 
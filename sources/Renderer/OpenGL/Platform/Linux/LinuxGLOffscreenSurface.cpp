@@ -0,0 +1,115 @@
+/*
+ * LinuxGLOffscreenSurface.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "LinuxGLOffscreenSurface.h"
+#include <LLGL/Platform/NativeHandle.h>
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+LinuxGLOffscreenSurface::LinuxGLOffscreenSurface(const Extent2D& size)
+{
+    desc_.size = size;
+}
+
+void LinuxGLOffscreenSurface::GetNativeHandle(void* nativeHandle) const
+{
+    /* There is no native surface, so always return a zero-initialized handle */
+    ::memset(nativeHandle, 0, sizeof(NativeHandle));
+}
+
+void LinuxGLOffscreenSurface::ResetPixelFormat()
+{
+    // dummy
+}
+
+Extent2D LinuxGLOffscreenSurface::GetContentSize() const
+{
+    return desc_.size;
+}
+
+bool LinuxGLOffscreenSurface::AdaptForVideoMode(VideoModeDescriptor& videoModeDesc)
+{
+    /* Off-screen surfaces cannot be shown in fullscreen mode */
+    desc_.size = videoModeDesc.resolution;
+    if (videoModeDesc.fullscreen)
+    {
+        videoModeDesc.fullscreen = false;
+        return false;
+    }
+    return true;
+}
+
+void LinuxGLOffscreenSurface::SetPosition(const Offset2D& position)
+{
+    desc_.position = position;
+}
+
+Offset2D LinuxGLOffscreenSurface::GetPosition() const
+{
+    return desc_.position;
+}
+
+void LinuxGLOffscreenSurface::SetSize(const Extent2D& size, bool /*useClientArea*/)
+{
+    desc_.size = size;
+}
+
+Extent2D LinuxGLOffscreenSurface::GetSize(bool /*useClientArea*/) const
+{
+    return desc_.size;
+}
+
+void LinuxGLOffscreenSurface::SetTitle(const std::wstring& title)
+{
+    desc_.title = title;
+}
+
+std::wstring LinuxGLOffscreenSurface::GetTitle() const
+{
+    return desc_.title;
+}
+
+void LinuxGLOffscreenSurface::Show(bool show)
+{
+    desc_.visible = show;
+}
+
+bool LinuxGLOffscreenSurface::IsShown() const
+{
+    return desc_.visible;
+}
+
+void LinuxGLOffscreenSurface::SetDesc(const WindowDescriptor& desc)
+{
+    desc_ = desc;
+}
+
+WindowDescriptor LinuxGLOffscreenSurface::GetDesc() const
+{
+    return desc_;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void LinuxGLOffscreenSurface::OnProcessEvents()
+{
+    // dummy
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
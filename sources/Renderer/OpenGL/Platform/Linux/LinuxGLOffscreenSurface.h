@@ -0,0 +1,70 @@
+/*
+ * LinuxGLOffscreenSurface.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_LINUX_GL_OFFSCREEN_SURFACE_H
+#define LLGL_LINUX_GL_OFFSCREEN_SURFACE_H
+
+
+#include <LLGL/Window.h>
+
+
+namespace LLGL
+{
+
+
+/*
+X11-independent surface for headless render contexts (see RenderSystemConfiguration::headlessRenderContexts) that is never shown on a display.
+It implements the Window interface, so the surface of a render context can still be used as a window on desktop platforms,
+but all window functions only modify the stored window descriptor. The native handle is always zero-initialized.
+*/
+class LinuxGLOffscreenSurface final : public Window
+{
+
+    public:
+
+        LinuxGLOffscreenSurface(const Extent2D& size);
+
+        void GetNativeHandle(void* nativeHandle) const override;
+
+        void ResetPixelFormat() override;
+
+        Extent2D GetContentSize() const override;
+
+        bool AdaptForVideoMode(VideoModeDescriptor& videoModeDesc) override;
+
+        void SetPosition(const Offset2D& position) override;
+        Offset2D GetPosition() const override;
+
+        void SetSize(const Extent2D& size, bool useClientArea = true) override;
+        Extent2D GetSize(bool useClientArea = true) const override;
+
+        void SetTitle(const std::wstring& title) override;
+        std::wstring GetTitle() const override;
+
+        void Show(bool show = true) override;
+        bool IsShown() const override;
+
+        void SetDesc(const WindowDescriptor& desc) override;
+        WindowDescriptor GetDesc() const override;
+
+    private:
+
+        void OnProcessEvents() override;
+
+        WindowDescriptor desc_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -26,6 +26,10 @@ class MacOSGLContext : public GLContext
     public:
 
         MacOSGLContext(const RenderContextDescriptor& desc, Surface& surface, MacOSGLContext* sharedContext);
+
+        // Creates a loader context for a worker thread that shares all GL objects with the specified context. It has no view.
+        MacOSGLContext(MacOSGLContext& sharedContext);
+
         ~MacOSGLContext();
 
         bool SetSwapInterval(int interval) override;
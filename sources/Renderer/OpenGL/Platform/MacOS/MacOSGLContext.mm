@@ -23,6 +23,16 @@ std::unique_ptr<GLContext> GLContext::Create(const RenderContextDescriptor& desc
     return MakeUnique<MacOSGLContext>(desc, surface, sharedContextGLNS);
 }
 
+std::unique_ptr<GLContext> GLContext::CreateLoaderContext(GLContext& sharedContext)
+{
+    return std::unique_ptr<GLContext>(new MacOSGLContext(LLGL_CAST(MacOSGLContext&, sharedContext)));
+}
+
+std::unique_ptr<GLContext> GLContext::CreateHeadless(const RenderContextDescriptor& /*desc*/, GLContext* /*sharedContext*/)
+{
+    return nullptr;
+}
+
 MacOSGLContext::MacOSGLContext(const RenderContextDescriptor& desc, Surface& surface, MacOSGLContext* sharedContext) :
     LLGL::GLContext { sharedContext }
 {
@@ -34,6 +44,17 @@ MacOSGLContext::MacOSGLContext(const RenderContextDescriptor& desc, Surface& sur
     CreateNSGLContext(nativeHandle, sharedContext);
 }
 
+MacOSGLContext::MacOSGLContext(MacOSGLContext& sharedContext) :
+    LLGL::GLContext { &sharedContext, false }
+{
+    /* Create new NS-OpenGL context with the same pixel format, which is required to share GL objects */
+    pixelFormat_ = [sharedContext.pixelFormat_ retain];
+
+    ctx_ = [[NSOpenGLContext alloc] initWithFormat:pixelFormat_ shareContext:sharedContext.ctx_];
+    if (!ctx_)
+        throw std::runtime_error("failed to create shared NSOpenGLContext for loader context");
+}
+
 MacOSGLContext::~MacOSGLContext()
 {
     DeleteNSGLContext();
@@ -67,8 +88,19 @@ void MacOSGLContext::Resize(const Extent2D& resolution)
 
 bool MacOSGLContext::Activate(bool activate)
 {
+    if (!activate)
+    {
+        /* Release context from the calling thread */
+        [NSOpenGLContext clearCurrentContext];
+        return true;
+    }
+
     /* Make context current */
     [ctx_ makeCurrentContext];
+
+    /* Loader contexts have no view */
+    if (wnd_ == nullptr)
+        return true;
     
     /* 'setView' is deprecated since macOS 10.14 together with OpenGL in general, so suppress this deprecation warning */
     #pragma clang diagnostic push
@@ -29,6 +29,16 @@ std::unique_ptr<GLContext> GLContext::Create(const RenderContextDescriptor& desc
     return MakeUnique<Win32GLContext>(desc, surface, sharedContextWGL);
 }
 
+std::unique_ptr<GLContext> GLContext::CreateLoaderContext(GLContext& sharedContext)
+{
+    return std::unique_ptr<GLContext>(new Win32GLContext(LLGL_CAST(Win32GLContext&, sharedContext)));
+}
+
+std::unique_ptr<GLContext> GLContext::CreateHeadless(const RenderContextDescriptor& /*desc*/, GLContext* /*sharedContext*/)
+{
+    return nullptr;
+}
+
 
 /*
  * Win32GLContext class
@@ -37,7 +47,7 @@ std::unique_ptr<GLContext> GLContext::Create(const RenderContextDescriptor& desc
 Win32GLContext::Win32GLContext(const RenderContextDescriptor& desc, Surface& surface, Win32GLContext* sharedContext) :
     GLContext { sharedContext },
     desc_     { desc          },
-    surface_  { surface       }
+    surface_  { &surface      }
 {
     if (sharedContext)
     {
@@ -48,9 +58,43 @@ Win32GLContext::Win32GLContext(const RenderContextDescriptor& desc, Surface& sur
         CreateContext(nullptr);
 }
 
+Win32GLContext::Win32GLContext(Win32GLContext& sharedContext) :
+    GLContext { &sharedContext, false },
+    desc_     { sharedContext.desc_   }
+{
+    /* Create a hidden window with the same pixel format, since a pixel format can only be set once per window */
+    CreateLoaderWindow(sharedContext);
+
+    /* Create OpenGL context with the same profile as the shared context; the profile version has already been determined by the shared context */
+    if (desc_.profileOpenGL.contextProfile != OpenGLContextProfile::CompatibilityProfile && wglCreateContextAttribsARB != nullptr)
+        hGLRC_ = CreateExtContextProfile(sharedContext.hGLRC_);
+    else if ((hGLRC_ = CreateStdContextProfile()) != 0)
+    {
+        /* Share resources before the new context is used for the first time */
+        if (!wglShareLists(sharedContext.hGLRC_, hGLRC_))
+        {
+            DeleteGLContext(hGLRC_);
+            hGLRC_ = 0;
+        }
+    }
+
+    if (!hGLRC_)
+    {
+        ReleaseDC(loaderWnd_, hDC_);
+        DestroyWindow(loaderWnd_);
+        throw std::runtime_error("failed to create shared OpenGL loader context");
+    }
+}
+
 Win32GLContext::~Win32GLContext()
 {
     DeleteContext();
+
+    if (loaderWnd_)
+    {
+        ReleaseDC(loaderWnd_, hDC_);
+        DestroyWindow(loaderWnd_);
+    }
 }
 
 bool Win32GLContext::SetSwapInterval(int interval)
@@ -325,7 +369,7 @@ void Win32GLContext::SetupDeviceContextAndPixelFormat()
     NativeHandle nativeHandle;
     nativeHandle.window = 0;
 
-    surface_.GetNativeHandle(&nativeHandle);
+    surface_->GetNativeHandle(&nativeHandle);
 
     if (!nativeHandle.window)
         throw std::runtime_error("invalid native Win32 window handle");
@@ -519,10 +563,32 @@ void Win32GLContext::CopyPixelFormat(Win32GLContext& sourceContext)
 void Win32GLContext::RecreateWindow()
 {
     /* Recreate window with current descriptor, then update device context and pixel format */
-    surface_.ResetPixelFormat();
+    surface_->ResetPixelFormat();
     SetupDeviceContextAndPixelFormat();
 }
 
+void Win32GLContext::CreateLoaderWindow(Win32GLContext& sharedContext)
+{
+    /* Create hidden window with a predefined window class; it is only needed to make the loader context current */
+    loaderWnd_ = CreateWindow(TEXT("STATIC"), TEXT(""), WS_POPUP, 0, 0, 1, 1, nullptr, nullptr, GetModuleHandle(nullptr), nullptr);
+    if (!loaderWnd_)
+        throw std::runtime_error("failed to create hidden window for OpenGL loader context");
+
+    hDC_ = GetDC(loaderWnd_);
+
+    /* Select the pixel format of the shared context, which is required to share GL objects */
+    PIXELFORMATDESCRIPTOR formatDesc;
+    pixelFormat_ = GetPixelFormat(sharedContext.hDC_);
+
+    if (!DescribePixelFormat(sharedContext.hDC_, pixelFormat_, sizeof(formatDesc), &formatDesc) ||
+        !SetPixelFormat(hDC_, pixelFormat_, &formatDesc))
+    {
+        ReleaseDC(loaderWnd_, hDC_);
+        DestroyWindow(loaderWnd_);
+        throw std::runtime_error("failed to set pixel format for OpenGL loader context");
+    }
+}
+
 
 } // /namespace LLGL
 
@@ -25,6 +25,10 @@ class Win32GLContext : public GLContext
     public:
 
         Win32GLContext(const RenderContextDescriptor& desc, Surface& surface, Win32GLContext* sharedContext);
+
+        // Creates a loader context for a worker thread that shares all GL objects with the specified context.
+        Win32GLContext(Win32GLContext& sharedContext);
+
         ~Win32GLContext();
 
         bool SetSwapInterval(int interval) override;
@@ -52,6 +56,8 @@ class Win32GLContext : public GLContext
 
         void RecreateWindow();
 
+        void CreateLoaderWindow(Win32GLContext& sharedContext);
+
         static const UINT       maxNumPixelFormatsMS_   = 8;
 
         int                     pixelFormat_            = 0;    //!< Standard pixel format.
@@ -61,7 +67,8 @@ class Win32GLContext : public GLContext
         HGLRC                   hGLRC_                  = 0;    //!< OpenGL render context handle.
 
         RenderContextDescriptor desc_;
-        Surface&                surface_;
+        Surface*                surface_                = nullptr;
+        HWND                    loaderWnd_              = 0;    //!< Hidden window of a loader context (see CreateLoaderContext).
 
         bool                    hasSharedContext_       = false;
 
@@ -11,9 +11,11 @@
 #include "../../GLCommon/GLCore.h"
 #include "../../GLCommon/GLTypes.h"
 #include "../../../Core/HelperMacros.h"
+#include "../../../Core/Helper.h"
 #include "../Texture/GLRenderTarget.h"
 #include "GLStateManager.h"
 #include <LLGL/GraphicsPipelineFlags.h>
+#include <cstring>
 
 
 namespace LLGL
@@ -51,36 +53,47 @@ GLBlendState::GLBlendState(const BlendDescriptor& desc, std::uint32_t numColorAt
         for (std::uint32_t i = 0; i < numColorAttachments; ++i)
             GLDrawBufferState::Convert(drawBuffers_[i], desc.targets[i]);
     }
+
+    hash_ = ComputeHash();
 }
 
-void GLBlendState::Bind(GLStateManager& stateMngr)
+void GLBlendState::Bind(GLStateManager& stateMngr, const GLBlendState* appliedState)
 {
+    const auto delta            = (appliedState != nullptr ? GetDeltaMask(*appliedState) : DeltaAll);
+    const auto drawBufferMask   = (delta >> DeltaDrawBufferShift);
+
     /* Set blend factor */
-    stateMngr.SetBlendColor(blendColor_);
-    stateMngr.Set(GLState::SAMPLE_ALPHA_TO_COVERAGE, sampleAlphaToCoverage_);
+    if ((delta & DeltaBlendColor) != 0)
+        stateMngr.SetBlendColor(blendColor_);
+    if ((delta & DeltaAlphaToCoverage) != 0)
+        stateMngr.Set(GLState::SAMPLE_ALPHA_TO_COVERAGE, sampleAlphaToCoverage_);
 
     if (logicOpEnabled_)
     {
         /* Enable logic pixel operation */
-        stateMngr.Enable(GLState::COLOR_LOGIC_OP);
-        stateMngr.SetLogicOp(logicOp_);
+        if ((delta & DeltaLogicOp) != 0)
+        {
+            stateMngr.Enable(GLState::COLOR_LOGIC_OP);
+            stateMngr.SetLogicOp(logicOp_);
+        }
 
         /* Bind only color masks for all draw buffers */
-        BindDrawBufferColorMasks(stateMngr);
+        BindDrawBufferColorMasks(stateMngr, drawBufferMask);
     }
     else
     {
         /* Disable logic pixel operation */
-        stateMngr.Disable(GLState::COLOR_LOGIC_OP);
+        if ((delta & DeltaLogicOp) != 0)
+            stateMngr.Disable(GLState::COLOR_LOGIC_OP);
 
         /* Bind blend states for all draw buffers */
-        BindDrawBufferStates(stateMngr);
+        BindDrawBufferStates(stateMngr, drawBufferMask);
     }
 }
 
 void GLBlendState::BindColorMaskOnly(GLStateManager& stateMngr)
 {
-    BindDrawBufferColorMasks(stateMngr);
+    BindDrawBufferColorMasks(stateMngr, ~0u);
 }
 
 int GLBlendState::CompareSWO(const GLBlendState& rhs) const
@@ -111,21 +124,82 @@ int GLBlendState::CompareSWO(const GLBlendState& rhs) const
  * ======= Private: =======
  */
 
-void GLBlendState::BindDrawBufferStates(GLStateManager& stateMngr)
+std::uint32_t GLBlendState::GetDeltaMask(const GLBlendState& appliedState) const
+{
+    std::uint32_t delta = 0;
+
+    if ( blendColor_[0] != appliedState.blendColor_[0] ||
+         blendColor_[1] != appliedState.blendColor_[1] ||
+         blendColor_[2] != appliedState.blendColor_[2] ||
+         blendColor_[3] != appliedState.blendColor_[3] )
+    {
+        delta |= DeltaBlendColor;
+    }
+
+    if (sampleAlphaToCoverage_ != appliedState.sampleAlphaToCoverage_)
+        delta |= DeltaAlphaToCoverage;
+
+    if (logicOpEnabled_ != appliedState.logicOpEnabled_ || (logicOpEnabled_ && logicOp_ != appliedState.logicOp_))
+        delta |= DeltaLogicOp;
+
+    if (numDrawBuffers_ != appliedState.numDrawBuffers_ || logicOpEnabled_ != appliedState.logicOpEnabled_)
+    {
+        /* Draw buffers are bound differently, so all of them must be bound */
+        delta |= (DeltaAll << DeltaDrawBufferShift);
+    }
+    else
+    {
+        /* Only color masks are bound while logic pixel operations are enabled, so only compare the remaining fields otherwise */
+        for (GLuint i = 0; i < numDrawBuffers_; ++i)
+        {
+            const auto& lhs = drawBuffers_[i];
+            const auto& rhs = appliedState.drawBuffers_[i];
+            if (logicOpEnabled_ ? ::memcmp(lhs.colorMask, rhs.colorMask, sizeof(lhs.colorMask)) != 0 : GLDrawBufferState::CompareSWO(lhs, rhs) != 0)
+                delta |= (1u << (DeltaDrawBufferShift + i));
+        }
+    }
+
+    return delta;
+}
+
+// Must only include the fields that are compared in CompareSWO
+std::size_t GLBlendState::ComputeHash() const
+{
+    std::size_t seed = 0;
+
+    for (auto component : blendColor_)
+        HashCombine(seed, component);
+
+    HashCombine(seed, sampleAlphaToCoverage_);
+    HashCombine(seed, logicOpEnabled_);
+    HashCombine(seed, logicOp_);
+    HashCombine(seed, numDrawBuffers_);
+
+    for (decltype(numDrawBuffers_) i = 0; i < numDrawBuffers_; ++i)
+        GLDrawBufferState::Hash(seed, drawBuffers_[i]);
+
+    return seed;
+}
+
+void GLBlendState::BindDrawBufferStates(GLStateManager& stateMngr, std::uint32_t drawBufferMask)
 {
     if (numDrawBuffers_ == 1)
     {
         /* Bind blend states for all draw buffers */
-        BindDrawBufferState(drawBuffers_[0]);
+        if ((drawBufferMask & 0x1) != 0)
+            BindDrawBufferState(drawBuffers_[0]);
     }
-    else if (numDrawBuffers_ > 1)
+    else if (numDrawBuffers_ > 1 && drawBufferMask != 0)
     {
         #ifdef GL_ARB_draw_buffers_blend
         if (HasExtension(GLExt::ARB_draw_buffers_blend))
         {
             /* Bind blend states for respective draw buffers directly via extension */
             for (GLuint i = 0; i < numDrawBuffers_; ++i)
-                BindIndexedDrawBufferState(drawBuffers_[i], i);
+            {
+                if ((drawBufferMask & (1u << i)) != 0)
+                    BindIndexedDrawBufferState(drawBuffers_[i], i);
+            }
         }
         else
         #endif // /GL_ARB_draw_buffers_blend
@@ -133,8 +207,11 @@ void GLBlendState::BindDrawBufferStates(GLStateManager& stateMngr)
             /* Bind blend states with emulated draw buffer setting */
             for (GLuint i = 0; i < numDrawBuffers_; ++i)
             {
-                glDrawBuffer(GLTypes::ToColorAttachment(i));
-                BindDrawBufferState(drawBuffers_[i]);
+                if ((drawBufferMask & (1u << i)) != 0)
+                {
+                    glDrawBuffer(GLTypes::ToColorAttachment(i));
+                    BindDrawBufferState(drawBuffers_[i]);
+                }
             }
 
             /* Restore draw buffer settings for current render target */
@@ -144,21 +221,25 @@ void GLBlendState::BindDrawBufferStates(GLStateManager& stateMngr)
     }
 }
 
-void GLBlendState::BindDrawBufferColorMasks(GLStateManager& stateMngr)
+void GLBlendState::BindDrawBufferColorMasks(GLStateManager& stateMngr, std::uint32_t drawBufferMask)
 {
     if (numDrawBuffers_ == 1)
     {
         /* Bind color mask for all draw buffers */
-        BindDrawBufferColorMask(drawBuffers_[0]);
+        if ((drawBufferMask & 0x1) != 0)
+            BindDrawBufferColorMask(drawBuffers_[0]);
     }
-    else if (numDrawBuffers_ > 1)
+    else if (numDrawBuffers_ > 1 && drawBufferMask != 0)
     {
         #ifdef GL_EXT_draw_buffers2
         if (HasExtension(GLExt::EXT_draw_buffers2))
         {
             /* Bind color mask for respective draw buffers directly via extension */
             for (GLuint i = 0; i < numDrawBuffers_; ++i)
-                BindIndexedDrawBufferColorMask(drawBuffers_[i], i);
+            {
+                if ((drawBufferMask & (1u << i)) != 0)
+                    BindIndexedDrawBufferColorMask(drawBuffers_[i], i);
+            }
         }
         else
         #endif // /GL_EXT_draw_buffers2
@@ -166,8 +247,11 @@ void GLBlendState::BindDrawBufferColorMasks(GLStateManager& stateMngr)
             /* Bind color masks with emulated draw buffer setting */
             for (GLuint i = 0; i < numDrawBuffers_; ++i)
             {
-                glDrawBuffer(GLTypes::ToColorAttachment(i));
-                BindDrawBufferColorMask(drawBuffers_[i]);
+                if ((drawBufferMask & (1u << i)) != 0)
+                {
+                    glDrawBuffer(GLTypes::ToColorAttachment(i));
+                    BindDrawBufferColorMask(drawBuffers_[i]);
+                }
             }
 
             /* Restore draw buffer settings for current render target */
@@ -257,6 +341,19 @@ int GLBlendState::GLDrawBufferState::CompareSWO(const GLDrawBufferState& lhs, co
     return 0;
 }
 
+void GLBlendState::GLDrawBufferState::Hash(std::size_t& seed, const GLDrawBufferState& state)
+{
+    HashCombine(seed, state.blendEnabled);
+    HashCombine(seed, state.srcColor    );
+    HashCombine(seed, state.dstColor    );
+    HashCombine(seed, state.funcColor   );
+    HashCombine(seed, state.srcAlpha    );
+    HashCombine(seed, state.dstAlpha    );
+    HashCombine(seed, state.funcAlpha   );
+    for (auto mask : state.colorMask)
+        HashCombine(seed, mask);
+}
+
 
 } // /namespace LLGL
 
@@ -13,6 +13,7 @@
 #include "../OpenGL.h"
 #include "../../StaticLimits.h"
 #include <memory>
+#include <cstdint>
 
 
 namespace LLGL
@@ -35,18 +36,36 @@ class GLBlendState
 
         GLBlendState(const BlendDescriptor& desc, std::uint32_t numColorAttachments);
 
-        void Bind(GLStateManager& stateMngr);
+        // Binds this blend state. If 'appliedState' is non-null, only the fields that differ from this previously applied state are bound.
+        void Bind(GLStateManager& stateMngr, const GLBlendState* appliedState = nullptr);
         void BindColorMaskOnly(GLStateManager& stateMngr);
 
         // Returns a signed integer of the strict-weak-order (SWO) comparison, and 0 on equality.
         int CompareSWO(const GLBlendState& rhs) const;
 
+        // Returns the hash of this state, which is computed on construction. States for which CompareSWO returns 0 have the same hash.
+        inline std::size_t GetHash() const
+        {
+            return hash_;
+        }
+
     private:
 
+        // Bitmask of the field groups that differ between two blend states. The upper bits specify the draw buffers that differ.
+        enum DeltaBits : std::uint32_t
+        {
+            DeltaBlendColor         = (1 << 0),
+            DeltaAlphaToCoverage    = (1 << 1),
+            DeltaLogicOp            = (1 << 2),
+            DeltaDrawBufferShift    = 8,
+            DeltaAll                = 0xFFFFFFFF,
+        };
+
         struct GLDrawBufferState
         {
             static void Convert(GLDrawBufferState& dst, const BlendTargetDescriptor& src);
             static int CompareSWO(const GLDrawBufferState& lhs, const GLDrawBufferState& rhs);
+            static void Hash(std::size_t& seed, const GLDrawBufferState& state);
 
             GLboolean   blendEnabled    = GL_FALSE;
             GLenum      srcColor        = GL_ONE;
@@ -58,8 +77,12 @@ class GLBlendState
             GLboolean   colorMask[4]    = { GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE };
         };
 
-        void BindDrawBufferStates(GLStateManager& stateMngr);
-        void BindDrawBufferColorMasks(GLStateManager& stateMngr);
+        std::uint32_t GetDeltaMask(const GLBlendState& appliedState) const;
+
+        std::size_t ComputeHash() const;
+
+        void BindDrawBufferStates(GLStateManager& stateMngr, std::uint32_t drawBufferMask);
+        void BindDrawBufferColorMasks(GLStateManager& stateMngr, std::uint32_t drawBufferMask);
 
         void BindDrawBufferState(const GLDrawBufferState& state);
         void BindIndexedDrawBufferState(const GLDrawBufferState& state, GLuint index);
@@ -74,6 +97,8 @@ class GLBlendState
         GLuint              numDrawBuffers_                                 = 0;
         GLDrawBufferState   drawBuffers_[LLGL_MAX_NUM_COLOR_ATTACHMENTS]    = {};
 
+        std::size_t         hash_                                           = 0;
+
 };
 
 
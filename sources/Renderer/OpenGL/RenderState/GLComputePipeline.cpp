@@ -26,7 +26,7 @@ GLComputePipeline::GLComputePipeline(const ComputePipelineDescriptor& desc)
 void GLComputePipeline::Bind(GLStateManager& stateMngr)
 {
     /* Setup shader state */
-    stateMngr.BindShaderProgram(shaderProgram_->GetID());
+    shaderProgram_->Bind(stateMngr);
 }
 
 
@@ -11,6 +11,7 @@
 #include "../../GLCommon/GLCore.h"
 #include "../../GLCommon/GLTypes.h"
 #include "../../../Core/HelperMacros.h"
+#include "../../../Core/Helper.h"
 #include "GLStateManager.h"
 #include <LLGL/GraphicsPipelineFlags.h>
 
@@ -31,26 +32,36 @@ GLDepthStencilState::GLDepthStencilState(const DepthDescriptor& depthDesc, const
     GLStencilFaceState::Convert(stencilFront_, stencilDesc.front);
     GLStencilFaceState::Convert(stencilBack_, stencilDesc.back);
 
-    independentStencilFaces_ = (GLStencilFaceState::CompareSWO(stencilFront_, stencilBack_) == 0);
+    independentStencilFaces_ = (GLStencilFaceState::CompareSWO(stencilFront_, stencilBack_) != 0);
+
+    hash_ = ComputeHash();
 }
 
-void GLDepthStencilState::Bind(GLStateManager& stateMngr)
+void GLDepthStencilState::Bind(GLStateManager& stateMngr, const GLDepthStencilState* appliedState)
 {
+    const auto delta = (appliedState != nullptr ? GetDeltaMask(*appliedState) : DeltaAll);
+
     /* Setup depth state */
-    if (depthTestEnabled_)
+    if ((delta & DeltaDepthTest) != 0)
     {
-        stateMngr.Enable(GLState::DEPTH_TEST);
-        stateMngr.SetDepthFunc(depthFunc_);
+        if (depthTestEnabled_)
+        {
+            stateMngr.Enable(GLState::DEPTH_TEST);
+            stateMngr.SetDepthFunc(depthFunc_);
+        }
+        else
+            stateMngr.Disable(GLState::DEPTH_TEST);
     }
-    else
-        stateMngr.Disable(GLState::DEPTH_TEST);
 
-    stateMngr.SetDepthMask(depthMask_);
+    if ((delta & DeltaDepthMask) != 0)
+        stateMngr.SetDepthMask(depthMask_);
 
     /* Setup stencil state */
-    if (stencilTestEnabled_)
+    if ((delta & DeltaStencilTest) != 0)
+        stateMngr.Set(GLState::STENCIL_TEST, stencilTestEnabled_);
+
+    if (stencilTestEnabled_ && (delta & DeltaStencilFaces) != 0)
     {
-        stateMngr.Enable(GLState::STENCIL_TEST);
         if (independentStencilFaces_)
         {
             BindStencilFaceState(stencilFront_, GL_FRONT);
@@ -59,8 +70,6 @@ void GLDepthStencilState::Bind(GLStateManager& stateMngr)
         else
             BindStencilState(stencilFront_);
     }
-    else
-        stateMngr.Disable(GLState::STENCIL_TEST);
 }
 
 int GLDepthStencilState::CompareSWO(const GLDepthStencilState& rhs) const
@@ -85,7 +94,7 @@ int GLDepthStencilState::CompareSWO(const GLDepthStencilState& rhs) const
                 return order;
         }
 
-        if (!independentStencilFaces_)
+        if (independentStencilFaces_)
         {
             auto order = GLStencilFaceState::CompareSWO(stencilBack_, rhs.stencilBack_);
             if (order != 0)
@@ -101,6 +110,58 @@ int GLDepthStencilState::CompareSWO(const GLDepthStencilState& rhs) const
  * ======= Private: =======
  */
 
+std::uint32_t GLDepthStencilState::GetDeltaMask(const GLDepthStencilState& appliedState) const
+{
+    std::uint32_t delta = 0;
+
+    if (depthTestEnabled_ != appliedState.depthTestEnabled_ || (depthTestEnabled_ && depthFunc_ != appliedState.depthFunc_))
+        delta |= DeltaDepthTest;
+
+    if (depthMask_ != appliedState.depthMask_)
+        delta |= DeltaDepthMask;
+
+    if (stencilTestEnabled_ != appliedState.stencilTestEnabled_)
+        delta |= DeltaStencilTest;
+
+    /* Stencil faces are not applied while the stencil test is disabled, so they are compared only if both states have it enabled */
+    if (stencilTestEnabled_)
+    {
+        if ( !appliedState.stencilTestEnabled_                                                                      ||
+             independentStencilFaces_ != appliedState.independentStencilFaces_                                      ||
+             GLStencilFaceState::CompareSWO(stencilFront_, appliedState.stencilFront_) != 0                         ||
+             (independentStencilFaces_ && GLStencilFaceState::CompareSWO(stencilBack_, appliedState.stencilBack_) != 0) )
+        {
+            delta |= DeltaStencilFaces;
+        }
+    }
+
+    return delta;
+}
+
+// Must only include the fields that are compared in CompareSWO
+std::size_t GLDepthStencilState::ComputeHash() const
+{
+    std::size_t seed = 0;
+
+    HashCombine(seed, depthTestEnabled_);
+    if (depthTestEnabled_)
+    {
+        HashCombine(seed, depthMask_);
+        HashCombine(seed, depthFunc_);
+    }
+
+    HashCombine(seed, stencilTestEnabled_);
+    if (stencilTestEnabled_)
+    {
+        HashCombine(seed, independentStencilFaces_);
+        GLStencilFaceState::Hash(seed, stencilFront_);
+        if (independentStencilFaces_)
+            GLStencilFaceState::Hash(seed, stencilBack_);
+    }
+
+    return seed;
+}
+
 void GLDepthStencilState::BindStencilFaceState(const GLStencilFaceState& state, GLenum face)
 {
     glStencilOpSeparate(face, state.sfail, state.dpfail, state.dppass);
@@ -143,6 +204,17 @@ int GLDepthStencilState::GLStencilFaceState::CompareSWO(const GLStencilFaceState
     return 0;
 }
 
+void GLDepthStencilState::GLStencilFaceState::Hash(std::size_t& seed, const GLStencilFaceState& state)
+{
+    HashCombine(seed, state.sfail    );
+    HashCombine(seed, state.dpfail   );
+    HashCombine(seed, state.dppass   );
+    HashCombine(seed, state.func     );
+    HashCombine(seed, state.ref      );
+    HashCombine(seed, state.mask     );
+    HashCombine(seed, state.writeMask);
+}
+
 
 } // /namespace LLGL
 
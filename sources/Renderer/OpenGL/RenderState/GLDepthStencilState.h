@@ -13,6 +13,7 @@
 #include "../OpenGL.h"
 #include "../../StaticLimits.h"
 #include <memory>
+#include <cstdint>
 
 
 namespace LLGL
@@ -35,17 +36,35 @@ class GLDepthStencilState
 
         GLDepthStencilState(const DepthDescriptor& depthDesc, const StencilDescriptor& stencilDesc);
 
-        void Bind(GLStateManager& stateMngr);
+        // Binds this depth-stencil state. If 'appliedState' is non-null, only the fields that differ from this previously applied state are bound.
+        void Bind(GLStateManager& stateMngr, const GLDepthStencilState* appliedState = nullptr);
 
         // Returns a signed integer of the strict-weak-order (SWO) comparison, and 0 on equality.
         int CompareSWO(const GLDepthStencilState& rhs) const;
 
+        // Returns the hash of this state, which is computed on construction. States for which CompareSWO returns 0 have the same hash.
+        inline std::size_t GetHash() const
+        {
+            return hash_;
+        }
+
     private:
 
+        // Bitmask of the field groups that differ between two depth-stencil states.
+        enum DeltaBits : std::uint32_t
+        {
+            DeltaDepthTest      = (1 << 0),
+            DeltaDepthMask      = (1 << 1),
+            DeltaStencilTest    = (1 << 2),
+            DeltaStencilFaces   = (1 << 3),
+            DeltaAll            = 0xF,
+        };
+
         struct GLStencilFaceState
         {
             static void Convert(GLStencilFaceState& dst, const StencilFaceDescriptor& src);
             static int CompareSWO(const GLStencilFaceState& lhs, const GLStencilFaceState& rhs);
+            static void Hash(std::size_t& seed, const GLStencilFaceState& state);
 
             GLenum  sfail       = GL_KEEP;
             GLenum  dpfail      = GL_KEEP;
@@ -56,6 +75,10 @@ class GLDepthStencilState
             GLuint  writeMask   = ~0;
         };
 
+        std::uint32_t GetDeltaMask(const GLDepthStencilState& appliedState) const;
+
+        std::size_t ComputeHash() const;
+
         void BindStencilFaceState(const GLStencilFaceState& state, GLenum face);
         void BindStencilState(const GLStencilFaceState& state);
 
@@ -70,6 +93,8 @@ class GLDepthStencilState
         GLStencilFaceState  stencilFront_;
         GLStencilFaceState  stencilBack_;
 
+        std::size_t         hash_                       = 0;
+
 };
 
 
@@ -79,7 +79,10 @@ GLGraphicsPipeline::~GLGraphicsPipeline()
 void GLGraphicsPipeline::Bind(GLStateManager& stateMngr)
 {
     /* Bind shader program and discard rasterizer if there is no fragment shader */
-    stateMngr.BindShaderProgram(shaderProgram_->GetID());
+    shaderProgram_->Bind(stateMngr);
+
+    /* Bind vertex format, so subsequent vertex buffers only change the buffer bindings */
+    stateMngr.BindVertexFormat(shaderProgram_->GetVertexFormatVAO());
 
     /* Set input-assembler state */
     if (patchVertices_ > 0)
@@ -44,6 +44,12 @@ class GLGraphicsPipeline final : public GraphicsPipeline
             return drawMode_;
         }
 
+        // Returns true if this pipeline has static viewports or scissors, which are set whenever the pipeline is bound.
+        inline bool HasStaticViewportsOrScissors() const
+        {
+            return (staticStateBuffer_ != nullptr);
+        }
+
     private:
 
         void BuildStaticStateBuffer(const GraphicsPipelineDescriptor& desc);
@@ -0,0 +1,131 @@
+/*
+ * GLMemoryBarrierTracker.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLMemoryBarrierTracker.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+void GLMemoryBarrierTracker::RecordShaderWrite(GLuint buffer)
+{
+    for (auto& entry : pendingWrites_)
+    {
+        if (entry.buffer == buffer)
+        {
+            entry.access = GLBarrierAccess::All;
+            return;
+        }
+    }
+    pendingWrites_.push_back({ buffer, GLBarrierAccess::All });
+}
+
+long GLMemoryBarrierTracker::GetPendingAccess(GLuint buffer, long access) const
+{
+    for (const auto& entry : pendingWrites_)
+    {
+        if (entry.buffer == buffer)
+            return (entry.access & access);
+    }
+    return 0;
+}
+
+void GLMemoryBarrierTracker::Resolve(long access)
+{
+    /* Remove resolved accesses, and remove the buffers without any pending accesses */
+    for (auto& entry : pendingWrites_)
+        entry.access &= ~access;
+
+    pendingWrites_.erase(
+        std::remove_if(
+            pendingWrites_.begin(), pendingWrites_.end(),
+            [](const PendingWrite& entry)
+            {
+                return (entry.access == 0);
+            }
+        ),
+        pendingWrites_.end()
+    );
+}
+
+void GLMemoryBarrierTracker::NotifyBufferRelease(GLuint buffer)
+{
+    pendingWrites_.erase(
+        std::remove_if(
+            pendingWrites_.begin(), pendingWrites_.end(),
+            [buffer](const PendingWrite& entry)
+            {
+                return (entry.buffer == buffer);
+            }
+        ),
+        pendingWrites_.end()
+    );
+}
+
+struct GLBarrierAccessBit
+{
+    long        access;
+    GLbitfield  bit;
+    const char* name;
+};
+
+static const GLBarrierAccessBit g_barrierAccessBits[] =
+{
+    #ifdef GL_ARB_shader_image_load_store
+    { GLBarrierAccess::VertexAttribArray,   GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT, "GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT" },
+    { GLBarrierAccess::ElementArray,        GL_ELEMENT_ARRAY_BARRIER_BIT,       "GL_ELEMENT_ARRAY_BARRIER_BIT"       },
+    { GLBarrierAccess::Uniform,             GL_UNIFORM_BARRIER_BIT,             "GL_UNIFORM_BARRIER_BIT"             },
+    { GLBarrierAccess::Command,             GL_COMMAND_BARRIER_BIT,             "GL_COMMAND_BARRIER_BIT"             },
+    { GLBarrierAccess::BufferUpdate,        GL_BUFFER_UPDATE_BARRIER_BIT,       "GL_BUFFER_UPDATE_BARRIER_BIT"       },
+    #endif // /GL_ARB_shader_image_load_store
+    #ifdef GL_ARB_shader_storage_buffer_object
+    { GLBarrierAccess::ShaderStorage,       GL_SHADER_STORAGE_BARRIER_BIT,      "GL_SHADER_STORAGE_BARRIER_BIT"      },
+    #endif // /GL_ARB_shader_storage_buffer_object
+    #ifdef GL_ARB_query_buffer_object
+    { GLBarrierAccess::QueryBuffer,         GL_QUERY_BUFFER_BARRIER_BIT,        "GL_QUERY_BUFFER_BARRIER_BIT"        },
+    #endif // /GL_ARB_query_buffer_object
+    { 0, 0, nullptr }
+};
+
+GLbitfield GLMemoryBarrierTracker::ToGLBarrierBits(long access)
+{
+    GLbitfield bits = 0;
+
+    for (auto entry = g_barrierAccessBits; entry->name != nullptr; ++entry)
+    {
+        if ((access & entry->access) != 0)
+            bits |= entry->bit;
+    }
+
+    return bits;
+}
+
+std::string GLMemoryBarrierTracker::ToString(long access)
+{
+    std::string s;
+
+    for (auto entry = g_barrierAccessBits; entry->name != nullptr; ++entry)
+    {
+        if ((access & entry->access) != 0)
+        {
+            if (!s.empty())
+                s += " | ";
+            s += entry->name;
+        }
+    }
+
+    return s;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,111 @@
+/*
+ * GLMemoryBarrierTracker.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_MEMORY_BARRIER_TRACKER_H
+#define LLGL_GL_MEMORY_BARRIER_TRACKER_H
+
+
+#include "../OpenGL.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+// Buffer accesses that must wait for previous shader storage writes. Each access corresponds to one bit of glMemoryBarrier.
+struct GLBarrierAccess
+{
+    enum
+    {
+        VertexAttribArray   = (1 << 0), // GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT
+        ElementArray        = (1 << 1), // GL_ELEMENT_ARRAY_BARRIER_BIT
+        Uniform             = (1 << 2), // GL_UNIFORM_BARRIER_BIT
+        Command             = (1 << 3), // GL_COMMAND_BARRIER_BIT
+        BufferUpdate        = (1 << 4), // GL_BUFFER_UPDATE_BARRIER_BIT
+        ShaderStorage       = (1 << 5), // GL_SHADER_STORAGE_BARRIER_BIT
+        QueryBuffer         = (1 << 6), // GL_QUERY_BUFFER_BARRIER_BIT
+
+        All                 = (1 << 7) - 1,
+    };
+};
+
+/*
+Keeps track of the buffers that may have been written by shaders through shader storage buffers,
+and of the accesses to these buffers for which no memory barrier has been inserted yet.
+Since a memory barrier makes all previous shader writes visible for the specified accesses, the pending accesses are resolved for all buffers at once.
+*/
+class GLMemoryBarrierTracker
+{
+
+    public:
+
+        // Records that the specified buffer may have been written by a shader. All accesses to this buffer are pending until a memory barrier is inserted for them.
+        void RecordShaderWrite(GLuint buffer);
+
+        // Returns the subset of the specified accesses (bitwise OR of GLBarrierAccess) for which the specified buffer has pending shader writes.
+        long GetPendingAccess(GLuint buffer, long access) const;
+
+        // Removes the specified accesses from all pending shader writes, i.e. after a memory barrier for these accesses has been inserted.
+        void Resolve(long access);
+
+        // Removes the specified buffer from the pending shader writes.
+        void NotifyBufferRelease(GLuint buffer);
+
+        // Returns true if there is any buffer with pending shader writes.
+        inline bool HasPendingWrites() const
+        {
+            return !pendingWrites_.empty();
+        }
+
+        /*
+        Specifies which of the shader storage buffer slots in 'slotMask' are bound with write access (see CommandBuffer::SetRWStorageBuffer).
+        All slots are considered writable until they have been specified otherwise.
+        */
+        inline void SetStorageWriteMask(std::uint64_t slotMask, std::uint64_t writeMask)
+        {
+            storageWriteMask_ = ((storageWriteMask_ & ~slotMask) | (writeMask & slotMask));
+        }
+
+        // Returns the shader storage buffer slots that are bound with write access.
+        inline std::uint64_t GetStorageWriteMask() const
+        {
+            return storageWriteMask_;
+        }
+
+        // Converts the specified accesses (bitwise OR of GLBarrierAccess) into the bitfield for glMemoryBarrier.
+        static GLbitfield ToGLBarrierBits(long access);
+
+        // Returns a descriptive string of the specified accesses (bitwise OR of GLBarrierAccess), e.g. "GL_UNIFORM_BARRIER_BIT | GL_COMMAND_BARRIER_BIT".
+        static std::string ToString(long access);
+
+    private:
+
+        struct PendingWrite
+        {
+            GLuint  buffer;
+            long    access;
+        };
+
+    private:
+
+        std::vector<PendingWrite>   pendingWrites_;
+        std::uint64_t               storageWriteMask_   = ~0ull;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -6,6 +6,7 @@
  */
 
 #include "GLQueryHeap.h"
+#include "GLStateManager.h"
 #include "../Ext/GLExtensions.h"
 #include "../../GLCommon/GLExtensionRegistry.h"
 #include "../../GLCommon/GLTypes.h"
@@ -102,6 +103,56 @@ void GLQueryHeap::End(std::uint32_t query)
         glEndQuery(MapQueryType(GetType(), groupSize_ - i));
 }
 
+void GLQueryHeap::Resolve(GLStateManager& stateMngr, std::uint32_t firstQuery, std::uint32_t numQueries, GLuint buffer, GLintptr offset)
+{
+    /* Multiply query range by the query group size */
+    firstQuery *= groupSize_;
+    numQueries *= groupSize_;
+
+    #ifdef GL_ARB_query_buffer_object
+    if (HasExtension(GLExt::ARB_query_buffer_object))
+    {
+        /* Write query results into query buffer; the GPU waits for the results instead of the CPU */
+        stateMngr.FlushBufferMemoryBarrier(buffer, GLBarrierAccess::QueryBuffer);
+        stateMngr.BindBuffer(GLBufferTarget::QUERY_BUFFER, buffer);
+        {
+            for (std::uint32_t i = 0; i < numQueries; ++i)
+            {
+                auto dstOffset = offset + static_cast<GLintptr>(sizeof(GLuint64) * i);
+                glGetQueryObjectui64v(ids_[firstQuery + i], GL_QUERY_RESULT, reinterpret_cast<GLuint64*>(dstOffset));
+            }
+        }
+        /* Unbind query buffer, so that subsequent query results are written into client memory again */
+        stateMngr.BindBuffer(GLBufferTarget::QUERY_BUFFER, 0);
+    }
+    else
+    #endif // /GL_ARB_query_buffer_object
+    {
+        /* Wait for query results and upload them into the buffer */
+        std::vector<GLuint64> results(numQueries, 0);
+
+        for (std::uint32_t i = 0; i < numQueries; ++i)
+        {
+            if (HasExtension(GLExt::ARB_timer_query))
+                glGetQueryObjectui64v(ids_[firstQuery + i], GL_QUERY_RESULT, &results[i]);
+            else
+            {
+                GLuint result32 = 0;
+                glGetQueryObjectuiv(ids_[firstQuery + i], GL_QUERY_RESULT, &result32);
+                results[i] = result32;
+            }
+        }
+
+        stateMngr.FlushBufferMemoryBarrier(buffer, GLBarrierAccess::BufferUpdate);
+        stateMngr.PushBoundBuffer(GLBufferTarget::COPY_WRITE_BUFFER);
+        {
+            stateMngr.BindBuffer(GLBufferTarget::COPY_WRITE_BUFFER, buffer);
+            glBufferSubData(GL_COPY_WRITE_BUFFER, offset, static_cast<GLsizeiptr>(sizeof(GLuint64) * numQueries), results.data());
+        }
+        stateMngr.PopBoundBuffer();
+    }
+}
+
 
 } // /namespace LLGL
 
@@ -18,6 +18,8 @@ namespace LLGL
 {
 
 
+class GLStateManager;
+
 class GLQueryHeap final : public QueryHeap
 {
 
@@ -29,6 +31,13 @@ class GLQueryHeap final : public QueryHeap
         void Begin(std::uint32_t query);
         void End(std::uint32_t query);
 
+        /*
+        Writes the results of the specified queries as 64-bit values into the buffer at the specified offset.
+        With GL_ARB_query_buffer_object the results are written by the GPU without a round-trip to the CPU,
+        otherwise this waits for the results and uploads them into the buffer.
+        */
+        void Resolve(GLStateManager& stateMngr, std::uint32_t firstQuery, std::uint32_t numQueries, GLuint buffer, GLintptr offset);
+
         // Returns the first ID.
         inline GLuint GetFirstID(std::uint32_t query) const
         {
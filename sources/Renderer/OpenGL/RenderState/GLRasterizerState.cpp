@@ -11,6 +11,7 @@
 #include "../../GLCommon/GLCore.h"
 #include "../../GLCommon/GLTypes.h"
 #include "../../../Core/HelperMacros.h"
+#include "../../../Core/Helper.h"
 #include "GLStateManager.h"
 #include <LLGL/GraphicsPipelineFlags.h>
 
@@ -57,38 +58,57 @@ GLRasterizerState::GLRasterizerState(const RasterizerDescriptor& desc)
     #ifdef LLGL_GL_ENABLE_VENDOR_EXT
     conservativeRaster_     = desc.conservativeRasterization;
     #endif
+
+    hash_ = ComputeHash();
 }
 
-void GLRasterizerState::Bind(GLStateManager& stateMngr)
+void GLRasterizerState::Bind(GLStateManager& stateMngr, const GLRasterizerState* appliedState)
 {
-    stateMngr.SetPolygonMode(polygonMode_);
-    stateMngr.SetFrontFace(frontFace_);
-    stateMngr.Set(GLState::RASTERIZER_DISCARD, rasterizerDiscard_);
+    const auto delta = (appliedState != nullptr ? GetDeltaMask(*appliedState) : DeltaAll);
+
+    if ((delta & DeltaPolygonMode) != 0)
+        stateMngr.SetPolygonMode(polygonMode_);
+    if ((delta & DeltaFrontFace) != 0)
+        stateMngr.SetFrontFace(frontFace_);
+    if ((delta & DeltaRasterizerDiscard) != 0)
+        stateMngr.Set(GLState::RASTERIZER_DISCARD, rasterizerDiscard_);
 
-    if (cullFace_ != 0)
+    if ((delta & DeltaCullFace) != 0)
     {
-        stateMngr.Enable(GLState::CULL_FACE);
-        stateMngr.SetCullFace(cullFace_);
+        if (cullFace_ != 0)
+        {
+            stateMngr.Enable(GLState::CULL_FACE);
+            stateMngr.SetCullFace(cullFace_);
+        }
+        else
+            stateMngr.Disable(GLState::CULL_FACE);
     }
-    else
-        stateMngr.Disable(GLState::CULL_FACE);
 
-    if (polygonOffsetEnabled_)
+    if ((delta & DeltaPolygonOffset) != 0)
     {
-        stateMngr.Enable(polygonOffsetMode_);
-        stateMngr.SetPolygonOffset(polygonOffsetFactor_, polygonOffsetUnits_, polygonOffsetClamp_);
+        if (polygonOffsetEnabled_)
+        {
+            stateMngr.Enable(polygonOffsetMode_);
+            stateMngr.SetPolygonOffset(polygonOffsetFactor_, polygonOffsetUnits_, polygonOffsetClamp_);
+        }
+        else
+            stateMngr.Disable(polygonOffsetMode_);
     }
-    else
-        stateMngr.Disable(polygonOffsetMode_);
 
-    stateMngr.Set(GLState::SCISSOR_TEST, scissorTestEnabled_);
-    stateMngr.Set(GLState::DEPTH_CLAMP, depthClampEnabled_);
-    stateMngr.Set(GLState::MULTISAMPLE, multiSampleEnabled_);
-    stateMngr.Set(GLState::LINE_SMOOTH, lineSmoothEnabled_);
-    stateMngr.SetLineWidth(lineWidth_);
+    if ((delta & DeltaScissorTest) != 0)
+        stateMngr.Set(GLState::SCISSOR_TEST, scissorTestEnabled_);
+    if ((delta & DeltaDepthClamp) != 0)
+        stateMngr.Set(GLState::DEPTH_CLAMP, depthClampEnabled_);
+    if ((delta & DeltaMultiSample) != 0)
+        stateMngr.Set(GLState::MULTISAMPLE, multiSampleEnabled_);
+    if ((delta & DeltaLineSmooth) != 0)
+        stateMngr.Set(GLState::LINE_SMOOTH, lineSmoothEnabled_);
+    if ((delta & DeltaLineWidth) != 0)
+        stateMngr.SetLineWidth(lineWidth_);
 
     #ifdef LLGL_GL_ENABLE_VENDOR_EXT
-    stateMngr.Set(GLStateExt::CONSERVATIVE_RASTERIZATION, conservativeRaster_);
+    if ((delta & DeltaConservativeRaster) != 0)
+        stateMngr.Set(GLStateExt::CONSERVATIVE_RASTERIZATION, conservativeRaster_);
     #endif
 
     #if 0//TODO
@@ -104,6 +124,7 @@ int GLRasterizerState::CompareSWO(const GLRasterizerState& rhs) const
     LLGL_COMPARE_MEMBER_SWO     ( polygonMode_          );
     LLGL_COMPARE_MEMBER_SWO     ( cullFace_             );
     LLGL_COMPARE_MEMBER_SWO     ( frontFace_            );
+    LLGL_COMPARE_BOOL_MEMBER_SWO( rasterizerDiscard_    );
     LLGL_COMPARE_BOOL_MEMBER_SWO( scissorTestEnabled_   );
     LLGL_COMPARE_BOOL_MEMBER_SWO( depthClampEnabled_    );
     LLGL_COMPARE_BOOL_MEMBER_SWO( multiSampleEnabled_   );
@@ -124,6 +145,80 @@ int GLRasterizerState::CompareSWO(const GLRasterizerState& rhs) const
 }
 
 
+/*
+ * ======= Private: =======
+ */
+
+std::uint32_t GLRasterizerState::GetDeltaMask(const GLRasterizerState& appliedState) const
+{
+    std::uint32_t delta = 0;
+
+    if (polygonMode_ != appliedState.polygonMode_)
+        delta |= DeltaPolygonMode;
+    if (frontFace_ != appliedState.frontFace_)
+        delta |= DeltaFrontFace;
+    if (rasterizerDiscard_ != appliedState.rasterizerDiscard_)
+        delta |= DeltaRasterizerDiscard;
+    if (cullFace_ != appliedState.cullFace_)
+        delta |= DeltaCullFace;
+
+    if ( polygonOffsetEnabled_  != appliedState.polygonOffsetEnabled_   ||
+         polygonOffsetMode_     != appliedState.polygonOffsetMode_      ||
+         polygonOffsetFactor_   != appliedState.polygonOffsetFactor_    ||
+         polygonOffsetUnits_    != appliedState.polygonOffsetUnits_     ||
+         polygonOffsetClamp_    != appliedState.polygonOffsetClamp_ )
+    {
+        delta |= DeltaPolygonOffset;
+    }
+
+    if (scissorTestEnabled_ != appliedState.scissorTestEnabled_)
+        delta |= DeltaScissorTest;
+    if (depthClampEnabled_ != appliedState.depthClampEnabled_)
+        delta |= DeltaDepthClamp;
+    if (multiSampleEnabled_ != appliedState.multiSampleEnabled_)
+        delta |= DeltaMultiSample;
+    if (lineSmoothEnabled_ != appliedState.lineSmoothEnabled_)
+        delta |= DeltaLineSmooth;
+    if (lineWidth_ != appliedState.lineWidth_)
+        delta |= DeltaLineWidth;
+
+    #ifdef LLGL_GL_ENABLE_VENDOR_EXT
+    if (conservativeRaster_ != appliedState.conservativeRaster_)
+        delta |= DeltaConservativeRaster;
+    #endif
+
+    return delta;
+}
+
+// Must only include the fields that are compared in CompareSWO
+std::size_t GLRasterizerState::ComputeHash() const
+{
+    std::size_t seed = 0;
+
+    HashCombine(seed, polygonMode_          );
+    HashCombine(seed, cullFace_             );
+    HashCombine(seed, frontFace_            );
+    HashCombine(seed, rasterizerDiscard_    );
+    HashCombine(seed, scissorTestEnabled_   );
+    HashCombine(seed, depthClampEnabled_    );
+    HashCombine(seed, multiSampleEnabled_   );
+    HashCombine(seed, sampleMask_           );
+    HashCombine(seed, lineSmoothEnabled_    );
+    HashCombine(seed, lineWidth_            );
+    HashCombine(seed, polygonOffsetEnabled_ );
+    HashCombine(seed, static_cast<int>(polygonOffsetMode_));
+    HashCombine(seed, polygonOffsetFactor_  );
+    HashCombine(seed, polygonOffsetUnits_   );
+    HashCombine(seed, polygonOffsetClamp_   );
+
+    #ifdef LLGL_GL_ENABLE_VENDOR_EXT
+    HashCombine(seed, conservativeRaster_   );
+    #endif
+
+    return seed;
+}
+
+
 } // /namespace LLGL
 
 
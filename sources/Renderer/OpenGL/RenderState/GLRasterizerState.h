@@ -14,6 +14,7 @@
 #include "../../StaticLimits.h"
 #include "GLState.h"
 #include <memory>
+#include <cstdint>
 
 
 namespace LLGL
@@ -36,11 +37,43 @@ class GLRasterizerState
 
         GLRasterizerState(const RasterizerDescriptor& desc);
 
-        void Bind(GLStateManager& stateMngr);
+        // Binds this rasterizer state. If 'appliedState' is non-null, only the fields that differ from this previously applied state are bound.
+        void Bind(GLStateManager& stateMngr, const GLRasterizerState* appliedState = nullptr);
 
         // Returns a signed integer of the strict-weak-order (SWO) comparison, and 0 on equality.
         int CompareSWO(const GLRasterizerState& rhs) const;
 
+        // Returns the hash of this state, which is computed on construction. States for which CompareSWO returns 0 have the same hash.
+        inline std::size_t GetHash() const
+        {
+            return hash_;
+        }
+
+    private:
+
+        // Bitmask of the field groups that differ between two rasterizer states.
+        enum DeltaBits : std::uint32_t
+        {
+            DeltaPolygonMode        = (1 << 0),
+            DeltaFrontFace          = (1 << 1),
+            DeltaRasterizerDiscard  = (1 << 2),
+            DeltaCullFace           = (1 << 3),
+            DeltaPolygonOffset      = (1 << 4),
+            DeltaScissorTest        = (1 << 5),
+            DeltaDepthClamp         = (1 << 6),
+            DeltaMultiSample        = (1 << 7),
+            DeltaLineSmooth         = (1 << 8),
+            DeltaLineWidth          = (1 << 9),
+            DeltaConservativeRaster = (1 << 10),
+            DeltaAll                = 0x7FF,
+        };
+
+    private:
+
+        std::uint32_t GetDeltaMask(const GLRasterizerState& appliedState) const;
+
+        std::size_t ComputeHash() const;
+
     private:
 
         GLenum      polygonMode_            = GL_FILL;
@@ -63,6 +96,8 @@ class GLRasterizerState
         bool        conservativeRaster_     = false;    // glEnable(GL_CONSERVATIVE_RASTERIZATION_NV/INTEL)
         #endif
 
+        std::size_t hash_                   = 0;
+
 };
 
 
@@ -147,6 +147,9 @@ void GLResourceHeap::Bind(GLStateManager& stateMngr)
     for (std::uint8_t i = 0; i < segmentationHeader_.numStorageBufferSegments; ++i)
         BindBuffersBaseSegment(stateMngr, byteAlignedBuffer, GLBufferTarget::SHADER_STORAGE_BUFFER);
 
+    if (storageSlotMask_ != 0)
+        stateMngr.SetStorageBufferWriteMask(storageSlotMask_, storageWriteMask_);
+
     /* Bind all textures */
     for (std::uint8_t i = 0; i < segmentationHeader_.numTextureSegments; ++i)
         BindTexturesSegment(stateMngr, byteAlignedBuffer);
@@ -229,6 +232,21 @@ void GLResourceHeap::BuildStorageBufferSegments(ResourceBindingIterator& resourc
         (BindFlags::SampleBuffer | BindFlags::RWStorageBuffer),
         segmentationHeader_.numStorageBufferSegments
     );
+
+    /* Store which storage buffer slots are bound with write access */
+    BindingDescriptor bindingDesc;
+    resourceIterator.Reset(ResourceType::Buffer, (BindFlags::SampleBuffer | BindFlags::RWStorageBuffer));
+
+    while (resourceIterator.Next(bindingDesc) != nullptr)
+    {
+        if (bindingDesc.slot < GLStateManager::g_maxNumResourceSlots)
+        {
+            const auto slotMask = (std::uint64_t(1) << bindingDesc.slot);
+            storageSlotMask_ |= slotMask;
+            if ((bindingDesc.bindFlags & BindFlags::RWStorageBuffer) != 0)
+                storageWriteMask_ |= slotMask;
+        }
+    }
 }
 
 void GLResourceHeap::BuildTextureSegments(ResourceBindingIterator& resourceIterator)
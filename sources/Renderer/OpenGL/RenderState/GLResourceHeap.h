@@ -70,6 +70,10 @@ class GLResourceHeap final : public ResourceHeap
         SegmentationHeader          segmentationHeader_;
         std::vector<std::int8_t>    buffer_;
 
+        // Shader storage buffer slots of this heap, and the subset of them that is bound with write access (see GLStateManager::SetStorageBufferWriteMask).
+        std::uint64_t               storageSlotMask_    = 0;
+        std::uint64_t               storageWriteMask_   = 0;
+
 };
 
 
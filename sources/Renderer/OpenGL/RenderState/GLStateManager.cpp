@@ -7,9 +7,6 @@
 
 #include "GLStateManager.h"
 #include "GLRenderPass.h"
-#include "GLDepthStencilState.h"
-#include "GLRasterizerState.h"
-#include "GLBlendState.h"
 #include "../GLRenderContext.h"
 #include "../Buffer/GLBuffer.h"
 #include "../Texture/GLTexture.h"
@@ -19,7 +16,9 @@
 #include "../../GLCommon/GLTypes.h"
 #include "../../../Core/Helper.h"
 #include "../../../Core/Assertion.h"
+#include <LLGL/Log.h>
 #include <functional>
+#include <algorithm>
 
 
 namespace LLGL
@@ -134,14 +133,78 @@ static void InvalidateBoundGLObject(GLuint& boundId, const GLuint releasedObject
         boundId = g_GLInvalidId;
 }
 
+// Returns the index of the specified buffer target for indexed buffer bindings, or -1 if the target is not tracked per index.
+static int GetIndexedBufferTargetIndex(GLBufferTarget target)
+{
+    switch (target)
+    {
+        case GLBufferTarget::UNIFORM_BUFFER:        return 0;
+        case GLBufferTarget::SHADER_STORAGE_BUFFER: return 1;
+        default:                                    return -1;
+    }
+}
+
+// Returns a bit mask for the slot range [first, first + count).
+template <typename TMask>
+static TMask GetSlotRangeMask(GLuint first, GLsizei count)
+{
+    const auto numBits = static_cast<GLuint>(sizeof(TMask) * 8);
+    const auto all = static_cast<TMask>(~TMask(0));
+    const auto mask = (static_cast<GLuint>(count) >= numBits ? all : static_cast<TMask>((TMask(1) << count) - 1u));
+    return (first >= numBits ? TMask(0) : static_cast<TMask>(mask << first));
+}
+
+// Calls the specified function for each contiguous range of set bits in the specified mask.
+template <typename TMask, typename TFunc>
+static void ForEachSlotRange(TMask mask, TFunc func)
+{
+    GLuint first = 0;
+    while (mask != 0)
+    {
+        /* Skip unset bits */
+        while ((mask & 1u) == 0)
+        {
+            mask >>= 1;
+            ++first;
+        }
+
+        /* Count set bits */
+        GLsizei count = 0;
+        while ((mask & 1u) != 0)
+        {
+            mask >>= 1;
+            ++count;
+        }
+
+        func(first, count);
+        first += static_cast<GLuint>(count);
+    }
+}
+
+// Removes the specified GL object from all pending slots in the specified dirty mask, since a deleted object must not be bound anymore.
+template <typename TMask, typename TSlots>
+static void PurgePendingSlots(TMask& dirtyMask, TSlots& slots, GLuint object)
+{
+    for (std::size_t slot = 0; slot < slots.size(); ++slot)
+    {
+        const auto bit = (TMask(1) << slot);
+        if ((dirtyMask & bit) != 0 && slots[slot] == object)
+        {
+            slots[slot] = 0;
+            dirtyMask &= ~bit;
+        }
+    }
+}
+
 
 /*
  * GLStateManager class
  */
 
 static std::vector<GLStateManager*> g_GLStateManagerList;
+static std::mutex                   g_GLStateManagerListMutex;
 
-GLStateManager* GLStateManager::active = nullptr;
+thread_local GLStateManager* GLStateManager::active = nullptr;
 
 GLStateManager::GLStateManager()
 {
@@ -151,6 +214,9 @@ GLStateManager::GLStateManager()
     Fill(framebufferState_.boundFramebuffers, 0);
     Fill(samplerState_.boundSamplers, 0);
 
+    for (auto& boundIndexedBuffers : bufferState_.boundIndexedBuffers)
+        Fill(boundIndexedBuffers, 0);
+
     for (auto& layer : textureState_.layers)
         Fill(layer.boundTextures, 0);
 
@@ -160,11 +226,14 @@ GLStateManager::GLStateManager()
     GLStateManager::active = this;
 
     /* Store state manager in global list */
+    std::lock_guard<std::mutex> guard { g_GLStateManagerListMutex };
     g_GLStateManagerList.push_back(this);
 }
 
 GLStateManager::~GLStateManager()
 {
+    /* Don't delete GL objects here, since the GL context might already be gone (see ReleaseTransientResources) */
+    std::lock_guard<std::mutex> guard { g_GLStateManagerListMutex };
     RemoveFromList(g_GLStateManagerList, this);
 }
 
@@ -190,6 +259,10 @@ void GLStateManager::SetGraphicsAPIDependentState(const OpenGLDependentStateDesc
     /* Check for necessary updates */
     bool updateFrontFace = (apiDependentState_.invertFrontFace != stateDesc.invertFrontFace);
 
+    /* Apply deferred bindings before they would be overwritten by immediate bindings */
+    if (!stateDesc.lazyResourceBindings)
+        FlushResourceBindings();
+
     /* Store new graphics state */
     apiDependentState_ = stateDesc;
 
@@ -198,6 +271,7 @@ void GLStateManager::SetGraphicsAPIDependentState(const OpenGLDependentStateDesc
         /* Update front face and reset bound rasterizer state */
         SetFrontFace(commonState_.frontFaceAct);
         boundRasterizerState_ = nullptr;
+        appliedPipelineStates_.rasterizerValid = false;
     }
 }
 
@@ -208,6 +282,14 @@ void GLStateManager::Reset()
     /* Query all states from OpenGL */
     for (std::size_t i = 0; i < numStates; ++i)
         renderState_.values[i] = (glIsEnabled(g_stateCapsEnum[i]) != GL_FALSE);
+
+    /* Pipeline states must be applied entirely the next time they are bound */
+    boundDepthStencilState_                     = nullptr;
+    boundRasterizerState_                       = nullptr;
+    boundBlendState_                            = nullptr;
+    appliedPipelineStates_.depthStencilValid    = false;
+    appliedPipelineStates_.rasterizerValid      = false;
+    appliedPipelineStates_.blendValid           = false;
 }
 
 void GLStateManager::Set(GLState state, bool value)
@@ -531,16 +613,20 @@ void GLStateManager::SetLineWidth(GLfloat width)
 
 void GLStateManager::NotifyDepthStencilStateRelease(GLDepthStencilState* depthStencilState)
 {
-    if (boundDepthStencilState_ == depthStencilState)
-        boundDepthStencilState_ = nullptr;
+    NotifyPipelineStateRelease(depthStencilState);
 }
 
 void GLStateManager::SetDepthStencilState(GLDepthStencilState* depthStencilState)
 {
+    FlushReleasedPipelineStates();
     if (depthStencilState != nullptr && depthStencilState != boundDepthStencilState_)
     {
-        depthStencilState->Bind(*this);
-        boundDepthStencilState_ = depthStencilState;
+        /* Apply only the fields that differ from the previously applied depth-stencil state */
+        auto& applied = appliedPipelineStates_;
+        depthStencilState->Bind(*this, (applied.depthStencilValid ? &applied.depthStencil : nullptr));
+        applied.depthStencil        = *depthStencilState;
+        applied.depthStencilValid   = true;
+        boundDepthStencilState_     = depthStencilState;
     }
 }
 
@@ -566,16 +652,20 @@ void GLStateManager::SetDepthMask(GLboolean flag)
 
 void GLStateManager::NotifyRasterizerStateRelease(GLRasterizerState* rasterizerState)
 {
-    if (boundRasterizerState_ == rasterizerState)
-        boundRasterizerState_ = nullptr;
+    NotifyPipelineStateRelease(rasterizerState);
 }
 
 void GLStateManager::SetRasterizerState(GLRasterizerState* rasterizerState)
 {
+    FlushReleasedPipelineStates();
     if (rasterizerState != nullptr && rasterizerState != boundRasterizerState_)
     {
-        rasterizerState->Bind(*this);
-        boundRasterizerState_ = rasterizerState;
+        /* Apply only the fields that differ from the previously applied rasterizer state */
+        auto& applied = appliedPipelineStates_;
+        rasterizerState->Bind(*this, (applied.rasterizerValid ? &applied.rasterizer : nullptr));
+        applied.rasterizer          = *rasterizerState;
+        applied.rasterizerValid     = true;
+        boundRasterizerState_       = rasterizerState;
     }
 }
 
@@ -583,19 +673,56 @@ void GLStateManager::SetRasterizerState(GLRasterizerState* rasterizerState)
 
 void GLStateManager::NotifyBlendStateRelease(GLBlendState* blendState)
 {
-    if (boundBlendState_ == blendState)
-        boundBlendState_ = nullptr;
+    NotifyPipelineStateRelease(blendState);
 }
 
 void GLStateManager::BindBlendState(GLBlendState* blendState)
 {
+    FlushReleasedPipelineStates();
     if (blendState != nullptr && blendState != boundBlendState_)
     {
-        blendState->Bind(*this);
-        boundBlendState_ = blendState;
+        /* Apply only the fields that differ from the previously applied blend state */
+        auto& applied = appliedPipelineStates_;
+        blendState->Bind(*this, (applied.blendValid ? &applied.blend : nullptr));
+        applied.blend               = *blendState;
+        applied.blendValid          = true;
+        boundBlendState_            = blendState;
+    }
+}
+
+void GLStateManager::NotifyPipelineStateRelease(const void* state)
+{
+    /*
+    Only queue the state here, since the state managers might be in use by other threads.
+    The state pool calls this before the state is destroyed, so a new state at the same address
+    is always created after it has been queued, and the bound state is reset before it is compared again.
+    */
+    std::lock_guard<std::mutex> guard { g_GLStateManagerListMutex };
+    for (auto stateMngr : g_GLStateManagerList)
+    {
+        auto& released = stateMngr->releasedStates_;
+        std::lock_guard<std::mutex> releasedGuard { released.mutex };
+        released.states.push_back(state);
+        released.pending.store(true, std::memory_order_release);
     }
 }
 
+void GLStateManager::InvalidateReleasedPipelineStates()
+{
+    std::lock_guard<std::mutex> guard { releasedStates_.mutex };
+    for (auto state : releasedStates_.states)
+    {
+        if (boundDepthStencilState_ == state)
+            boundDepthStencilState_ = nullptr;
+        if (boundRasterizerState_ == state)
+            boundRasterizerState_ = nullptr;
+        if (boundBlendState_ == state)
+            boundBlendState_ = nullptr;
+    }
+    releasedStates_.states.clear();
+    releasedStates_.pending.store(false, std::memory_order_relaxed);
+}
+
 void GLStateManager::SetBlendColor(const GLfloat (&color)[4])
 {
     if ( color[0] != commonState_.blendColor[0] ||
@@ -641,14 +768,33 @@ void GLStateManager::BindBuffer(GLBufferTarget target, GLuint buffer)
 
 void GLStateManager::BindBufferBase(GLBufferTarget target, GLuint index, GLuint buffer)
 {
+    if (apiDependentState_.lazyResourceBindings && DeferBuffersBase(target, index, 1, &buffer))
+        return;
+
     /* Always bind buffer with a base index */
     auto targetIdx = static_cast<std::size_t>(target);
     glBindBufferBase(g_bufferTargetsEnum[targetIdx], index, buffer);
     bufferState_.boundBuffers[targetIdx] = buffer;
+
+    /* Store indexed binding */
+    auto indexedTargetIdx = GetIndexedBufferTargetIndex(target);
+    if (indexedTargetIdx >= 0 && index < g_maxNumResourceSlots)
+        bufferState_.boundIndexedBuffers[indexedTargetIdx][index] = buffer;
 }
 
 void GLStateManager::BindBuffersBase(GLBufferTarget target, GLuint first, GLsizei count, const GLuint* buffers)
 {
+    if (apiDependentState_.lazyResourceBindings && DeferBuffersBase(target, first, count, buffers))
+        return;
+
+    /* Store indexed bindings */
+    auto indexedTargetIdx = GetIndexedBufferTargetIndex(target);
+    if (indexedTargetIdx >= 0)
+    {
+        for (GLsizei i = 0; i < count && first + i < g_maxNumResourceSlots; ++i)
+            bufferState_.boundIndexedBuffers[indexedTargetIdx][first + i] = buffers[i];
+    }
+
     /* Always bind buffers with a base index */
     auto targetIdx = static_cast<std::size_t>(target);
     auto targetGL = g_bufferTargetsEnum[targetIdx];
@@ -680,7 +826,7 @@ void GLStateManager::BindBuffersBase(GLBufferTarget target, GLuint first, GLsize
 
 void GLStateManager::UnbindBuffersBase(GLBufferTarget target, GLuint first, GLsizei count)
 {
-    BindBuffersBase(GLBufferTarget::UNIFORM_BUFFER, first, count, g_nullResources);
+    BindBuffersBase(target, first, count, g_nullResources);
 }
 
 void GLStateManager::BindVertexArray(GLuint vertexArray)
@@ -717,6 +863,47 @@ void GLStateManager::BindGLBuffer(const GLBuffer& buffer)
 void GLStateManager::NotifyVertexArrayRelease(GLuint vertexArray)
 {
     InvalidateBoundGLObject(vertexArrayState_.boundVertexArray, vertexArray);
+    InvalidateBoundGLObject(vertexArrayState_.vertexFormatArray, vertexArray);
+    InvalidateBoundGLObject(vertexArrayState_.vertexBufferArray, vertexArray);
+}
+
+void GLStateManager::BindVertexFormat(GLuint vertexArray)
+{
+    vertexArrayState_.vertexFormatArray = vertexArray;
+    ResolveVertexArray();
+}
+
+void GLStateManager::BindVertexBuffers(GLuint vertexArray, GLsizei count, const GLuint* buffers, const GLintptr* offsets, const GLsizei* strides)
+{
+    auto& state = vertexArrayState_;
+
+    /* Clamp number of buffers to the binding points that are tracked */
+    count = std::min(count, static_cast<GLsizei>(LLGL_MAX_NUM_VERTEX_BUFFER_BINDINGS));
+
+    /* Store vertex buffer bindings, which are only applied to the vertex format VAO if they have changed */
+    for (GLsizei i = 0; i < count; ++i)
+    {
+        if ( i >= state.numVertexBuffers                    ||
+             state.vertexBuffers[i]       != buffers[i]     ||
+             state.vertexBufferOffsets[i] != offsets[i]     ||
+             state.vertexBufferStrides[i] != strides[i] )
+        {
+            state.vertexBuffers[i]          = buffers[i];
+            state.vertexBufferOffsets[i]    = offsets[i];
+            state.vertexBufferStrides[i]    = strides[i];
+            state.vertexBuffersDirty        = true;
+        }
+    }
+
+    if (state.numVertexBuffers != count)
+    {
+        state.numVertexBuffers      = count;
+        state.vertexBuffersDirty    = true;
+    }
+
+    state.vertexBufferArray = vertexArray;
+
+    ResolveVertexArray();
 }
 
 void GLStateManager::BindElementArrayBufferToVAO(GLuint buffer)
@@ -752,6 +939,18 @@ void GLStateManager::NotifyBufferRelease(GLuint buffer, GLBufferTarget target)
 {
     auto targetIdx = static_cast<std::size_t>(target);
     InvalidateBoundGLObject(bufferState_.boundBuffers[targetIdx], buffer);
+
+    /* Invalidate indexed bindings as well */
+    auto indexedTargetIdx = GetIndexedBufferTargetIndex(target);
+    if (indexedTargetIdx >= 0)
+    {
+        for (auto& boundBuffer : bufferState_.boundIndexedBuffers[indexedTargetIdx])
+            InvalidateBoundGLObject(boundBuffer, buffer);
+
+        /* Drop deferred bindings as well */
+        auto& lazyState = lazyBindingState_;
+        PurgePendingSlots(lazyState.dirtyBuffers[indexedTargetIdx], lazyState.buffers[indexedTargetIdx], buffer);
+    }
 }
 
 void GLStateManager::NotifyBufferRelease(const GLBuffer& buffer)
@@ -768,6 +967,8 @@ void GLStateManager::NotifyBufferRelease(const GLBuffer& buffer)
         NotifyBufferRelease(id, GLBufferTarget::UNIFORM_BUFFER);
     if ((bindFlags & BindFlags::StreamOutputBuffer) != 0)
         NotifyBufferRelease(id, GLBufferTarget::TRANSFORM_FEEDBACK_BUFFER);
+    if ((bindFlags & BindFlags::RWStorageBuffer) != 0)
+        memoryBarrierTracker_.NotifyBufferRelease(id);
     if ((bindFlags & (BindFlags::SampleBuffer | BindFlags::RWStorageBuffer)) != 0)
         NotifyBufferRelease(id, GLBufferTarget::SHADER_STORAGE_BUFFER);
     if ((bindFlags & BindFlags::IndirectBuffer) != 0)
@@ -780,6 +981,46 @@ void GLStateManager::NotifyBufferRelease(const GLBuffer& buffer)
     NotifyBufferRelease(id, GLBufferTarget::COPY_WRITE_BUFFER);
 }
 
+// Minimal size (in bytes) of the transient indirect argument buffer.
+static const GLsizeiptr g_minTransientIndirectBufferSize = 65536;
+
+GLintptr GLStateManager::StreamDrawIndirectArguments(const void* data, GLsizeiptr size)
+{
+    auto& buffer = transientIndirectBuffer_;
+
+    if (buffer.id == 0)
+        glGenBuffers(1, &(buffer.id));
+
+    BindBuffer(GLBufferTarget::DRAW_INDIRECT_BUFFER, buffer.id);
+
+    if (buffer.offset + size > buffer.size)
+    {
+        /* Orphan current buffer storage (growing it if necessary) and start over at the beginning */
+        buffer.size     = std::max(buffer.size, std::max(size, g_minTransientIndirectBufferSize));
+        buffer.offset   = 0;
+        glBufferData(GL_DRAW_INDIRECT_BUFFER, buffer.size, nullptr, GL_STREAM_DRAW);
+    }
+
+    /* Write arguments into the next free range of the buffer */
+    auto offset = buffer.offset;
+    glBufferSubData(GL_DRAW_INDIRECT_BUFFER, offset, size, data);
+    buffer.offset += size;
+
+    return offset;
+}
+
+void GLStateManager::ReleaseTransientResources()
+{
+    auto& buffer = transientIndirectBuffer_;
+
+    if (buffer.id != 0)
+    {
+        NotifyBufferRelease(buffer.id, GLBufferTarget::DRAW_INDIRECT_BUFFER);
+        glDeleteBuffers(1, &(buffer.id));
+        buffer = GLTransientBufferState{};
+    }
+}
+
 /* ----- Framebuffer ----- */
 
 void GLStateManager::BindGLRenderTarget(GLRenderTarget* renderTarget)
@@ -895,6 +1136,9 @@ void GLStateManager::BindTexture(GLTextureTarget target, GLuint texture)
 
 void GLStateManager::BindTextures(GLuint first, GLsizei count, const GLTextureTarget* targets, const GLuint* textures)
 {
+    if (apiDependentState_.lazyResourceBindings && DeferTextures(first, count, targets, textures))
+        return;
+
     #ifdef GL_ARB_multi_bind
     if (HasExtension(GLExt::ARB_multi_bind))
     {
@@ -902,7 +1146,7 @@ void GLStateManager::BindTextures(GLuint first, GLsizei count, const GLTextureTa
         for (GLsizei i = 0; i < count; ++i)
         {
             auto targetIdx = static_cast<std::size_t>(targets[i]);
-            textureState_.layers[i].boundTextures[targetIdx] = textures[i];
+            textureState_.layers[first + i].boundTextures[targetIdx] = textures[i];
         }
 
         /*
@@ -929,13 +1173,16 @@ void GLStateManager::BindTextures(GLuint first, GLsizei count, const GLTextureTa
 
 void GLStateManager::UnbindTextures(GLuint first, GLsizei count)
 {
+    /* Discard deferred bindings of these slots, since all of their targets are unbound immediately */
+    lazyBindingState_.dirtyTextures &= ~GetSlotRangeMask<std::uint32_t>(first, count);
+
     #ifdef GL_ARB_multi_bind
     if (HasExtension(GLExt::ARB_multi_bind))
     {
         /* Reset bound textures */
         for (GLsizei i = 0; i < count; ++i)
         {
-            auto& boundTextures = textureState_.layers[i].boundTextures;
+            auto& boundTextures = textureState_.layers[first + i].boundTextures;
             std::fill(std::begin(boundTextures), std::end(boundTextures), 0);
         }
 
@@ -995,11 +1242,23 @@ void GLStateManager::BindGLTexture(const GLTexture& texture)
     BindTexture(GLStateManager::GetTextureTarget(texture.GetType()), texture.GetID());
 }
 
+void GLStateManager::BindTextureSlot(GLuint slot, GLTextureTarget target, GLuint texture)
+{
+    if (apiDependentState_.lazyResourceBindings && DeferTextures(slot, 1, &target, &texture))
+        return;
+
+    ActiveTexture(slot);
+    BindTexture(target, texture);
+}
+
 void GLStateManager::NotifyTextureRelease(GLuint texture, GLTextureTarget target)
 {
     auto targetIdx = static_cast<std::size_t>(target);
     for (auto& layer : textureState_.layers)
         InvalidateBoundGLObject(layer.boundTextures[targetIdx], texture);
+
+    /* Drop deferred bindings as well */
+    PurgePendingSlots(lazyBindingState_.dirtyTextures, lazyBindingState_.textures, texture);
 }
 
 /* ----- Sampler ----- */
@@ -1010,6 +1269,9 @@ void GLStateManager::BindSampler(GLuint layer, GLuint sampler)
     LLGL_ASSERT_UPPER_BOUND(layer, numTextureLayers);
     #endif
 
+    if (apiDependentState_.lazyResourceBindings && DeferSamplers(layer, 1, &sampler))
+        return;
+
     if (samplerState_.boundSamplers[layer] != sampler)
     {
         samplerState_.boundSamplers[layer] = sampler;
@@ -1019,6 +1281,9 @@ void GLStateManager::BindSampler(GLuint layer, GLuint sampler)
 
 void GLStateManager::BindSamplers(GLuint first, GLsizei count, const GLuint* samplers)
 {
+    if (apiDependentState_.lazyResourceBindings && DeferSamplers(first, count, samplers))
+        return;
+
     #ifdef GL_ARB_multi_bind
     if (count >= 2 && HasExtension(GLExt::ARB_multi_bind))
     {
@@ -1027,7 +1292,7 @@ void GLStateManager::BindSamplers(GLuint first, GLsizei count, const GLuint* sam
 
         /* Store bound samplers */
         for (GLsizei i = 0; i < count; ++i)
-            samplerState_.boundSamplers[i] = samplers[i];
+            samplerState_.boundSamplers[first + i] = samplers[i];
     }
     else
     #endif
@@ -1047,6 +1312,111 @@ void GLStateManager::NotifySamplerRelease(GLuint sampler)
 {
     for (auto& boundSampler : samplerState_.boundSamplers)
         InvalidateBoundGLObject(boundSampler, sampler);
+
+    /* Drop deferred bindings as well */
+    PurgePendingSlots(lazyBindingState_.dirtySamplers, lazyBindingState_.samplers, sampler);
+}
+
+/* ----- Lazy resource bindings ----- */
+
+void GLStateManager::NextFrame()
+{
+    resourceBindingStats_[1] = resourceBindingStats_[0];
+    resourceBindingStats_[0] = ResourceBindingStatistics{};
+}
+
+/* ----- Memory barriers ----- */
+
+void GLStateManager::ApplyMemoryBarriers(bool drawCommand, GLuint indirectBuffer)
+{
+    auto& tracker = memoryBarrierTracker_;
+
+    const auto& uniformBuffers = bufferState_.boundIndexedBuffers[GetIndexedBufferTargetIndex(GLBufferTarget::UNIFORM_BUFFER)];
+    const auto& storageBuffers = bufferState_.boundIndexedBuffers[GetIndexedBufferTargetIndex(GLBufferTarget::SHADER_STORAGE_BUFFER)];
+
+    if (tracker.HasPendingWrites())
+    {
+        /* Gather all accesses of this command that depend on pending shader writes */
+        long    access          = 0;
+        GLuint  dependentBuffer = 0;
+
+        auto GatherAccess = [&](GLuint buffer, long bufferAccess)
+        {
+            if (buffer != 0)
+            {
+                if (auto pendingAccess = tracker.GetPendingAccess(buffer, bufferAccess))
+                {
+                    access          |= pendingAccess;
+                    dependentBuffer = buffer;
+                }
+            }
+        };
+
+        for (auto buffer : uniformBuffers)
+            GatherAccess(buffer, GLBarrierAccess::Uniform);
+        for (auto buffer : storageBuffers)
+            GatherAccess(buffer, GLBarrierAccess::ShaderStorage);
+
+        if (drawCommand)
+        {
+            for (GLsizei i = 0; i < vertexArrayState_.numVertexBuffers; ++i)
+                GatherAccess(vertexArrayState_.vertexBuffers[i], GLBarrierAccess::VertexAttribArray);
+            GatherAccess(vertexArrayState_.boundElementArrayBuffer, GLBarrierAccess::ElementArray);
+        }
+
+        GatherAccess(indirectBuffer, GLBarrierAccess::Command);
+
+        if (access != 0)
+            InsertMemoryBarrier(access, dependentBuffer);
+    }
+
+    /* Record the shader storage buffers that may be written by this command */
+    ForEachSlotRange(
+        tracker.GetStorageWriteMask(),
+        [&](GLuint first, GLsizei count)
+        {
+            for (auto slot = first; slot < first + static_cast<GLuint>(count); ++slot)
+            {
+                if (storageBuffers[slot] != 0 && storageBuffers[slot] != g_GLInvalidId)
+                    tracker.RecordShaderWrite(storageBuffers[slot]);
+            }
+        }
+    );
+}
+
+void GLStateManager::ApplyBufferMemoryBarrier(GLuint buffer, long access)
+{
+    if (auto pendingAccess = memoryBarrierTracker_.GetPendingAccess(buffer, access))
+        InsertMemoryBarrier(pendingAccess, buffer);
+}
+
+void GLStateManager::InsertMemoryBarrier(long access, GLuint buffer)
+{
+    if (apiDependentState_.automaticMemoryBarriers)
+    {
+        #ifdef GL_ARB_shader_image_load_store
+        if (HasExtension(GLExt::ARB_shader_image_load_store))
+            glMemoryBarrier(GLMemoryBarrierTracker::ToGLBarrierBits(access));
+        #endif // /GL_ARB_shader_image_load_store
+
+        if (apiDependentState_.reportMemoryBarriers)
+        {
+            Log::PostReport(
+                Log::ReportType::Performance,
+                "inserted glMemoryBarrier(" + GLMemoryBarrierTracker::ToString(access) + ") for shader writes to buffer " + std::to_string(buffer)
+            );
+        }
+    }
+    else if (apiDependentState_.reportMemoryBarriers)
+    {
+        Log::PostReport(
+            Log::ReportType::Warning,
+            "missing glMemoryBarrier(" + GLMemoryBarrierTracker::ToString(access) + ") for shader writes to buffer " + std::to_string(buffer)
+        );
+    }
+
+    /* A memory barrier makes the shader writes to all buffers visible, so the accesses are resolved for all pending writes */
+    memoryBarrierTracker_.Resolve(access);
 }
 
 /* ----- Shader binding ----- */
@@ -1076,6 +1446,27 @@ void GLStateManager::NotifyShaderProgramRelease(GLuint program)
     InvalidateBoundGLObject(shaderState_.boundProgram, program);
 }
 
+#ifdef GL_ARB_separate_shader_objects
+
+void GLStateManager::BindProgramPipeline(GLuint pipeline)
+{
+    /* A program pipeline is only used if no program is bound with glUseProgram */
+    BindShaderProgram(0);
+
+    if (shaderState_.boundProgramPipeline != pipeline)
+    {
+        shaderState_.boundProgramPipeline = pipeline;
+        glBindProgramPipeline(pipeline);
+    }
+}
+
+void GLStateManager::NotifyProgramPipelineRelease(GLuint pipeline)
+{
+    InvalidateBoundGLObject(shaderState_.boundProgramPipeline, pipeline);
+}
+
+#endif // /GL_ARB_separate_shader_objects
+
 /* ----- Render pass ----- */
 
 void GLStateManager::BindRenderPass(
@@ -1215,6 +1606,278 @@ void GLStateManager::SetActiveTextureLayer(std::uint32_t layer)
     activeTextureLayer_ = &(textureState_.layers[textureState_.activeTexture]);
 }
 
+void GLStateManager::ResolveVertexArray()
+{
+    auto& state = vertexArrayState_;
+
+    if (state.vertexFormatArray != 0)
+    {
+        /* Vertex buffer bindings are a state of the VAO, so they must be applied again after another VAO has been bound */
+        if (state.boundVertexArray != state.vertexFormatArray)
+        {
+            BindVertexArray(state.vertexFormatArray);
+            state.vertexBuffersDirty = true;
+        }
+
+        if (state.vertexBuffersDirty && state.numVertexBuffers > 0)
+        {
+            #ifdef GL_ARB_vertex_attrib_binding
+            #ifdef GL_ARB_multi_bind
+            if (HasExtension(GLExt::ARB_multi_bind))
+            {
+                glBindVertexBuffers(
+                    0,
+                    state.numVertexBuffers,
+                    state.vertexBuffers.data(),
+                    state.vertexBufferOffsets.data(),
+                    state.vertexBufferStrides.data()
+                );
+            }
+            else
+            #endif // /GL_ARB_multi_bind
+            {
+                for (GLsizei i = 0; i < state.numVertexBuffers; ++i)
+                {
+                    glBindVertexBuffer(
+                        static_cast<GLuint>(i),
+                        state.vertexBuffers[i],
+                        state.vertexBufferOffsets[i],
+                        state.vertexBufferStrides[i]
+                    );
+                }
+            }
+            #endif // /GL_ARB_vertex_attrib_binding
+        }
+
+        state.vertexBuffersDirty = false;
+    }
+    else if (state.vertexBufferArray != 0)
+    {
+        /* Fall back to the VAO of the vertex buffers if the current pipeline has no vertex format */
+        BindVertexArray(state.vertexBufferArray);
+    }
+}
+
+/* ----- Lazy resource bindings ----- */
+
+bool GLStateManager::DeferBuffersBase(GLBufferTarget target, GLuint first, GLsizei count, const GLuint* buffers)
+{
+    /* Only uniform and storage buffers are deferred; other targets such as transform-feedback buffers must be bound immediately */
+    auto indexedTargetIdx = GetIndexedBufferTargetIndex(target);
+    if (indexedTargetIdx < 0 || count < 0 || first + static_cast<GLuint>(count) > g_maxNumResourceSlots)
+        return false;
+
+    auto& state = lazyBindingState_;
+    for (GLsizei i = 0; i < count; ++i)
+        state.buffers[indexedTargetIdx][first + i] = buffers[i];
+
+    state.dirtyBuffers[indexedTargetIdx] |= GetSlotRangeMask<std::uint64_t>(first, count);
+    state.pending = true;
+
+    resourceBindingStats_[0].numBindRequests += static_cast<std::uint32_t>(count);
+
+    return true;
+}
+
+bool GLStateManager::DeferTextures(GLuint first, GLsizei count, const GLTextureTarget* targets, const GLuint* textures)
+{
+    if (count < 0 || first + static_cast<GLuint>(count) > numTextureLayers)
+        return false;
+
+    auto& state = lazyBindingState_;
+    for (GLsizei i = 0; i < count; ++i)
+    {
+        state.textureTargets[first + i] = targets[i];
+        state.textures[first + i]       = textures[i];
+    }
+
+    state.dirtyTextures |= GetSlotRangeMask<std::uint32_t>(first, count);
+    state.pending = true;
+
+    resourceBindingStats_[0].numBindRequests += static_cast<std::uint32_t>(count);
+
+    return true;
+}
+
+bool GLStateManager::DeferSamplers(GLuint first, GLsizei count, const GLuint* samplers)
+{
+    if (count < 0 || first + static_cast<GLuint>(count) > numTextureLayers)
+        return false;
+
+    auto& state = lazyBindingState_;
+    for (GLsizei i = 0; i < count; ++i)
+        state.samplers[first + i] = samplers[i];
+
+    state.dirtySamplers |= GetSlotRangeMask<std::uint32_t>(first, count);
+    state.pending = true;
+
+    resourceBindingStats_[0].numBindRequests += static_cast<std::uint32_t>(count);
+
+    return true;
+}
+
+void GLStateManager::ApplyPendingResourceBindings()
+{
+    for (std::size_t i = 0; i < numIndexedBufferTargets; ++i)
+        ApplyPendingBuffersBase(i);
+
+    ApplyPendingTextures();
+    ApplyPendingSamplers();
+
+    lazyBindingState_.pending = false;
+}
+
+void GLStateManager::ApplyPendingBuffersBase(std::size_t indexedTargetIdx)
+{
+    auto& state = lazyBindingState_;
+    const auto& pendingBuffers = state.buffers[indexedTargetIdx];
+    auto& boundBuffers = bufferState_.boundIndexedBuffers[indexedTargetIdx];
+
+    /* Filter slots whose binding has actually changed */
+    std::uint64_t changed = 0;
+    ForEachSlotRange(
+        state.dirtyBuffers[indexedTargetIdx],
+        [&](GLuint first, GLsizei count)
+        {
+            for (auto slot = first; slot < first + static_cast<GLuint>(count); ++slot)
+            {
+                if (boundBuffers[slot] != pendingBuffers[slot])
+                {
+                    boundBuffers[slot] = pendingBuffers[slot];
+                    changed |= (std::uint64_t(1) << slot);
+                }
+            }
+        }
+    );
+    state.dirtyBuffers[indexedTargetIdx] = 0;
+
+    /* Bind each contiguous range of changed slots */
+    const auto target   = (indexedTargetIdx == 0 ? GLBufferTarget::UNIFORM_BUFFER : GLBufferTarget::SHADER_STORAGE_BUFFER);
+    const auto targetGL = ToGLBufferTarget(target);
+
+    ForEachSlotRange(
+        changed,
+        [&](GLuint first, GLsizei count)
+        {
+            #ifdef GL_ARB_multi_bind
+            if (HasExtension(GLExt::ARB_multi_bind))
+            {
+                /* Generic binding point is not modified by glBindBuffersBase */
+                glBindBuffersBase(targetGL, first, count, &pendingBuffers[first]);
+                resourceBindingStats_[0].numBindCalls++;
+            }
+            else
+            #endif
+            {
+                for (auto slot = first; slot < first + static_cast<GLuint>(count); ++slot)
+                    glBindBufferBase(targetGL, slot, pendingBuffers[slot]);
+                bufferState_.boundBuffers[static_cast<std::size_t>(target)] = pendingBuffers[first + count - 1];
+                resourceBindingStats_[0].numBindCalls += static_cast<std::uint32_t>(count);
+            }
+        }
+    );
+}
+
+void GLStateManager::ApplyPendingTextures()
+{
+    auto& state = lazyBindingState_;
+
+    /* Filter slots whose binding has actually changed */
+    std::uint32_t changed = 0;
+    ForEachSlotRange(
+        state.dirtyTextures,
+        [&](GLuint first, GLsizei count)
+        {
+            for (auto slot = first; slot < first + static_cast<GLuint>(count); ++slot)
+            {
+                auto targetIdx = static_cast<std::size_t>(state.textureTargets[slot]);
+                if (textureState_.layers[slot].boundTextures[targetIdx] != state.textures[slot])
+                    changed |= (1u << slot);
+            }
+        }
+    );
+    state.dirtyTextures = 0;
+
+    /* Bind each contiguous range of changed slots */
+    ForEachSlotRange(
+        changed,
+        [&](GLuint first, GLsizei count)
+        {
+            #ifdef GL_ARB_multi_bind
+            if (HasExtension(GLExt::ARB_multi_bind))
+            {
+                for (auto slot = first; slot < first + static_cast<GLuint>(count); ++slot)
+                {
+                    /* Texture name 0 unbinds all targets of a texture slot */
+                    auto& boundTextures = textureState_.layers[slot].boundTextures;
+                    if (state.textures[slot] == 0)
+                        std::fill(std::begin(boundTextures), std::end(boundTextures), 0);
+                    else
+                        boundTextures[static_cast<std::size_t>(state.textureTargets[slot])] = state.textures[slot];
+                }
+
+                /* Active texture slot is not modified by glBindTextures */
+                glBindTextures(first, count, &(state.textures[first]));
+                resourceBindingStats_[0].numBindCalls++;
+            }
+            else
+            #endif
+            {
+                for (auto slot = first; slot < first + static_cast<GLuint>(count); ++slot)
+                {
+                    ActiveTexture(slot);
+                    BindTexture(state.textureTargets[slot], state.textures[slot]);
+                }
+                resourceBindingStats_[0].numBindCalls += static_cast<std::uint32_t>(count);
+            }
+        }
+    );
+}
+
+void GLStateManager::ApplyPendingSamplers()
+{
+    auto& state = lazyBindingState_;
+
+    /* Filter slots whose binding has actually changed */
+    std::uint32_t changed = 0;
+    ForEachSlotRange(
+        state.dirtySamplers,
+        [&](GLuint first, GLsizei count)
+        {
+            for (auto slot = first; slot < first + static_cast<GLuint>(count); ++slot)
+            {
+                if (samplerState_.boundSamplers[slot] != state.samplers[slot])
+                {
+                    samplerState_.boundSamplers[slot] = state.samplers[slot];
+                    changed |= (1u << slot);
+                }
+            }
+        }
+    );
+    state.dirtySamplers = 0;
+
+    /* Bind each contiguous range of changed slots */
+    ForEachSlotRange(
+        changed,
+        [&](GLuint first, GLsizei count)
+        {
+            #ifdef GL_ARB_multi_bind
+            if (HasExtension(GLExt::ARB_multi_bind))
+            {
+                glBindSamplers(first, count, &(state.samplers[first]));
+                resourceBindingStats_[0].numBindCalls++;
+            }
+            else
+            #endif
+            {
+                for (auto slot = first; slot < first + static_cast<GLuint>(count); ++slot)
+                    glBindSampler(slot, state.samplers[slot]);
+                resourceBindingStats_[0].numBindCalls += static_cast<std::uint32_t>(count);
+            }
+        }
+    );
+}
+
 void GLStateManager::DetermineLimits()
 {
     glGetIntegerv(GL_MAX_VIEWPORTS, &limits_.maxViewports);
@@ -1289,8 +1952,8 @@ void GLStateManager::PopColorMask()
 {
     if (colorMaskOnStack_)
     {
-        if (boundBlendState_)
-            boundBlendState_->BindColorMaskOnly(*this);
+        if (appliedPipelineStates_.blendValid)
+            appliedPipelineStates_.blend.BindColorMaskOnly(*this);
         colorMaskOnStack_ = false;
     }
 }
@@ -10,10 +10,19 @@
 
 
 #include "GLState.h"
+#include "GLDepthStencilState.h"
+#include "GLRasterizerState.h"
+#include "GLBlendState.h"
+#include "GLMemoryBarrierTracker.h"
+#include "../../StaticLimits.h"
 #include <LLGL/TextureFlags.h>
 #include <LLGL/CommandBufferFlags.h>
+#include <LLGL/RenderContextFlags.h>
 #include <array>
 #include <stack>
+#include <vector>
+#include <mutex>
+#include <atomic>
 #include <cstdint>
 
 
@@ -26,10 +35,8 @@ class RenderPass;
 class GLRenderTarget;
 class GLRenderContext;
 class GLBuffer;
+class GLUploadRing;
 class GLTexture;
-class GLDepthStencilState;
-class GLRasterizerState;
-class GLBlendState;
 class GLRenderPass;
 
 // OpenGL state machine manager that keeps track of certain GL states.
@@ -48,8 +55,8 @@ class GLStateManager
         GLStateManager();
         ~GLStateManager();
 
-        // Active state manager. Each GL context has its own states, thus its own state manager.
-        static GLStateManager* active;
+        // Active state manager of the calling thread. Each GL context has its own states, thus its own state manager.
+        static thread_local GLStateManager* active;
 
         // Queries all supported and available GL extensions and limitations, then stores it internally (must be called once a GL context has been created).
         void DetermineExtensionsAndLimits();
@@ -110,7 +117,11 @@ class GLStateManager
 
         /* ----- Depth-stencil states ----- */
 
-        void NotifyDepthStencilStateRelease(GLDepthStencilState* depthStencilState);
+        /*
+        Invalidates the specified depth-stencil state in all state managers, since the state pool is shared between GL contexts.
+        The invalidation is deferred to the thread that owns the respective state manager (see FlushReleasedPipelineStates).
+        */
+        static void NotifyDepthStencilStateRelease(GLDepthStencilState* depthStencilState);
 
         void SetDepthStencilState(GLDepthStencilState* depthStencilState);
 
@@ -119,13 +130,15 @@ class GLStateManager
 
         /* ----- Rasterizer states ----- */
 
-        void NotifyRasterizerStateRelease(GLRasterizerState* rasterizerState);
+        // Invalidates the specified rasterizer state in all state managers (see NotifyDepthStencilStateRelease).
+        static void NotifyRasterizerStateRelease(GLRasterizerState* rasterizerState);
 
         void SetRasterizerState(GLRasterizerState* rasterizerState);
 
         /* ----- Blend states ----- */
 
-        void NotifyBlendStateRelease(GLBlendState* blendState);
+        // Invalidates the specified blend state in all state managers (see NotifyDepthStencilStateRelease).
+        static void NotifyBlendStateRelease(GLBlendState* blendState);
 
         void BindBlendState(GLBlendState* blendState);
 
@@ -147,6 +160,18 @@ class GLStateManager
 
         void NotifyVertexArrayRelease(GLuint vertexArray);
 
+        /*
+        Binds the VAO that holds the vertex format of the current graphics pipeline (see GL_ARB_vertex_attrib_binding), or 0 if the pipeline has no vertex format.
+        While a vertex format VAO is bound, the vertex buffers of "BindVertexBuffers" are bound to its binding points instead of binding their own VAO.
+        */
+        void BindVertexFormat(GLuint vertexArray);
+
+        /*
+        Binds the specified vertex buffers to the binding points [0, count) of the current vertex format VAO (see BindVertexFormat).
+        If no vertex format VAO is bound, the specified fallback VAO, which was built for these vertex buffers, is bound instead.
+        */
+        void BindVertexBuffers(GLuint vertexArray, GLsizei count, const GLuint* buffers, const GLintptr* offsets, const GLsizei* strides);
+
         /**
         \brief Binds the specified GL_ELEMENT_ARRAY_BUFFER (i.e. index buffer) to the next VAO (or the current one).
         \see BindVertexArray
@@ -159,6 +184,27 @@ class GLStateManager
         void NotifyBufferRelease(GLuint buffer, GLBufferTarget target);
         void NotifyBufferRelease(const GLBuffer& buffer);
 
+        /*
+        Uploads the specified indirect draw arguments into the transient indirect argument buffer of this state manager,
+        binds that buffer to GL_DRAW_INDIRECT_BUFFER, and returns the byte offset of the uploaded arguments.
+        */
+        GLintptr StreamDrawIndirectArguments(const void* data, GLsizeiptr size);
+
+        // Deletes the transient indirect argument buffer. Must be called while a GL context of the same share group is current.
+        void ReleaseTransientResources();
+
+        // Sets the upload ring that is used for small buffer updates (see GLBuffer::BufferSubData). The state manager does not take ownership.
+        inline void SetUploadRing(GLUploadRing* uploadRing)
+        {
+            uploadRing_ = uploadRing;
+        }
+
+        // Returns the upload ring for small buffer updates, or null if there is none.
+        inline GLUploadRing* GetUploadRing() const
+        {
+            return uploadRing_;
+        }
+
         /* ----- Framebuffer ----- */
 
         void BindGLRenderTarget(GLRenderTarget* renderTarget);
@@ -193,6 +239,9 @@ class GLStateManager
 
         void BindGLTexture(const GLTexture& texture);
 
+        // Binds the specified texture to the specified texture slot. The binding is deferred if lazy resource bindings are enabled.
+        void BindTextureSlot(GLuint slot, GLTextureTarget target, GLuint texture);
+
         void NotifyTextureRelease(GLuint texture, GLTextureTarget target);
 
         /* ----- Sampler ----- */
@@ -203,6 +252,53 @@ class GLStateManager
 
         void NotifySamplerRelease(GLuint sampler);
 
+        /* ----- Lazy resource bindings ----- */
+
+        /*
+        Binds all textures, samplers, and uniform/storage buffers that have been deferred (see OpenGLDependentStateDescriptor::lazyResourceBindings).
+        Only the slots whose binding has changed are bound, with one multi-bind call for each contiguous range of slots. Must be called before each draw and dispatch command.
+        */
+        inline void FlushResourceBindings()
+        {
+            if (lazyBindingState_.pending)
+                ApplyPendingResourceBindings();
+        }
+
+        // Stores the resource binding statistics of the current frame and starts a new frame.
+        void NextFrame();
+
+        // Returns the resource binding statistics of the previous frame.
+        inline const ResourceBindingStatistics& GetResourceBindingStats() const
+        {
+            return resourceBindingStats_[1];
+        }
+
+        /* ----- Memory barriers ----- */
+
+        // Specifies which of the shader storage buffer slots in 'slotMask' are bound with write access (see OpenGLDependentStateDescriptor::automaticMemoryBarriers).
+        inline void SetStorageBufferWriteMask(std::uint64_t slotMask, std::uint64_t writeMask)
+        {
+            memoryBarrierTracker_.SetStorageWriteMask(slotMask, writeMask);
+        }
+
+        /*
+        Inserts a memory barrier for the shader storage writes of previous commands that the next draw or dispatch command depends on,
+        and records the writable shader storage buffers of the next command (see OpenGLDependentStateDescriptor::automaticMemoryBarriers).
+        Must be called after FlushResourceBindings. 'drawCommand' specifies whether the vertex and index buffers are read, and 'indirectBuffer' is the optional indirect argument buffer.
+        */
+        inline void FlushMemoryBarriers(bool drawCommand, GLuint indirectBuffer = 0)
+        {
+            if (apiDependentState_.automaticMemoryBarriers || apiDependentState_.reportMemoryBarriers)
+                ApplyMemoryBarriers(drawCommand, indirectBuffer);
+        }
+
+        // Inserts a memory barrier for the shader storage writes of previous commands that the specified access (bitwise OR of GLBarrierAccess) to a buffer depends on.
+        inline void FlushBufferMemoryBarrier(GLuint buffer, long access)
+        {
+            if (memoryBarrierTracker_.HasPendingWrites())
+                ApplyBufferMemoryBarrier(buffer, access);
+        }
+
         /* ----- Shader Program ----- */
 
         void BindShaderProgram(GLuint program);
@@ -212,6 +308,15 @@ class GLStateManager
 
         void NotifyShaderProgramRelease(GLuint program);
 
+        #ifdef GL_ARB_separate_shader_objects
+
+        // Binds the specified program pipeline object and unbinds the current shader program, which would take precedence over the program pipeline.
+        void BindProgramPipeline(GLuint pipeline);
+
+        void NotifyProgramPipelineRelease(GLuint pipeline);
+
+        #endif // /GL_ARB_separate_shader_objects
+
         /* ----- Render pass ----- */
 
         void BindRenderPass(
@@ -235,12 +340,45 @@ class GLStateManager
 
         void SetActiveTextureLayer(std::uint32_t layer);
 
+        void ResolveVertexArray();
+
+        /* ----- Lazy resource bindings ----- */
+
+        bool DeferBuffersBase(GLBufferTarget target, GLuint first, GLsizei count, const GLuint* buffers);
+        bool DeferTextures(GLuint first, GLsizei count, const GLTextureTarget* targets, const GLuint* textures);
+        bool DeferSamplers(GLuint first, GLsizei count, const GLuint* samplers);
+
+        void ApplyPendingResourceBindings();
+        void ApplyPendingBuffersBase(std::size_t indexedTargetIdx);
+        void ApplyPendingTextures();
+        void ApplyPendingSamplers();
+
+        /* ----- Memory barriers ----- */
+
+        void ApplyMemoryBarriers(bool drawCommand, GLuint indirectBuffer);
+        void ApplyBufferMemoryBarrier(GLuint buffer, long access);
+        void InsertMemoryBarrier(long access, GLuint buffer);
+
         void DetermineLimits();
 
         #ifdef LLGL_GL_ENABLE_VENDOR_EXT
         void DetermineVendorSpecificExtensions();
         #endif
 
+        /* ----- Pipeline states ----- */
+
+        // Queues the specified pipeline state for invalidation in all state managers.
+        static void NotifyPipelineStateRelease(const void* state);
+
+        // Resets the bound pipeline states that have been released by another thread since the last call.
+        inline void FlushReleasedPipelineStates()
+        {
+            if (releasedStates_.pending.load(std::memory_order_acquire))
+                InvalidateReleasedPipelineStates();
+        }
+
+        void InvalidateReleasedPipelineStates();
+
         /* ----- Stacks ----- */
 
         void PushDepthMaskAndEnable();
@@ -279,6 +417,7 @@ class GLStateManager
         static const std::uint32_t numBufferTargets         = (static_cast<std::uint32_t>(GLBufferTarget::UNIFORM_BUFFER) + 1);
         static const std::uint32_t numFramebufferTargets    = (static_cast<std::uint32_t>(GLFramebufferTarget::READ_FRAMEBUFFER) + 1);
         static const std::uint32_t numTextureTargets        = (static_cast<std::uint32_t>(GLTextureTarget::TEXTURE_2D_MULTISAMPLE_ARRAY) + 1);
+        static const std::uint32_t numIndexedBufferTargets  = 2; // GL_UNIFORM_BUFFER and GL_SHADER_STORAGE_BUFFER
 
         #ifdef LLGL_GL_ENABLE_VENDOR_EXT
         static const std::uint32_t numStatesExt             = (static_cast<std::uint32_t>(GLStateExt::CONSERVATIVE_RASTERIZATION) + 1);
@@ -349,8 +488,18 @@ class GLStateManager
                 GLuint          buffer;
             };
 
-            std::array<GLuint, numBufferTargets>    boundBuffers;
-            std::stack<StackEntry>                  boundBufferStack;
+            std::array<GLuint, numBufferTargets>                        boundBuffers;
+            std::stack<StackEntry>                                      boundBufferStack;
+
+            // Bound indexed buffers of GL_UNIFORM_BUFFER and GL_SHADER_STORAGE_BUFFER.
+            std::array<GLuint, g_maxNumResourceSlots>                   boundIndexedBuffers[numIndexedBufferTargets];
+        };
+
+        struct GLTransientBufferState
+        {
+            GLuint      id      = 0;
+            GLsizeiptr  size    = 0;
+            GLintptr    offset  = 0;
         };
 
         struct GLFramebufferState
@@ -392,13 +541,22 @@ class GLStateManager
 
         struct GLVertexArrayState
         {
-            GLuint boundVertexArray         = 0;
-            GLuint boundElementArrayBuffer  = 0;
+            GLuint                                                      boundVertexArray            = 0;
+            GLuint                                                      boundElementArrayBuffer     = 0;
+
+            GLuint                                                      vertexFormatArray           = 0;
+            GLuint                                                      vertexBufferArray           = 0;
+            GLsizei                                                     numVertexBuffers            = 0;
+            bool                                                        vertexBuffersDirty          = false;
+            std::array<GLuint, LLGL_MAX_NUM_VERTEX_BUFFER_BINDINGS>     vertexBuffers;
+            std::array<GLintptr, LLGL_MAX_NUM_VERTEX_BUFFER_BINDINGS>   vertexBufferOffsets;
+            std::array<GLsizei, LLGL_MAX_NUM_VERTEX_BUFFER_BINDINGS>    vertexBufferStrides;
         };
 
         struct GLShaderState
         {
-            GLuint              boundProgram = 0;
+            GLuint              boundProgram            = 0;
+            GLuint              boundProgramPipeline    = 0;
             std::stack<GLuint>  boundProgramStack;
         };
 
@@ -407,6 +565,33 @@ class GLStateManager
             std::array<GLuint, numTextureLayers> boundSamplers;
         };
 
+        // Deferred resource bindings, one bit for each slot that has been bound since the last flush.
+        struct GLLazyBindingState
+        {
+            bool                                            pending                                     = false;
+
+            std::uint64_t                                   dirtyBuffers[numIndexedBufferTargets]       = {};
+            std::array<GLuint, g_maxNumResourceSlots>       buffers[numIndexedBufferTargets];
+
+            std::uint32_t                                   dirtyTextures                               = 0;
+            std::array<GLTextureTarget, numTextureLayers>   textureTargets;
+            std::array<GLuint, numTextureLayers>            textures;
+
+            std::uint32_t                                   dirtySamplers                               = 0;
+            std::array<GLuint, numTextureLayers>            samplers;
+        };
+
+        // Copies of the last applied pipeline states, so only the fields that differ are applied when another pipeline state is bound.
+        struct GLAppliedPipelineStates
+        {
+            GLDepthStencilState depthStencil;
+            GLRasterizerState   rasterizer;
+            GLBlendState        blend;
+            bool                depthStencilValid   = false;
+            bool                rasterizerValid     = false;
+            bool                blendValid          = false;
+        };
+
     private:
 
         GLLimits                        limits_;
@@ -416,12 +601,17 @@ class GLStateManager
         GLCommonState                   commonState_;
         GLRenderState                   renderState_;
         GLBufferState                   bufferState_;
+        GLTransientBufferState          transientIndirectBuffer_;
+        GLUploadRing*                   uploadRing_             = nullptr;
         GLFramebufferState              framebufferState_;
         GLRenderbufferState             renderbufferState_;
         GLTextureState                  textureState_;
         GLVertexArrayState              vertexArrayState_;
         GLShaderState                   shaderState_;
         GLSamplerState                  samplerState_;
+        GLLazyBindingState              lazyBindingState_;
+        ResourceBindingStatistics       resourceBindingStats_[2];   // Statistics of the current and the previous frame
+        GLMemoryBarrierTracker          memoryBarrierTracker_;
 
         #ifdef LLGL_GL_ENABLE_VENDOR_EXT
         GLRenderStateExt                renderStateExt_;
@@ -435,8 +625,19 @@ class GLStateManager
         GLDepthStencilState*            boundDepthStencilState_ = nullptr;
         GLRasterizerState*              boundRasterizerState_   = nullptr;
         GLBlendState*                   boundBlendState_        = nullptr;
+        GLAppliedPipelineStates         appliedPipelineStates_;
         bool                            colorMaskOnStack_       = false;
 
+        // Pipeline states released by any thread, which are invalidated by the thread that owns this state manager
+        struct GLReleasedPipelineStates
+        {
+            std::mutex                  mutex;
+            std::atomic<bool>           pending { false };
+            std::vector<const void*>    states;
+        };
+
+        GLReleasedPipelineStates        releasedStates_;
+
 };
 
 
@@ -7,161 +7,151 @@
 
 #include "GLStatePool.h"
 #include "GLStateManager.h"
-#include <functional>
 
 
 namespace LLGL
 {
 
 
-/*
- * Internal templates
- */
-
-// Searches a compatible state object with complexity O(log n)
-template <typename T>
-std::shared_ptr<T> FindCompatibleStateObject(
-    std::vector<std::shared_ptr<T>>&    container,
-    const T&                            compareObject,
-    std::size_t&                        index)
+GLStatePool& GLStatePool::Instance()
 {
-    std::size_t first = 0, last = container.size();
-    int order = 0;
-
-    while (first < last)
-    {
-        /* Compare centered object in the container with 'compareObject' */
-        index = (first + last)/2;
-
-        /* Check if current state object is compatible */
-        order = compareObject.CompareSWO(*container[index]);
-
-        if (order > 0)
-        {
-            /* Search in upper range */
-            first = index + 1;
-        }
-        else if (order < 0)
-        {
-            /* Search in lower range */
-            last = index;
-        }
-        else
-            return container[index];
-    }
-
-    /* Check if item must be inserted after last index */
-    if (order > 0)
-        ++index;
-
-    return nullptr;
+    static GLStatePool instance;
+    return instance;
 }
 
-template <typename T, typename... Args>
-std::shared_ptr<T> CreateRenderStateObject(std::vector<std::shared_ptr<T>>& container, Args&&... args)
+PipelineStateCacheStatistics GLStatePool::GetStatistics() const
 {
-    /* Try to find blend state with same parameter */
-    T stateToCompare { std::forward<Args>(args)... };
-
-    std::size_t insertionIndex = 0;
-    if (auto sharedState = FindCompatibleStateObject(container, stateToCompare, insertionIndex))
-        return sharedState;
-
-    /* Allocate new blend state with insertion sort */
-    auto newState = std::make_shared<T>(stateToCompare);
-
-    if (insertionIndex < container.size())
-        container.insert(container.begin() + insertionIndex, newState);
-    else
-        container.push_back(newState);
+    std::lock_guard<std::mutex> guard { mutex_ };
 
-    return newState;
-}
-
-template <typename T>
-void ReleaseRenderStateObject(
-    std::vector<std::shared_ptr<T>>&    container,
-    const std::function<void(T*)>&      callback,
-    std::shared_ptr<T>&&                renderState)
-{
-    if (renderState.use_count() == 2)
+    PipelineStateCacheStatistics stats;
     {
-        /* Reset render state */
-        auto objectRef = renderState.get();
-        renderState.reset();
-
-        /* Remove entry from list */
-        std::size_t entryIndex = 0;
-        if (FindCompatibleStateObject(container, *objectRef, entryIndex) != nullptr)
-        {
-            /* Notify via callback and erase from container */
-            callback(objectRef);
-            container.erase(container.begin() + entryIndex);
-        }
+        stats.numDepthStencilStates = depthStencilStates_.size();
+        stats.numRasterizerStates   = rasterizerStates_.size();
+        stats.numBlendStates        = blendStates_.size();
+        stats.numLookups            = numLookups_;
+        stats.numHits               = numHits_;
+        stats.numHashCollisions     = numHashCollisions_;
     }
-}
-
-
-/*
- * GLStatePool class
- */
-
-GLStatePool& GLStatePool::Instance()
-{
-    static GLStatePool instance;
-    return instance;
+    return stats;
 }
 
 void GLStatePool::Clear()
 {
+    std::lock_guard<std::mutex> guard { mutex_ };
+
     depthStencilStates_.clear();
     rasterizerStates_.clear();
     blendStates_.clear();
+
+    numLookups_         = 0;
+    numHits_            = 0;
+    numHashCollisions_  = 0;
 }
 
 GLDepthStencilStateSPtr GLStatePool::CreateDepthStencilState(const DepthDescriptor& depthDesc, const StencilDescriptor& stencilDesc)
 {
-    return CreateRenderStateObject(depthStencilStates_, depthDesc, stencilDesc);
+    return CreateStateObject(depthStencilStates_, depthDesc, stencilDesc);
 }
 
 void GLStatePool::ReleaseDepthStencilState(GLDepthStencilStateSPtr&& depthStencilState)
 {
-    ReleaseRenderStateObject<GLDepthStencilState>(
+    ReleaseStateObject(
         depthStencilStates_,
-        std::bind(&GLStateManager::NotifyDepthStencilStateRelease, GLStateManager::active, std::placeholders::_1),
+        &GLStateManager::NotifyDepthStencilStateRelease,
         std::forward<GLDepthStencilStateSPtr>(depthStencilState)
     );
 }
 
 GLRasterizerStateSPtr GLStatePool::CreateRasterizerState(const RasterizerDescriptor& rasterizerDesc)
 {
-    return CreateRenderStateObject(rasterizerStates_, rasterizerDesc);
+    return CreateStateObject(rasterizerStates_, rasterizerDesc);
 }
 
 void GLStatePool::ReleaseRasterizerState(GLRasterizerStateSPtr&& rasterizerState)
 {
-    ReleaseRenderStateObject<GLRasterizerState>(
+    ReleaseStateObject(
         rasterizerStates_,
-        std::bind(&GLStateManager::NotifyRasterizerStateRelease, GLStateManager::active, std::placeholders::_1),
+        &GLStateManager::NotifyRasterizerStateRelease,
         std::forward<GLRasterizerStateSPtr>(rasterizerState)
     );
 }
 
 GLBlendStateSPtr GLStatePool::CreateBlendState(const BlendDescriptor& blendDesc, std::uint32_t numColorAttachments)
 {
-    return CreateRenderStateObject(blendStates_, blendDesc, numColorAttachments);
+    return CreateStateObject(blendStates_, blendDesc, numColorAttachments);
 }
 
 void GLStatePool::ReleaseBlendState(GLBlendStateSPtr&& blendState)
 {
-    ReleaseRenderStateObject<GLBlendState>(
+    ReleaseStateObject(
         blendStates_,
-        std::bind(&GLStateManager::NotifyBlendStateRelease, GLStateManager::active, std::placeholders::_1),
+        &GLStateManager::NotifyBlendStateRelease,
         std::forward<GLBlendStateSPtr>(blendState)
     );
 }
 
 
+/*
+ * ======= Private: =======
+ */
+
+template <typename T, typename... Args>
+std::shared_ptr<T> GLStatePool::CreateStateObject(StateHashMap<T>& container, Args&&... args)
+{
+    /* Convert state outside of the lock; its hash is computed on construction */
+    T stateToCompare { std::forward<Args>(args)... };
+    const auto hash = stateToCompare.GetHash();
+
+    std::lock_guard<std::mutex> guard { mutex_ };
+
+    /* Try to find state object with same parameters among the states with equal hash */
+    ++numLookups_;
+    auto range = container.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (stateToCompare.CompareSWO(*(it->second)) == 0)
+        {
+            ++numHits_;
+            return it->second;
+        }
+        ++numHashCollisions_;
+    }
+
+    /* Allocate new state object */
+    auto newState = std::make_shared<T>(stateToCompare);
+    container.emplace(hash, newState);
+
+    return newState;
+}
+
+template <typename T>
+void GLStatePool::ReleaseStateObject(StateHashMap<T>& container, void (*releaseCallback)(T*), std::shared_ptr<T>&& state)
+{
+    std::lock_guard<std::mutex> guard { mutex_ };
+
+    /* Check if this is the last reference besides the pool; the reference is dropped within the lock, so concurrent releases see the final count */
+    const bool isLastRef = (state.use_count() == 2);
+    auto objectRef = state.get();
+    state.reset();
+
+    if (isLastRef && objectRef != nullptr)
+    {
+        /* Remove entry from pool */
+        auto range = container.equal_range(objectRef->GetHash());
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if (it->second.get() == objectRef)
+            {
+                /* Notify via callback and erase from container */
+                releaseCallback(objectRef);
+                container.erase(it);
+                break;
+            }
+        }
+    }
+}
+
+
 } // /namespace LLGL
 
 
@@ -13,7 +13,10 @@
 #include "GLDepthStencilState.h"
 #include "GLRasterizerState.h"
 #include "GLBlendState.h"
-#include <vector>
+#include <LLGL/RenderSystemFlags.h>
+#include <unordered_map>
+#include <mutex>
+#include <cstddef>
 
 
 namespace LLGL
@@ -23,6 +26,7 @@ namespace LLGL
 /*
 Singleton pool for OpenGL depth-stencil-, rasterizer-, and blend states.
 These states are separated from the GLStateManager, because they don't need to exist for every GL context.
+The states are interned by their precomputed hash, and all functions are thread-safe, so pipelines can be created from multiple threads.
 */
 class GLStatePool
 {
@@ -35,6 +39,9 @@ class GLStatePool
         // Returns the instance of this pool.
         static GLStatePool& Instance();
 
+        // Returns the current statistics of this pool (see RenderSystem::QueryPipelineStateCacheStatistics).
+        PipelineStateCacheStatistics GetStatistics() const;
+
         // Clear all resource containers of this pool (used by GLRenderSystem).
         void Clear();
 
@@ -57,12 +64,29 @@ class GLStatePool
     private:
 
         GLStatePool() = default;
-    
+
     private:
 
-        std::vector<GLDepthStencilStateSPtr>    depthStencilStates_;
-        std::vector<GLRasterizerStateSPtr>      rasterizerStates_;
-        std::vector<GLBlendStateSPtr>           blendStates_;
+        template <typename T>
+        using StateHashMap = std::unordered_multimap<std::size_t, std::shared_ptr<T>>;
+
+        template <typename T, typename... Args>
+        std::shared_ptr<T> CreateStateObject(StateHashMap<T>& container, Args&&... args);
+
+        template <typename T>
+        void ReleaseStateObject(StateHashMap<T>& container, void (*releaseCallback)(T*), std::shared_ptr<T>&& state);
+
+    private:
+
+        mutable std::mutex                      mutex_;
+
+        StateHashMap<GLDepthStencilState>       depthStencilStates_;
+        StateHashMap<GLRasterizerState>         rasterizerStates_;
+        StateHashMap<GLBlendState>              blendStates_;
+
+        std::size_t                             numLookups_         = 0;
+        std::size_t                             numHits_            = 0;
+        std::size_t                             numHashCollisions_  = 0;
 
 };
 
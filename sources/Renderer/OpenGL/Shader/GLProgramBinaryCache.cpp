@@ -0,0 +1,264 @@
+/*
+ * GLProgramBinaryCache.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLProgramBinaryCache.h"
+#include "GLShaderProgram.h"
+#include "../Ext/GLExtensions.h"
+#include "../../GLCommon/GLExtensionRegistry.h"
+#include <LLGL/Log.h>
+#include <fstream>
+#include <vector>
+#include <cstdio>
+
+
+namespace LLGL
+{
+
+
+// Header of each program binary file.
+struct GLProgramBinaryHeader
+{
+    std::uint32_t magic;
+    std::uint32_t binaryFormat;
+    std::uint64_t driverHash;
+    std::uint64_t programHash;
+    std::uint64_t binarySize;
+};
+
+// Magic number of program binary files ('LLPB').
+static const std::uint32_t g_programBinaryMagic = 0x42504C4C;
+
+static std::uint64_t HashGLString(GLenum name, std::uint64_t hash)
+{
+    auto str = glGetString(name);
+    return (str != nullptr ? GLProgramBinaryCache::Hash(reinterpret_cast<const char*>(str), hash) : hash);
+}
+
+GLProgramBinaryCache::GLProgramBinaryCache(const std::string& directory) :
+    directory_ { directory }
+{
+    /* Append path separator */
+    if (!directory_.empty() && directory_.back() != '/' && directory_.back() != '\\')
+        directory_ += '/';
+
+    /* Hash driver identification, so binaries of another driver version are never passed to glProgramBinary */
+    driverHash_ = HashGLString(GL_VENDOR, driverHash_);
+    driverHash_ = HashGLString(GL_RENDERER, driverHash_);
+    driverHash_ = HashGLString(GL_VERSION, driverHash_);
+}
+
+GLProgramBinaryCache::~GLProgramBinaryCache()
+{
+    Flush(true);
+
+    if (numHits_ > 0 || numMisses_ > 0)
+    {
+        Log::PostReport(
+            Log::ReportType::Information,
+            (
+                "GL program binary cache: " + std::to_string(numHits_) + " hit(s), " + std::to_string(numMisses_) + " miss(es), " +
+                std::to_string(numRejected_) + " binary(ies) rejected by driver"
+            ),
+            directory_
+        );
+    }
+}
+
+bool GLProgramBinaryCache::IsSupported()
+{
+    #ifdef GL_ARB_get_program_binary
+    if (HasExtension(GLExt::ARB_get_program_binary))
+    {
+        GLint numFormats = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numFormats);
+        return (numFormats > 0);
+    }
+    #endif // /GL_ARB_get_program_binary
+    return false;
+}
+
+std::uint64_t GLProgramBinaryCache::Hash(const void* data, std::size_t size, std::uint64_t hash)
+{
+    auto bytes = reinterpret_cast<const std::uint8_t*>(data);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+std::uint64_t GLProgramBinaryCache::Hash(const char* str, std::uint64_t hash)
+{
+    /* Include null-terminator, so concatenated strings produce distinct hashes */
+    for (; *str != '\0'; ++str)
+    {
+        hash ^= static_cast<std::uint8_t>(*str);
+        hash *= 1099511628211ull;
+    }
+    return Hash("", 1, hash);
+}
+
+bool GLProgramBinaryCache::Load(GLuint program, std::uint64_t programHash)
+{
+    #ifdef GL_ARB_get_program_binary
+
+    std::ifstream file { GetFilename(programHash), std::ios_base::in | std::ios_base::binary };
+    if (file.good())
+    {
+        /* Read and validate header */
+        GLProgramBinaryHeader header;
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+        if ( file.good()                                &&
+             header.magic       == g_programBinaryMagic &&
+             header.driverHash  == driverHash_          &&
+             header.programHash == programHash          &&
+             header.binarySize  >  0                    &&
+             header.binarySize  <= 0x7FFFFFFF )
+        {
+            /* Read program binary */
+            std::vector<char> binary(static_cast<std::size_t>(header.binarySize));
+            file.read(binary.data(), static_cast<std::streamsize>(binary.size()));
+
+            if (file.good())
+            {
+                /* Pass binary to GL; the driver may still reject it, e.g. after a driver update with the same version string */
+                glProgramBinary(program, header.binaryFormat, binary.data(), static_cast<GLsizei>(binary.size()));
+
+                GLint status = 0;
+                glGetProgramiv(program, GL_LINK_STATUS, &status);
+
+                if (status != GL_FALSE)
+                {
+                    ++numHits_;
+                    return true;
+                }
+
+                ++numRejected_;
+            }
+        }
+    }
+
+    #endif // /GL_ARB_get_program_binary
+
+    ++numMisses_;
+    return false;
+}
+
+void GLProgramBinaryCache::StoreDeferred(GLuint program, std::uint64_t programHash)
+{
+    pendingPrograms_.push_back({ program, programHash });
+}
+
+void GLProgramBinaryCache::Flush(bool wait)
+{
+    for (auto it = pendingPrograms_.begin(); it != pendingPrograms_.end();)
+    {
+        if (wait || GLShaderProgram::IsLinkComplete(it->program))
+        {
+            Store(it->program, it->programHash);
+            it = pendingPrograms_.erase(it);
+        }
+        else
+            ++it;
+    }
+}
+
+void GLProgramBinaryCache::Discard(GLuint program)
+{
+    for (auto it = pendingPrograms_.begin(); it != pendingPrograms_.end(); ++it)
+    {
+        if (it->program == program)
+        {
+            pendingPrograms_.erase(it);
+            return;
+        }
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void GLProgramBinaryCache::Store(GLuint program, std::uint64_t programHash)
+{
+    #ifdef GL_ARB_get_program_binary
+
+    /* Only store binaries of successfully linked programs */
+    GLint status = 0;
+    glGetProgramiv(program, GL_LINK_STATUS, &status);
+    if (status == GL_FALSE)
+        return;
+
+    /* Query program binary */
+    GLint binaryLength = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
+    if (binaryLength <= 0)
+        return;
+
+    std::vector<char> binary(static_cast<std::size_t>(binaryLength));
+    GLsizei writtenLength = 0;
+    GLenum  binaryFormat  = 0;
+    glGetProgramBinary(program, binaryLength, &writtenLength, &binaryFormat, binary.data());
+    if (writtenLength <= 0)
+        return;
+
+    /* Write binary into temporary file first, so a concurrent process never reads a partially written file */
+    const auto filename     = GetFilename(programHash);
+    const auto tempFilename = filename + ".tmp";
+
+    GLProgramBinaryHeader header;
+    {
+        header.magic        = g_programBinaryMagic;
+        header.binaryFormat = binaryFormat;
+        header.driverHash   = driverHash_;
+        header.programHash  = programHash;
+        header.binarySize   = static_cast<std::uint64_t>(writtenLength);
+    }
+
+    {
+        std::ofstream file { tempFilename, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc };
+        if (!file.good())
+            return;
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(binary.data(), static_cast<std::streamsize>(writtenLength));
+
+        if (!file.good())
+        {
+            file.close();
+            std::remove(tempFilename.c_str());
+            return;
+        }
+    }
+
+    std::remove(filename.c_str());
+    if (std::rename(tempFilename.c_str(), filename.c_str()) != 0)
+        std::remove(tempFilename.c_str());
+
+    #endif // /GL_ARB_get_program_binary
+}
+
+std::string GLProgramBinaryCache::GetFilename(std::uint64_t programHash) const
+{
+    /* Combine program hash with driver hash, so different drivers can share the same cache directory */
+    const auto hash = Hash(&driverHash_, sizeof(driverHash_), programHash);
+
+    char hashStr[17];
+    std::snprintf(hashStr, sizeof(hashStr), "%016llx", static_cast<unsigned long long>(hash));
+
+    return directory_ + hashStr + ".glbin";
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,120 @@
+/*
+ * GLProgramBinaryCache.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_PROGRAM_BINARY_CACHE_H
+#define LLGL_GL_PROGRAM_BINARY_CACHE_H
+
+
+#include "../OpenGL.h"
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+/*
+On-disk cache of linked GL program binaries (see GL_ARB_get_program_binary).
+Each program is stored in its own file within the cache directory. The file name is derived from the hash of the program (i.e. its shader sources and
+link-time bindings) combined with the hash of the driver vendor, renderer, and version strings, so a driver update invalidates all cached binaries.
+*/
+class GLProgramBinaryCache
+{
+
+    public:
+
+        GLProgramBinaryCache(const GLProgramBinaryCache&) = delete;
+        GLProgramBinaryCache& operator = (const GLProgramBinaryCache&) = delete;
+
+        // Initializes the cache for the specified directory and the driver of the current GL context. The directory must already exist.
+        GLProgramBinaryCache(const std::string& directory);
+
+        // Stores all pending program binaries and reports the number of cache hits and misses.
+        ~GLProgramBinaryCache();
+
+        // Returns true if the GL context supports at least one program binary format.
+        static bool IsSupported();
+
+        // Returns the FNV-1a hash of the specified data, continued from the specified hash value.
+        static std::uint64_t Hash(const void* data, std::size_t size, std::uint64_t hash = g_hashOffsetBasis);
+
+        // Returns the hash of the specified null-terminated string, continued from the specified hash value.
+        static std::uint64_t Hash(const char* str, std::uint64_t hash = g_hashOffsetBasis);
+
+        /*
+        Loads the cached binary for the specified program hash into the GL program.
+        Returns false if there is no cached binary or if the driver rejected it, in which case the program must be linked from source.
+        */
+        bool Load(GLuint program, std::uint64_t programHash);
+
+        /*
+        Schedules the binary of the specified GL program to be stored once it has been linked. The program must be linked with GL_PROGRAM_BINARY_RETRIEVABLE_HINT.
+        The link status is not queried here, so the driver can continue to link the program in the background.
+        */
+        void StoreDeferred(GLuint program, std::uint64_t programHash);
+
+        // Stores the binaries of all pending programs whose link has completed. If 'wait' is true, all pending programs are stored.
+        void Flush(bool wait = false);
+
+        // Removes the specified program from the pending programs. This must be called before a pending program is deleted.
+        void Discard(GLuint program);
+
+        // Returns the number of programs that have been loaded from the cache.
+        inline std::uint32_t GetNumHits() const
+        {
+            return numHits_;
+        }
+
+        // Returns the number of programs that were not found in the cache or whose cached binary was rejected.
+        inline std::uint32_t GetNumMisses() const
+        {
+            return numMisses_;
+        }
+
+    public:
+
+        // Initial value for the FNV-1a hash function.
+        static const std::uint64_t g_hashOffsetBasis = 14695981039346656037ull;
+
+    private:
+
+        struct PendingProgram
+        {
+            GLuint          program;
+            std::uint64_t   programHash;
+        };
+
+    private:
+
+        void Store(GLuint program, std::uint64_t programHash);
+
+        std::string GetFilename(std::uint64_t programHash) const;
+
+    private:
+
+        std::string                 directory_;
+        std::uint64_t               driverHash_     = 0;
+        std::vector<PendingProgram> pendingPrograms_;
+
+        std::uint32_t               numHits_        = 0;
+        std::uint32_t               numMisses_      = 0;
+        std::uint32_t               numRejected_    = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
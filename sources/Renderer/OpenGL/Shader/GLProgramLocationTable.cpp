@@ -0,0 +1,206 @@
+/*
+ * GLProgramLocationTable.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLProgramLocationTable.h"
+#include "GLProgramBinaryCache.h"
+#include "../Ext/GLExtensions.h"
+#include "../../GLCommon/GLExtensionRegistry.h"
+#include <algorithm>
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+GLProgramLocationTable::GLProgramLocationTable(GLuint program) :
+    program_ { program }
+{
+}
+
+GLint GLProgramLocationTable::FindUniformLocation(const char* name) const
+{
+    BuildOnce();
+    if (auto entry = Find(uniforms_, name))
+        return static_cast<GLint>(entry->value);
+    return -1;
+}
+
+GLuint GLProgramLocationTable::FindUniformBlockIndex(const char* name) const
+{
+    BuildOnce();
+    if (auto entry = Find(uniformBlocks_, name))
+        return entry->value;
+    return GL_INVALID_INDEX;
+}
+
+GLuint GLProgramLocationTable::FindStorageBlockIndex(const char* name) const
+{
+    BuildOnce();
+    if (auto entry = Find(storageBlocks_, name))
+        return entry->value;
+    return GL_INVALID_INDEX;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void GLProgramLocationTable::BuildOnce() const
+{
+    if (!built_)
+    {
+        BuildUniforms();
+        BuildUniformBlocks();
+        BuildStorageBlocks();
+        built_ = true;
+    }
+}
+
+void GLProgramLocationTable::BuildUniforms() const
+{
+    /* Query active uniforms */
+    GLint numUniforms = 0, maxNameLength = 0;
+    glGetProgramiv(program_, GL_ACTIVE_UNIFORMS, &numUniforms);
+    glGetProgramiv(program_, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxNameLength);
+    if (numUniforms <= 0 || maxNameLength <= 0)
+        return;
+
+    std::vector<char> name(static_cast<std::size_t>(maxNameLength), '\0');
+
+    for (GLuint i = 0; i < static_cast<GLuint>(numUniforms); ++i)
+    {
+        GLsizei nameLength  = 0;
+        GLint   size        = 0;
+        GLenum  type        = 0;
+        glGetActiveUniform(program_, i, maxNameLength, &nameLength, &size, &type, name.data());
+
+        /* Skip members of uniform blocks, they have no location */
+        auto location = glGetUniformLocation(program_, name.data());
+        if (location < 0)
+            continue;
+
+        Insert(uniforms_, name.data(), static_cast<GLuint>(location));
+
+        /* Arrays are reported as "name[0]", so also register the array name and all other elements */
+        if (nameLength > 3 && std::strcmp(name.data() + nameLength - 3, "[0]") == 0)
+        {
+            const auto baseLength = static_cast<std::size_t>(nameLength - 3);
+            name[baseLength] = '\0';
+            Insert(uniforms_, name.data(), static_cast<GLuint>(location));
+
+            for (GLint j = 1; j < size; ++j)
+            {
+                std::string element = std::string(name.data(), baseLength) + '[' + std::to_string(j) + ']';
+                auto elementLocation = glGetUniformLocation(program_, element.c_str());
+                if (elementLocation >= 0)
+                    Insert(uniforms_, element.c_str(), static_cast<GLuint>(elementLocation));
+            }
+        }
+    }
+
+    Sort(uniforms_);
+}
+
+void GLProgramLocationTable::BuildUniformBlocks() const
+{
+    if (!HasExtension(GLExt::ARB_uniform_buffer_object))
+        return;
+
+    /* Query active uniform blocks */
+    GLint numUniformBlocks = 0, maxNameLength = 0;
+    glGetProgramiv(program_, GL_ACTIVE_UNIFORM_BLOCKS, &numUniformBlocks);
+    glGetProgramiv(program_, GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH, &maxNameLength);
+    if (numUniformBlocks <= 0 || maxNameLength <= 0)
+        return;
+
+    std::vector<char> name(static_cast<std::size_t>(maxNameLength), '\0');
+
+    for (GLuint i = 0; i < static_cast<GLuint>(numUniformBlocks); ++i)
+    {
+        GLsizei nameLength = 0;
+        glGetActiveUniformBlockName(program_, i, maxNameLength, &nameLength, name.data());
+        Insert(uniformBlocks_, name.data(), i);
+    }
+
+    Sort(uniformBlocks_);
+}
+
+void GLProgramLocationTable::BuildStorageBlocks() const
+{
+    #if defined GL_ARB_program_interface_query && defined GL_ARB_shader_storage_buffer_object
+
+    if (!HasExtension(GLExt::ARB_program_interface_query) || !HasExtension(GLExt::ARB_shader_storage_buffer_object))
+        return;
+
+    /* Query active shader storage blocks */
+    GLint numStorageBlocks = 0, maxNameLength = 0;
+    glGetProgramInterfaceiv(program_, GL_SHADER_STORAGE_BLOCK, GL_ACTIVE_RESOURCES, &numStorageBlocks);
+    glGetProgramInterfaceiv(program_, GL_SHADER_STORAGE_BLOCK, GL_MAX_NAME_LENGTH, &maxNameLength);
+    if (numStorageBlocks <= 0 || maxNameLength <= 0)
+        return;
+
+    std::vector<char> name(static_cast<std::size_t>(maxNameLength), '\0');
+
+    for (GLuint i = 0; i < static_cast<GLuint>(numStorageBlocks); ++i)
+    {
+        GLsizei nameLength = 0;
+        glGetProgramResourceName(program_, GL_SHADER_STORAGE_BLOCK, i, maxNameLength, &nameLength, name.data());
+        Insert(storageBlocks_, name.data(), i);
+    }
+
+    Sort(storageBlocks_);
+
+    #endif // /GL_ARB_program_interface_query && GL_ARB_shader_storage_buffer_object
+}
+
+void GLProgramLocationTable::Insert(EntryList& entries, const char* name, GLuint value)
+{
+    entries.push_back({ GLProgramBinaryCache::Hash(name), value, name });
+}
+
+void GLProgramLocationTable::Sort(EntryList& entries)
+{
+    std::sort(
+        entries.begin(), entries.end(),
+        [](const Entry& lhs, const Entry& rhs)
+        {
+            return (lhs.hash < rhs.hash);
+        }
+    );
+}
+
+const GLProgramLocationTable::Entry* GLProgramLocationTable::Find(const EntryList& entries, const char* name)
+{
+    /* Find first entry with matching hash */
+    const auto hash = GLProgramBinaryCache::Hash(name);
+
+    auto it = std::lower_bound(
+        entries.begin(), entries.end(), hash,
+        [](const Entry& entry, std::uint64_t value)
+        {
+            return (entry.hash < value);
+        }
+    );
+
+    /* Compare names to resolve hash collisions */
+    for (; it != entries.end() && it->hash == hash; ++it)
+    {
+        if (it->name == name)
+            return &(*it);
+    }
+
+    return nullptr;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,88 @@
+/*
+ * GLProgramLocationTable.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_PROGRAM_LOCATION_TABLE_H
+#define LLGL_GL_PROGRAM_LOCATION_TABLE_H
+
+
+#include "../OpenGL.h"
+#include <string>
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/*
+Table of all uniform locations, uniform block indices, and shader storage block indices of a GL shader program.
+The table is built once from all active program resources the first time it is queried (i.e. after the program has been linked),
+and each name is looked up by its hash, so no GL query is required for subsequent lookups.
+*/
+class GLProgramLocationTable
+{
+
+    public:
+
+        GLProgramLocationTable(const GLProgramLocationTable&) = delete;
+        GLProgramLocationTable& operator = (const GLProgramLocationTable&) = delete;
+
+        GLProgramLocationTable(GLuint program);
+
+        // Returns the location of the specified uniform, or -1 if the program has no such active uniform.
+        GLint FindUniformLocation(const char* name) const;
+
+        // Returns the index of the specified uniform block, or GL_INVALID_INDEX if the program has no such active uniform block.
+        GLuint FindUniformBlockIndex(const char* name) const;
+
+        // Returns the index of the specified shader storage block, or GL_INVALID_INDEX if the program has no such active shader storage block.
+        GLuint FindStorageBlockIndex(const char* name) const;
+
+    private:
+
+        struct Entry
+        {
+            std::uint64_t   hash;
+            GLuint          value;
+            std::string     name;
+        };
+
+        using EntryList = std::vector<Entry>;
+
+    private:
+
+        void BuildOnce() const;
+
+        void BuildUniforms() const;
+        void BuildUniformBlocks() const;
+        void BuildStorageBlocks() const;
+
+        static void Insert(EntryList& entries, const char* name, GLuint value);
+        static void Sort(EntryList& entries);
+        static const Entry* Find(const EntryList& entries, const char* name);
+
+    private:
+
+        GLuint              program_    = 0;
+
+        mutable bool        built_      = false;
+        mutable EntryList   uniforms_;
+        mutable EntryList   uniformBlocks_;
+        mutable EntryList   storageBlocks_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -6,6 +6,9 @@
  */
 
 #include "GLShader.h"
+#include "GLShaderProgram.h"
+#include "GLProgramBinaryCache.h"
+#include "../Command/GLRenderThread.h"
 #include "../Ext/GLExtensions.h"
 #include "../../GLCommon/GLExtensionRegistry.h"
 #include "../../GLCommon/GLTypes.h"
@@ -20,6 +23,23 @@ namespace LLGL
 {
 
 
+// Returns the hash of the vertex attribute locations that are bound for the specified vertex formats (see GLShaderProgram::BuildInputLayout).
+static std::uint64_t HashVertexFormats(const std::vector<VertexFormat>& vertexFormats)
+{
+    auto hash = GLProgramBinaryCache::g_hashOffsetBasis;
+
+    for (const auto& vertexFormat : vertexFormats)
+    {
+        for (const auto& attrib : vertexFormat.attributes)
+        {
+            hash = GLProgramBinaryCache::Hash(attrib.name.c_str(), hash);
+            hash = GLProgramBinaryCache::Hash(&(attrib.semanticIndex), sizeof(attrib.semanticIndex), hash);
+        }
+    }
+
+    return hash;
+}
+
 GLShader::GLShader(const ShaderDescriptor& desc) :
     Shader { desc.type }
 {
@@ -34,6 +54,8 @@ GLShader::~GLShader()
 
 bool GLShader::HasErrors() const
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(HasErrors());
+
     GLint status = 0;
     glGetShaderiv(id_, GL_COMPILE_STATUS, &status);
     return (status == GL_FALSE);
@@ -46,6 +68,8 @@ std::string GLShader::Disassemble(int flags)
 
 std::string GLShader::QueryInfoLog()
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(QueryInfoLog());
+
     /* Query info log length */
     GLint infoLogLength = 0;
     glGetShaderiv(id_, GL_INFO_LOG_LENGTH, &infoLogLength);
@@ -68,6 +92,53 @@ std::string GLShader::QueryInfoLog()
 }
 
 
+std::shared_ptr<GLShaderProgram> GLShader::GetOrLinkSeparableProgram(const std::vector<VertexFormat>& vertexFormats)
+{
+    const auto type                 = GetType();
+    const auto vertexFormatsHash    = (type == ShaderType::Vertex ? HashVertexFormats(vertexFormats) : 0);
+
+    /* Find separable program that has already been linked with the same vertex attribute locations */
+    for (const auto& entry : separablePrograms_)
+    {
+        if (entry.vertexFormatsHash == vertexFormatsHash)
+            return entry.program;
+    }
+
+    /* Link new separable program with this shader only */
+    ShaderProgramDescriptor programDesc;
+    {
+        switch (type)
+        {
+            case ShaderType::Vertex:
+                programDesc.vertexFormats           = vertexFormats;
+                programDesc.vertexShader            = this;
+                break;
+            case ShaderType::TessControl:
+                programDesc.tessControlShader       = this;
+                break;
+            case ShaderType::TessEvaluation:
+                programDesc.tessEvaluationShader    = this;
+                break;
+            case ShaderType::Geometry:
+                programDesc.geometryShader          = this;
+                break;
+            case ShaderType::Fragment:
+                programDesc.fragmentShader          = this;
+                break;
+            case ShaderType::Compute:
+                programDesc.computeShader           = this;
+                break;
+            default:
+                break;
+        }
+    }
+    auto program = std::make_shared<GLShaderProgram>(programDesc, nullptr, GLProgramLinkage::Separable);
+    separablePrograms_.push_back({ vertexFormatsHash, program });
+
+    return program;
+}
+
+
 /*
  * ======= Protected: =======
  */
@@ -115,6 +186,10 @@ void GLShader::CompileSource(const ShaderDescriptor& shaderDesc)
     glShaderSource(id_, 1, strings, nullptr);
     glCompileShader(id_);
 
+    /* Store hash of source code to identify the shader in the program binary cache */
+    const auto type = GetType();
+    sourceHash_ = GLProgramBinaryCache::Hash(strings[0], GLProgramBinaryCache::Hash(&type, sizeof(type)));
+
     /* Store stream-output format */
     streamOutputFormat_ = shaderDesc.streamOutput.format;
 }
@@ -10,13 +10,19 @@
 
 
 #include <LLGL/Shader.h>
+#include <LLGL/VertexFormat.h>
 #include "../OpenGL.h"
+#include <memory>
+#include <vector>
+#include <cstdint>
 
 
 namespace LLGL
 {
 
 
+class GLShaderProgram;
+
 class GLShader final : public Shader
 {
 
@@ -37,20 +43,42 @@ class GLShader final : public Shader
             return id_;
         }
 
+        // Returns the hash of the shader type and source code, or 0 if the shader was loaded from a binary.
+        inline std::uint64_t GetSourceHash() const
+        {
+            return sourceHash_;
+        }
+
+        /*
+        Returns the separable program that only contains this shader, and links it on first use (see GL_ARB_separate_shader_objects).
+        Only vertex shaders depend on the vertex formats, and they are linked once for each distinct list of vertex formats.
+        */
+        std::shared_ptr<GLShaderProgram> GetOrLinkSeparableProgram(const std::vector<VertexFormat>& vertexFormats);
+
     protected:
 
         friend class GLShaderProgram;
 
         bool MoveStreamOutputFormat(StreamOutputFormat& streamOutputFormat);
 
+    private:
+
+        struct SeparableProgram
+        {
+            std::uint64_t                       vertexFormatsHash;
+            std::shared_ptr<GLShaderProgram>    program;
+        };
+
     private:
 
         void Build(const ShaderDescriptor& shaderDesc);
         void CompileSource(const ShaderDescriptor& shaderDesc);
         void LoadBinary(const ShaderDescriptor& shaderDesc);
 
-        GLuint              id_ = 0;
-        StreamOutputFormat  streamOutputFormat_;
+        GLuint                          id_                 = 0;
+        std::uint64_t                   sourceHash_         = 0;
+        StreamOutputFormat              streamOutputFormat_;
+        std::vector<SeparableProgram>   separablePrograms_;
 
 };
 
@@ -7,15 +7,19 @@
 
 #include "GLShaderProgram.h"
 #include "GLShader.h"
+#include "GLProgramBinaryCache.h"
+#include "../Command/GLRenderThread.h"
 #include "../RenderState/GLStateManager.h"
 #include "../Ext/GLExtensions.h"
 #include "../Ext/GLExtensionLoader.h"
 #include "../../CheckedCast.h"
 #include "../../GLCommon/GLTypes.h"
 #include "../../../Core/Exception.h"
+#include "../../../Core/Helper.h"
 #include <LLGL/VertexFormat.h>
 #include <LLGL/Constants.h>
 #include <vector>
+#include <algorithm>
 #include <stdexcept>
 
 
@@ -23,28 +27,118 @@ namespace LLGL
 {
 
 
-GLShaderProgram::GLShaderProgram(const ShaderProgramDescriptor& desc) :
-    id_      { glCreateProgram() },
-    uniform_ { id_               }
+GLShaderProgram::GLShaderProgram(
+    const ShaderProgramDescriptor&  desc,
+    GLProgramBinaryCache*           binaryCache,
+    const GLProgramLinkage          linkage)
+:
+    id_             { linkage != GLProgramLinkage::Pipeline ? glCreateProgram() : 0 },
+    locationTable_  { id_                                                           },
+    uniform_        { locationTable_                                                }
 {
-    Attach(desc.vertexShader);
-    Attach(desc.tessControlShader);
-    Attach(desc.tessEvaluationShader);
-    Attach(desc.geometryShader);
-    Attach(desc.fragmentShader);
-    Attach(desc.computeShader);
-    BuildInputLayout(desc.vertexFormats.size(), desc.vertexFormats.data());
-    Link();
+    if (linkage == GLProgramLinkage::Pipeline)
+    {
+        /* Combine the separable programs of all shaders, which are only linked once per shader */
+        BuildProgramPipeline(desc);
+        BuildVertexFormatVAO(desc.vertexFormats.size(), desc.vertexFormats.data());
+    }
+    else
+    {
+        Attach(desc.vertexShader, linkage);
+        Attach(desc.tessControlShader, linkage);
+        Attach(desc.tessEvaluationShader, linkage);
+        Attach(desc.geometryShader, linkage);
+        Attach(desc.fragmentShader, linkage);
+        Attach(desc.computeShader, linkage);
+        BuildInputLayout(desc.vertexFormats.size(), desc.vertexFormats.data());
+
+        if (linkage == GLProgramLinkage::Separable)
+        {
+            /* A separable program is only bound as stage of a program pipeline, which holds the vertex format */
+            #ifdef GL_ARB_separate_shader_objects
+            glProgramParameteri(id_, GL_PROGRAM_SEPARABLE, GL_TRUE);
+            #endif
+            Link();
+        }
+        else
+        {
+            BuildVertexFormatVAO(desc.vertexFormats.size(), desc.vertexFormats.data());
+            if (binaryCache != nullptr)
+                LinkWithBinaryCache(desc, *binaryCache);
+            else
+                Link();
+        }
+    }
 }
 
 GLShaderProgram::~GLShaderProgram()
 {
-    glDeleteProgram(id_);
-    GLStateManager::active->NotifyShaderProgramRelease(id_);
+    if (pipeline_ != 0)
+    {
+        #ifdef GL_ARB_separate_shader_objects
+        glDeleteProgramPipelines(1, &pipeline_);
+        GLStateManager::active->NotifyProgramPipelineRelease(pipeline_);
+        #endif
+    }
+    else
+    {
+        glDeleteProgram(id_);
+        GLStateManager::active->NotifyShaderProgramRelease(id_);
+    }
+}
+
+bool GLShaderProgram::IsLinkComplete(GLuint program)
+{
+    #ifndef __APPLE__
+    /* Query completion status without waiting for the driver's compiler threads */
+    if (HasExtension(GLExt::KHR_parallel_shader_compile) || HasExtension(GLExt::ARB_parallel_shader_compile))
+    {
+        GLint status = GL_FALSE;
+        glGetProgramiv(program, GL_COMPLETION_STATUS_KHR, &status);
+        return (status != GL_FALSE);
+    }
+    #endif // /__APPLE__
+    return true;
+}
+
+bool GLShaderProgram::IsProgramPipelineSupported()
+{
+    #ifdef GL_ARB_separate_shader_objects
+    /* glProgramParameteri is loaded with GL_ARB_get_program_binary */
+    return (HasExtension(GLExt::ARB_separate_shader_objects) && HasExtension(GLExt::ARB_get_program_binary));
+    #else
+    return false;
+    #endif
+}
+
+void GLShaderProgram::Bind(GLStateManager& stateMngr) const
+{
+    #ifdef GL_ARB_separate_shader_objects
+    if (pipeline_ != 0)
+        stateMngr.BindProgramPipeline(pipeline_);
+    else
+    #endif
+    stateMngr.BindShaderProgram(id_);
 }
 
 bool GLShaderProgram::HasErrors() const
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(HasErrors());
+
+    /*
+    A program pipeline has errors if any of its separable programs failed to link.
+    The validation status is not considered here, since it depends on the current GL state (see QueryInfoLog).
+    */
+    if (pipeline_ != 0)
+    {
+        for (const auto& stageProgram : stagePrograms_)
+        {
+            if (stageProgram->HasErrors())
+                return true;
+        }
+        return false;
+    }
+
     GLint status = 0;
     glGetProgramiv(id_, GL_LINK_STATUS, &status);
     return (status == GL_FALSE);
@@ -52,6 +146,40 @@ bool GLShaderProgram::HasErrors() const
 
 std::string GLShaderProgram::QueryInfoLog()
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(QueryInfoLog());
+
+    /* Concatenate the info logs of all separable programs and the validation log of a program pipeline */
+    #ifdef GL_ARB_separate_shader_objects
+    if (pipeline_ != 0)
+    {
+        std::string infoLog;
+        for (const auto& stageProgram : stagePrograms_)
+            infoLog += stageProgram->QueryInfoLog();
+
+        /*
+        Validate the program pipeline only on demand, since this waits for all stages to be linked,
+        and the result depends on the current GL state (e.g. sampler bindings), so it is only informational
+        */
+        glValidateProgramPipeline(pipeline_);
+
+        GLint infoLogLength = 0;
+        glGetProgramPipelineiv(pipeline_, GL_INFO_LOG_LENGTH, &infoLogLength);
+
+        if (infoLogLength > 0)
+        {
+            std::vector<char> pipelineInfoLog;
+            pipelineInfoLog.resize(infoLogLength, '\0');
+
+            GLsizei charsWritten = 0;
+            glGetProgramPipelineInfoLog(pipeline_, infoLogLength, &charsWritten, pipelineInfoLog.data());
+
+            infoLog += pipelineInfoLog.data();
+        }
+
+        return infoLog;
+    }
+    #endif // /GL_ARB_separate_shader_objects
+
     /* Query info log length */
     GLint infoLogLength = 0;
     glGetProgramiv(id_, GL_INFO_LOG_LENGTH, &infoLogLength);
@@ -75,10 +203,15 @@ std::string GLShaderProgram::QueryInfoLog()
 
 ShaderReflectionDescriptor GLShaderProgram::QueryReflectionDesc() const
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(QueryReflectionDesc());
+
     ShaderReflectionDescriptor reflection;
 
     /* Reflect shader program */
-    Reflect(reflection);
+    if (pipeline_ != 0)
+        ReflectProgramPipeline(reflection);
+    else
+        Reflect(reflection);
 
     /* Sort output to meet the interface requirements */
     ShaderProgram::FinalizeShaderReflection(reflection);
@@ -88,22 +221,18 @@ ShaderReflectionDescriptor GLShaderProgram::QueryReflectionDesc() const
 
 void GLShaderProgram::BindConstantBuffer(const std::string& name, std::uint32_t bindingIndex)
 {
-    /* Query uniform block index and bind it to the specified binding index */
-    auto blockIndex = glGetUniformBlockIndex(id_, name.c_str());
-    if (blockIndex != GL_INVALID_INDEX)
-        glUniformBlockBinding(id_, blockIndex, bindingIndex);
-    else
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(BindConstantBuffer(name, bindingIndex));
+
+    if (!BindUniformBlock(name.c_str(), bindingIndex))
         throw std::invalid_argument("failed to bind constant buffer due to invalid uniform block name: " + name);
 }
 
 void GLShaderProgram::BindStorageBuffer(const std::string& name, std::uint32_t bindingIndex)
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(BindStorageBuffer(name, bindingIndex));
+
     #ifndef __APPLE__
-    /* Query shader storage block index and bind it to the specified binding index */
-    auto blockIndex = glGetProgramResourceIndex(id_, GL_SHADER_STORAGE_BLOCK, name.c_str());
-    if (blockIndex != GL_INVALID_INDEX)
-        glShaderStorageBlockBinding(id_, blockIndex, bindingIndex);
-    else
+    if (!BindStorageBlock(name.c_str(), bindingIndex))
         throw std::invalid_argument("failed to bind storage buffer due to invalid storage block name: " + name);
     #else
     throw std::runtime_error("storage buffers not supported on this platform");
@@ -112,6 +241,10 @@ void GLShaderProgram::BindStorageBuffer(const std::string& name, std::uint32_t b
 
 ShaderUniform* GLShaderProgram::LockShaderUniform()
 {
+    /* Uniforms cannot be set outside of the render thread, and a program pipeline has no single program to set them for */
+    if (GLRenderThread::IsForwardingRequired() || pipeline_ != 0)
+        return nullptr;
+
     GLStateManager::active->PushShaderProgram();
     GLStateManager::active->BindShaderProgram(id_);
     return (&uniform_);
@@ -129,6 +262,8 @@ bool GLShaderProgram::SetWorkGroupSize(const Extent3D& workGroupSize)
 
 bool GLShaderProgram::GetWorkGroupSize(Extent3D& workGroupSize) const
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(GetWorkGroupSize(workGroupSize));
+
     #ifdef GL_ARB_compute_shader
     if (HasExtension(GLExt::ARB_compute_shader))
     {
@@ -152,7 +287,7 @@ bool GLShaderProgram::GetWorkGroupSize(Extent3D& workGroupSize) const
  */
 
 //TODO: refactor "MoveStreamOutputFormat" (shader might be used multiple times, but internal container gets lost!)
-void GLShaderProgram::Attach(Shader* shader)
+void GLShaderProgram::Attach(Shader* shader, const GLProgramLinkage linkage)
 {
     if (shader != nullptr)
     {
@@ -161,8 +296,11 @@ void GLShaderProgram::Attach(Shader* shader)
         /* Attach shader to shader program */
         glAttachShader(id_, shaderGL->GetID());
 
-        /* Move stream-output format from shader to shader program (if available) */
-        shaderGL->MoveStreamOutputFormat(streamOutputFormat_);
+        /* Move stream-output format from shader to shader program (if available), but keep it for further separable programs of the same shader */
+        if (linkage == GLProgramLinkage::Separable)
+            streamOutputFormat_ = shaderGL->streamOutputFormat_;
+        else
+            shaderGL->MoveStreamOutputFormat(streamOutputFormat_);
     }
 }
 
@@ -207,6 +345,52 @@ void GLShaderProgram::BuildInputLayout(std::size_t numVertexFormats, const Verte
     }
 }
 
+// Returns true if all attributes of the specified vertex format have the same instance divisor.
+static bool HasUniformInstanceDivisor(const VertexFormat& vertexFormat)
+{
+    for (const auto& attrib : vertexFormat.attributes)
+    {
+        if (attrib.instanceDivisor != vertexFormat.attributes.front().instanceDivisor)
+            return false;
+    }
+    return true;
+}
+
+void GLShaderProgram::BuildVertexFormatVAO(std::size_t numVertexFormats, const VertexFormat* vertexFormats)
+{
+    if (numVertexFormats == 0 || vertexFormats == nullptr || !GLVertexArrayObject::IsVertexAttribBindingSupported())
+        return;
+
+    /* Vertex buffer binding points are limited by the state manager */
+    if (numVertexFormats > LLGL_MAX_NUM_VERTEX_BUFFER_BINDINGS)
+        return;
+
+    /*
+    The instance divisor is a state of the binding point, i.e. all attributes of one vertex format share the same divisor.
+    Otherwise, fall back to the VAOs of the vertex buffers, which specify the divisor per attribute with glVertexAttribDivisor.
+    */
+    for (std::size_t i = 0; i < numVertexFormats; ++i)
+    {
+        if (!HasUniformInstanceDivisor(vertexFormats[i]))
+            return;
+    }
+
+    vertexFormatVAO_ = MakeUnique<GLVertexArrayObject>();
+
+    /* Build vertex format with the same attribute locations as in "BuildInputLayout" and one binding point per vertex format */
+    GLStateManager::active->BindVertexArray(vertexFormatVAO_->GetID());
+    {
+        GLuint index = 0;
+
+        for (std::size_t i = 0; i < numVertexFormats; ++i)
+        {
+            for (const auto& attrib : vertexFormats[i].attributes)
+                vertexFormatVAO_->BuildVertexFormat(attrib, index++, static_cast<std::uint32_t>(i));
+        }
+    }
+    GLStateManager::active->BindVertexArray(0);
+}
+
 void GLShaderProgram::Link()
 {
     /* Check if transform-feedback varyings must be specified (before or after shader linking) */
@@ -237,6 +421,182 @@ void GLShaderProgram::Link()
     glLinkProgram(id_);
 }
 
+void GLShaderProgram::LinkWithBinaryCache(const ShaderProgramDescriptor& desc, GLProgramBinaryCache& binaryCache)
+{
+    #ifdef GL_ARB_get_program_binary
+
+    const auto programHash = HashProgram(desc);
+    if (programHash != 0)
+    {
+        /* Try to load program from cache, which replaces the link step */
+        if (binaryCache.Load(id_, programHash))
+            return;
+
+        /* Link program from source and store its binary for the next run once the driver has finished linking */
+        glProgramParameteri(id_, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+        Link();
+        binaryCache.StoreDeferred(id_, programHash);
+        return;
+    }
+
+    #endif // /GL_ARB_get_program_binary
+
+    Link();
+}
+
+#ifdef GL_ARB_separate_shader_objects
+
+static GLbitfield ToGLShaderStageBit(const ShaderType type)
+{
+    switch (type)
+    {
+        case ShaderType::Vertex:            return GL_VERTEX_SHADER_BIT;
+        case ShaderType::TessControl:       return GL_TESS_CONTROL_SHADER_BIT;
+        case ShaderType::TessEvaluation:    return GL_TESS_EVALUATION_SHADER_BIT;
+        case ShaderType::Geometry:          return GL_GEOMETRY_SHADER_BIT;
+        case ShaderType::Fragment:          return GL_FRAGMENT_SHADER_BIT;
+        case ShaderType::Compute:           return GL_COMPUTE_SHADER_BIT;
+        default:                            return 0;
+    }
+}
+
+#endif // /GL_ARB_separate_shader_objects
+
+void GLShaderProgram::BuildProgramPipeline(const ShaderProgramDescriptor& desc)
+{
+    #ifdef GL_ARB_separate_shader_objects
+
+    glGenProgramPipelines(1, &pipeline_);
+
+    Shader* shaders[] =
+    {
+        desc.vertexShader,
+        desc.tessControlShader,
+        desc.tessEvaluationShader,
+        desc.geometryShader,
+        desc.fragmentShader,
+        desc.computeShader,
+    };
+
+    for (auto shader : shaders)
+    {
+        if (shader != nullptr)
+        {
+            /* Use separable program of this shader for its stage, which is linked on first use */
+            auto shaderGL       = LLGL_CAST(GLShader*, shader);
+            auto stageProgram   = shaderGL->GetOrLinkSeparableProgram(desc.vertexFormats);
+            glUseProgramStages(pipeline_, ToGLShaderStageBit(shaderGL->GetType()), stageProgram->GetID());
+            stagePrograms_.push_back(std::move(stageProgram));
+        }
+    }
+
+    #else
+
+    ThrowNotSupportedExcept(__FUNCTION__, "GL_ARB_separate_shader_objects");
+
+    #endif // /GL_ARB_separate_shader_objects
+}
+
+// Binds the uniform block in this program, or in all separable programs of this program pipeline that contain it.
+bool GLShaderProgram::BindUniformBlock(const char* name, GLuint bindingIndex)
+{
+    if (pipeline_ != 0)
+    {
+        bool found = false;
+        for (const auto& stageProgram : stagePrograms_)
+        {
+            if (stageProgram->BindUniformBlock(name, bindingIndex))
+                found = true;
+        }
+        return found;
+    }
+
+    /* Find uniform block index and bind it to the specified binding index */
+    auto blockIndex = locationTable_.FindUniformBlockIndex(name);
+    if (blockIndex != GL_INVALID_INDEX)
+    {
+        glUniformBlockBinding(id_, blockIndex, bindingIndex);
+        return true;
+    }
+
+    return false;
+}
+
+// Binds the shader storage block in this program, or in all separable programs of this program pipeline that contain it.
+bool GLShaderProgram::BindStorageBlock(const char* name, GLuint bindingIndex)
+{
+    #ifndef __APPLE__
+
+    if (pipeline_ != 0)
+    {
+        bool found = false;
+        for (const auto& stageProgram : stagePrograms_)
+        {
+            if (stageProgram->BindStorageBlock(name, bindingIndex))
+                found = true;
+        }
+        return found;
+    }
+
+    /* Find shader storage block index and bind it to the specified binding index */
+    auto blockIndex = locationTable_.FindStorageBlockIndex(name);
+    if (blockIndex != GL_INVALID_INDEX)
+    {
+        glShaderStorageBlockBinding(id_, blockIndex, bindingIndex);
+        return true;
+    }
+
+    #endif // /__APPLE__
+
+    return false;
+}
+
+std::uint64_t GLShaderProgram::HashProgram(const ShaderProgramDescriptor& desc) const
+{
+    auto hash = GLProgramBinaryCache::g_hashOffsetBasis;
+
+    /* Hash source code of all attached shaders */
+    const Shader* shaders[] =
+    {
+        desc.vertexShader,
+        desc.tessControlShader,
+        desc.tessEvaluationShader,
+        desc.geometryShader,
+        desc.fragmentShader,
+        desc.computeShader,
+    };
+
+    for (auto shader : shaders)
+    {
+        if (shader != nullptr)
+        {
+            auto shaderGL = LLGL_CAST(const GLShader*, shader);
+            const auto sourceHash = shaderGL->GetSourceHash();
+            if (sourceHash == 0)
+                return 0;
+            hash = GLProgramBinaryCache::Hash(&sourceHash, sizeof(sourceHash), hash);
+        }
+        else
+            hash = GLProgramBinaryCache::Hash("", 1, hash);
+    }
+
+    /* Hash vertex attribute locations (see BuildInputLayout) */
+    for (const auto& vertexFormat : desc.vertexFormats)
+    {
+        for (const auto& attrib : vertexFormat.attributes)
+        {
+            hash = GLProgramBinaryCache::Hash(attrib.name.c_str(), hash);
+            hash = GLProgramBinaryCache::Hash(&(attrib.semanticIndex), sizeof(attrib.semanticIndex), hash);
+        }
+    }
+
+    /* Hash transform-feedback varyings */
+    for (const auto& attrib : streamOutputFormat_.attributes)
+        hash = GLProgramBinaryCache::Hash(attrib.name.c_str(), hash);
+
+    return hash;
+}
+
 bool GLShaderProgram::QueryActiveAttribs(
     GLenum attribCountType, GLenum attribNameLengthType,
     GLint& numAttribs, GLint& maxNameLength, std::vector<char>& nameBuffer) const
@@ -300,6 +660,53 @@ void GLShaderProgram::Reflect(ShaderReflectionDescriptor& reflection) const
     QueryUniforms(reflection);
 }
 
+void GLShaderProgram::ReflectProgramPipeline(ShaderReflectionDescriptor& reflection) const
+{
+    for (const auto& stageProgram : stagePrograms_)
+    {
+        ShaderReflectionDescriptor stageReflection;
+        stageProgram->Reflect(stageReflection);
+
+        /* Vertex attributes and stream-outputs are only reflected by the stages that declare them */
+        for (auto& attrib : stageReflection.vertexAttributes)
+            reflection.vertexAttributes.push_back(std::move(attrib));
+        for (auto& attrib : stageReflection.streamOutputAttributes)
+            reflection.streamOutputAttributes.push_back(std::move(attrib));
+
+        /* Merge resources that are used in multiple stages */
+        for (auto& resourceView : stageReflection.resourceViews)
+        {
+            auto it = std::find_if(
+                reflection.resourceViews.begin(),
+                reflection.resourceViews.end(),
+                [&resourceView](const ShaderReflectionDescriptor::ResourceView& entry)
+                {
+                    return (entry.name == resourceView.name && entry.type == resourceView.type);
+                }
+            );
+            if (it != reflection.resourceViews.end())
+                it->stageFlags |= resourceView.stageFlags;
+            else
+                reflection.resourceViews.push_back(std::move(resourceView));
+        }
+
+        /* Uniform locations are specific to each separable program, so only the first occurrence of each uniform is reflected */
+        for (auto& uniform : stageReflection.uniforms)
+        {
+            auto it = std::find_if(
+                reflection.uniforms.begin(),
+                reflection.uniforms.end(),
+                [&uniform](const UniformDescriptor& entry)
+                {
+                    return (entry.name == uniform.name);
+                }
+            );
+            if (it == reflection.uniforms.end())
+                reflection.uniforms.push_back(std::move(uniform));
+        }
+    }
+}
+
 // Vector format and number of vectors, e.g. mat2x3 --> { RGB32Float, 2 }
 static std::pair<Format, std::uint32_t> UnmapAttribType(GLenum type)
 {
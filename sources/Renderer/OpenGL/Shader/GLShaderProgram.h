@@ -11,19 +11,43 @@
 
 #include <LLGL/ShaderProgram.h>
 #include "GLShaderUniform.h"
+#include "GLProgramLocationTable.h"
+#include "../Buffer/GLVertexArrayObject.h"
 #include "../OpenGL.h"
+#include <memory>
+#include <vector>
+#include <cstdint>
 
 
 namespace LLGL
 {
 
 
+class GLProgramBinaryCache;
+class GLStateManager;
+
+// Specifies how the shaders of a GL shader program are linked (see GL_ARB_separate_shader_objects).
+enum class GLProgramLinkage
+{
+    Monolithic, // All shaders are linked into a single program.
+    Separable,  // All shaders are linked into a single program with GL_PROGRAM_SEPARABLE, so it can be used as stage of a program pipeline.
+    Pipeline,   // Each shader provides its own separable program, and these are combined by a program pipeline object.
+};
+
 class GLShaderProgram final : public ShaderProgram
 {
 
     public:
 
-        GLShaderProgram(const ShaderProgramDescriptor& desc);
+        /*
+        Links the shader program, or loads it from the specified program binary cache if it is non-null and contains a valid binary.
+        The program binary cache is only used for monolithic programs.
+        */
+        GLShaderProgram(
+            const ShaderProgramDescriptor&  desc,
+            GLProgramBinaryCache*           binaryCache = nullptr,
+            const GLProgramLinkage          linkage     = GLProgramLinkage::Monolithic
+        );
         ~GLShaderProgram();
 
         bool HasErrors() const override;
@@ -43,17 +67,41 @@ class GLShaderProgram final : public ShaderProgram
         
     public:
 
-        // Returns the shader program ID.
+        // Returns false if the driver is still linking the specified program in the background (requires GL_KHR_parallel_shader_compile). Otherwise, the link status can be queried without stalling.
+        static bool IsLinkComplete(GLuint program);
+
+        // Returns true if program pipelines are supported, i.e. GLProgramLinkage::Separable and GLProgramLinkage::Pipeline.
+        static bool IsProgramPipelineSupported();
+
+        // Binds either the shader program or the program pipeline object.
+        void Bind(GLStateManager& stateMngr) const;
+
+        // Returns the shader program ID, or 0 if this is a program pipeline.
         inline GLuint GetID() const
         {
             return id_;
         }
 
+        // Returns the ID of the VAO that holds the vertex format of this shader program, or 0 if there is no such VAO (see GL_ARB_vertex_attrib_binding).
+        inline GLuint GetVertexFormatVAO() const
+        {
+            return (vertexFormatVAO_ ? vertexFormatVAO_->GetID() : 0);
+        }
+
     private:
 
-        void Attach(Shader* shader);
+        void Attach(Shader* shader, const GLProgramLinkage linkage);
         void BuildInputLayout(std::size_t numVertexFormats, const VertexFormat* vertexFormats);
+        void BuildVertexFormatVAO(std::size_t numVertexFormats, const VertexFormat* vertexFormats);
         void Link();
+        void LinkWithBinaryCache(const ShaderProgramDescriptor& desc, GLProgramBinaryCache& binaryCache);
+        void BuildProgramPipeline(const ShaderProgramDescriptor& desc);
+
+        bool BindUniformBlock(const char* name, GLuint bindingIndex);
+        bool BindStorageBlock(const char* name, GLuint bindingIndex);
+
+        // Returns the hash of all attached shader sources and link-time bindings, or 0 if any shader was not compiled from source.
+        std::uint64_t HashProgram(const ShaderProgramDescriptor& desc) const;
 
         bool QueryActiveAttribs(
             GLenum attribCountType, GLenum attribNameLengthType,
@@ -66,6 +114,7 @@ class GLShaderProgram final : public ShaderProgram
         #endif
 
         void Reflect(ShaderReflectionDescriptor& reflection) const;
+        void ReflectProgramPipeline(ShaderReflectionDescriptor& reflection) const;
         void QueryVertexAttributes(ShaderReflectionDescriptor& reflection) const;
         void QueryStreamOutputAttributes(ShaderReflectionDescriptor& reflection) const;
         void QueryConstantBuffers(ShaderReflectionDescriptor& reflection) const;
@@ -78,9 +127,14 @@ class GLShaderProgram final : public ShaderProgram
 
     private:
 
-        GLuint              id_                 = 0;
-        GLShaderUniform     uniform_;
-        StreamOutputFormat  streamOutputFormat_;
+        GLuint                                  id_                 = 0;
+        GLProgramLocationTable                  locationTable_;
+        GLShaderUniform                         uniform_;
+        StreamOutputFormat                      streamOutputFormat_;
+        std::unique_ptr<GLVertexArrayObject>    vertexFormatVAO_;
+
+        GLuint                                          pipeline_       = 0;
+        std::vector<std::shared_ptr<GLShaderProgram>>   stagePrograms_;     // Separable programs of the program pipeline (shared with their shaders)
 
 };
 
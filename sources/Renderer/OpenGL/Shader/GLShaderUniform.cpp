@@ -13,11 +13,16 @@ namespace LLGL
 {
 
 
-GLShaderUniform::GLShaderUniform(GLuint program) :
-    program_ { program }
+GLShaderUniform::GLShaderUniform(const GLProgramLocationTable& locationTable) :
+    locationTable_ { locationTable }
 {
 }
 
+UniformLocation GLShaderUniform::GetUniformLocation(const char* name)
+{
+    return static_cast<UniformLocation>(GetLocation(name));
+}
+
 void GLShaderUniform::SetUniform1i(const UniformLocation location, int value0)
 {
     glUniform1i(static_cast<GLint>(location), value0);
@@ -215,7 +220,7 @@ void GLShaderUniform::SetUniform4x4fv(const char* name, const float* value, std:
 
 GLint GLShaderUniform::GetLocation(const char* name) const
 {
-    return glGetUniformLocation(program_, name);
+    return locationTable_.FindUniformLocation(name);
 }
 
 
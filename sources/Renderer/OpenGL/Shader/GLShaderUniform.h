@@ -10,6 +10,7 @@
 
 
 #include <LLGL/ShaderUniform.h>
+#include "GLProgramLocationTable.h"
 #include "../OpenGL.h"
 
 
@@ -22,7 +23,9 @@ class GLShaderUniform final : public ShaderUniform
 
     public:
 
-        GLShaderUniform(GLuint program);
+        GLShaderUniform(const GLProgramLocationTable& locationTable);
+
+        UniformLocation GetUniformLocation(const char* name) override;
 
         void SetUniform1i(const UniformLocation location, int value0) override;
         void SetUniform2i(const UniformLocation location, int value0, int value1) override;
@@ -76,7 +79,7 @@ class GLShaderUniform final : public ShaderUniform
 
         GLint GetLocation(const char* name) const;
 
-        GLuint program_ = 0;
+        const GLProgramLocationTable& locationTable_;
 
 };
 
@@ -0,0 +1,173 @@
+/*
+ * GLFramebufferCache.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLFramebufferCache.h"
+#include "../RenderState/GLStateManager.h"
+#include "../Ext/GLExtensions.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+GLFramebufferCache::GLFramebufferCache(std::size_t capacity) :
+    capacity_ { std::max(capacity, std::size_t(1)) }
+{
+    entries_.reserve(capacity_);
+}
+
+static bool CompareAttachments(const GLFramebufferAttachment& lhs, const GLFramebufferAttachment& rhs)
+{
+    return
+    (
+        lhs.texture     == rhs.texture  &&
+        lhs.target      == rhs.target   &&
+        lhs.mipLevel    == rhs.mipLevel &&
+        lhs.layer       == rhs.layer
+    );
+}
+
+bool GLFramebufferCache::BindFramebuffer(GLStateManager& stateMngr, GLFramebufferTarget target, const GLFramebufferAttachment& attachment)
+{
+    DeleteFramebuffersOfReleasedTextures(stateMngr);
+
+    /* Find cached FBO for this attachment */
+    for (auto& entry : entries_)
+    {
+        if (CompareAttachments(entry.attachment, attachment))
+        {
+            entry.lastUse = ++useCounter_;
+            ++numHits_;
+            stateMngr.BindFramebuffer(target, entry.framebuffer);
+            return true;
+        }
+    }
+
+    /* Evict least recently used FBO if the cache is full */
+    if (entries_.size() >= capacity_)
+    {
+        auto lru = std::min_element(
+            entries_.begin(), entries_.end(),
+            [](const Entry& lhs, const Entry& rhs)
+            {
+                return (lhs.lastUse < rhs.lastUse);
+            }
+        );
+        DeleteFramebuffer(stateMngr, lru->framebuffer);
+        entries_.erase(lru);
+    }
+
+    /* Create new FBO, which is left bound to the specified target */
+    ++numMisses_;
+    if (auto framebuffer = CreateFramebuffer(stateMngr, target, attachment))
+    {
+        entries_.push_back({ attachment, framebuffer, ++useCounter_ });
+        return true;
+    }
+
+    return false;
+}
+
+void GLFramebufferCache::NotifyTextureRelease(GLuint texture)
+{
+    std::lock_guard<std::mutex> guard { releasedTexturesMutex_ };
+    releasedTextures_.push_back(texture);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+static GLenum ToGLFramebufferTarget(GLFramebufferTarget target)
+{
+    switch (target)
+    {
+        case GLFramebufferTarget::DRAW_FRAMEBUFFER: return GL_DRAW_FRAMEBUFFER;
+        case GLFramebufferTarget::READ_FRAMEBUFFER: return GL_READ_FRAMEBUFFER;
+        default:                                    return GL_FRAMEBUFFER;
+    }
+}
+
+GLuint GLFramebufferCache::CreateFramebuffer(GLStateManager& stateMngr, GLFramebufferTarget target, const GLFramebufferAttachment& attachment)
+{
+    GLuint framebuffer = 0;
+    glGenFramebuffers(1, &framebuffer);
+    stateMngr.BindFramebuffer(target, framebuffer);
+
+    /* Attach texture to the first color attachment */
+    const auto targetGL = ToGLFramebufferTarget(target);
+
+    switch (attachment.target)
+    {
+        case GL_TEXTURE_1D:
+            glFramebufferTexture1D(targetGL, GL_COLOR_ATTACHMENT0, attachment.target, attachment.texture, attachment.mipLevel);
+            break;
+
+        case GL_TEXTURE_2D:
+        case GL_TEXTURE_2D_MULTISAMPLE:
+        case GL_TEXTURE_CUBE_MAP_POSITIVE_X:
+        case GL_TEXTURE_CUBE_MAP_NEGATIVE_X:
+        case GL_TEXTURE_CUBE_MAP_POSITIVE_Y:
+        case GL_TEXTURE_CUBE_MAP_NEGATIVE_Y:
+        case GL_TEXTURE_CUBE_MAP_POSITIVE_Z:
+        case GL_TEXTURE_CUBE_MAP_NEGATIVE_Z:
+            glFramebufferTexture2D(targetGL, GL_COLOR_ATTACHMENT0, attachment.target, attachment.texture, attachment.mipLevel);
+            break;
+
+        default:
+            glFramebufferTextureLayer(targetGL, GL_COLOR_ATTACHMENT0, attachment.texture, attachment.mipLevel, attachment.layer);
+            break;
+    }
+
+    /* Check completeness only once when the FBO is created */
+    if (glCheckFramebufferStatus(targetGL) != GL_FRAMEBUFFER_COMPLETE)
+    {
+        DeleteFramebuffer(stateMngr, framebuffer);
+        return 0;
+    }
+
+    return framebuffer;
+}
+
+void GLFramebufferCache::DeleteFramebuffer(GLStateManager& stateMngr, GLuint framebuffer)
+{
+    stateMngr.NotifyFramebufferRelease(framebuffer);
+    glDeleteFramebuffers(1, &framebuffer);
+}
+
+void GLFramebufferCache::DeleteFramebuffersOfReleasedTextures(GLStateManager& stateMngr)
+{
+    /* Take over the released textures, so the lock is not held while GL objects are deleted */
+    std::vector<GLuint> releasedTextures;
+    {
+        std::lock_guard<std::mutex> guard { releasedTexturesMutex_ };
+        releasedTextures.swap(releasedTextures_);
+    }
+
+    for (auto texture : releasedTextures)
+    {
+        for (auto it = entries_.begin(); it != entries_.end();)
+        {
+            if (it->attachment.texture == texture)
+            {
+                DeleteFramebuffer(stateMngr, it->framebuffer);
+                it = entries_.erase(it);
+            }
+            else
+                ++it;
+        }
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
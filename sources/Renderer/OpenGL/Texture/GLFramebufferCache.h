@@ -0,0 +1,113 @@
+/*
+ * GLFramebufferCache.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_FRAMEBUFFER_CACHE_H
+#define LLGL_GL_FRAMEBUFFER_CACHE_H
+
+
+#include "../RenderState/GLState.h"
+#include "../OpenGL.h"
+#include <cstdint>
+#include <vector>
+#include <mutex>
+
+
+namespace LLGL
+{
+
+
+class GLStateManager;
+
+// Texture attachment of a cached framebuffer.
+struct GLFramebufferAttachment
+{
+    GLuint  texture;    // GL texture ID.
+    GLenum  target;     // GL_TEXTURE_1D, GL_TEXTURE_2D, or a cube face for non-layered attachments, otherwise the target of the layered texture.
+    GLint   mipLevel;   // MIP level of the attachment.
+    GLint   layer;      // Array layer or depth slice for layered textures (1D array, 2D array, cube array, and 3D textures). Ignored otherwise.
+};
+
+/*
+Cache of framebuffer objects (FBOs) for transient operations such as MIP-map generation with glBlitFramebuffer.
+Each FBO has a single color attachment and is created and checked for completeness only once,
+so repeated operations on the same texture level merely bind the cached FBO instead of respecifying its attachment.
+FBOs are not shared between GL contexts, hence each GLContext has its own cache. The least recently used FBO is evicted when the cache is full.
+All functions except NotifyTextureRelease must be called on the thread the owning GL context is current on.
+The cached FBOs are not deleted when the cache is destroyed, since the cache is destroyed together with its GL context, which deletes them anyway.
+*/
+class GLFramebufferCache
+{
+
+    public:
+
+        GLFramebufferCache(std::size_t capacity = 64);
+
+        GLFramebufferCache(const GLFramebufferCache&) = delete;
+        GLFramebufferCache& operator = (const GLFramebufferCache&) = delete;
+
+        /*
+        Binds the FBO for the specified color attachment to the specified target, and creates it if it is not cached yet.
+        Returns false if the FBO is incomplete, in which case no FBO is cached.
+        */
+        bool BindFramebuffer(GLStateManager& stateMngr, GLFramebufferTarget target, const GLFramebufferAttachment& attachment);
+
+        /*
+        Invalidates all FBOs with the specified texture. This can be called from any thread, since the texture might be released on another context.
+        The FBOs are deleted with the next call to BindFramebuffer, where the GL context of this cache is current.
+        */
+        void NotifyTextureRelease(GLuint texture);
+
+        // Returns the number of times a cached FBO has been reused since this cache has been created.
+        inline std::uint64_t GetNumHits() const
+        {
+            return numHits_;
+        }
+
+        // Returns the number of FBOs that were created since this cache has been created.
+        inline std::uint64_t GetNumMisses() const
+        {
+            return numMisses_;
+        }
+
+    private:
+
+        struct Entry
+        {
+            GLFramebufferAttachment attachment;
+            GLuint                  framebuffer;
+            std::uint64_t           lastUse;
+        };
+
+    private:
+
+        GLuint CreateFramebuffer(GLStateManager& stateMngr, GLFramebufferTarget target, const GLFramebufferAttachment& attachment);
+
+        void DeleteFramebuffer(GLStateManager& stateMngr, GLuint framebuffer);
+        void DeleteFramebuffersOfReleasedTextures(GLStateManager& stateMngr);
+
+    private:
+
+        std::size_t         capacity_               = 0;
+        std::vector<Entry>  entries_;
+        std::uint64_t       useCounter_             = 0;
+        std::uint64_t       numHits_                = 0;
+        std::uint64_t       numMisses_              = 0;
+
+        std::mutex          releasedTexturesMutex_;
+        std::vector<GLuint> releasedTextures_;      // Textures that have been released since the last call to BindFramebuffer
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
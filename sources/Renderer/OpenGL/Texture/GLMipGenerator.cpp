@@ -0,0 +1,374 @@
+/*
+ * GLMipGenerator.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLMipGenerator.h"
+#include "GLTexture.h"
+#include "../RenderState/GLStateManager.h"
+#include "../../GLCommon/GLTypes.h"
+#include "../Ext/GLExtensions.h"
+#include "../../GLCommon/GLExtensionRegistry.h"
+#include <LLGL/Log.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+// Maximum number of MIP levels that are generated by a single dispatch (64x64 tile down to 1x1).
+static const GLuint g_maxMipLevelsPerDispatch   = 6;
+
+// Size of the source tile of each work group.
+static const GLuint g_tileSize                  = 64;
+
+/*
+Compute shader for MIP-map generation. Each work group of 16x16 threads loads a 64x64 tile of the source level,
+writes the 2x2 box-filtered result into the first destination level and into shared memory,
+and then reduces the tile in shared memory for each following destination level.
+FORMAT and SRGB are defined by the host for each texture format.
+*/
+static const char* g_mipGenComputeShaderSource = R"(
+layout(local_size_x = 16, local_size_y = 16) in;
+
+layout(FORMAT, binding = 0) uniform readonly  image2DArray srcLevel;
+layout(FORMAT, binding = 1) uniform writeonly image2DArray dstLevel1;
+layout(FORMAT, binding = 2) uniform writeonly image2DArray dstLevel2;
+layout(FORMAT, binding = 3) uniform writeonly image2DArray dstLevel3;
+layout(FORMAT, binding = 4) uniform writeonly image2DArray dstLevel4;
+layout(FORMAT, binding = 5) uniform writeonly image2DArray dstLevel5;
+layout(FORMAT, binding = 6) uniform writeonly image2DArray dstLevel6;
+
+layout(location = 0) uniform int numLevels;
+
+shared vec4 tile[32][32];
+
+vec4 DecodeColor(vec4 c)
+{
+    #if SRGB
+    bvec3 lo = lessThanEqual(c.rgb, vec3(0.04045));
+    c.rgb = mix(pow((c.rgb + vec3(0.055)) / vec3(1.055), vec3(2.4)), c.rgb / vec3(12.92), lo);
+    #endif
+    return c;
+}
+
+vec4 EncodeColor(vec4 c)
+{
+    #if SRGB
+    c.rgb = clamp(c.rgb, vec3(0.0), vec3(1.0));
+    bvec3 lo = lessThanEqual(c.rgb, vec3(0.0031308));
+    c.rgb = mix(vec3(1.055) * pow(c.rgb, vec3(1.0 / 2.4)) - vec3(0.055), c.rgb * vec3(12.92), lo);
+    #endif
+    return c;
+}
+
+vec4 LoadSrc(ivec2 pos, int layer)
+{
+    pos = min(pos, imageSize(srcLevel).xy - ivec2(1));
+    return DecodeColor(imageLoad(srcLevel, ivec3(pos, layer)));
+}
+
+void StoreDst(int level, ivec2 pos, int layer, vec4 color)
+{
+    ivec3 p = ivec3(pos, layer);
+    color = EncodeColor(color);
+    switch (level)
+    {
+        case 1: if (all(lessThan(pos, imageSize(dstLevel1).xy))) { imageStore(dstLevel1, p, color); } break;
+        case 2: if (all(lessThan(pos, imageSize(dstLevel2).xy))) { imageStore(dstLevel2, p, color); } break;
+        case 3: if (all(lessThan(pos, imageSize(dstLevel3).xy))) { imageStore(dstLevel3, p, color); } break;
+        case 4: if (all(lessThan(pos, imageSize(dstLevel4).xy))) { imageStore(dstLevel4, p, color); } break;
+        case 5: if (all(lessThan(pos, imageSize(dstLevel5).xy))) { imageStore(dstLevel5, p, color); } break;
+        case 6: if (all(lessThan(pos, imageSize(dstLevel6).xy))) { imageStore(dstLevel6, p, color); } break;
+    }
+}
+
+void main()
+{
+    ivec2 tid   = ivec2(gl_LocalInvocationID.xy);
+    ivec2 group = ivec2(gl_WorkGroupID.xy);
+    int   layer = int(gl_WorkGroupID.z);
+
+    /* Reduce 4x4 source texels into 2x2 texels of the first destination level */
+    for (int y = 0; y < 2; ++y)
+    {
+        for (int x = 0; x < 2; ++x)
+        {
+            ivec2 dst = tid * 2 + ivec2(x, y);
+            ivec2 src = group * 64 + dst * 2;
+            vec4 color = 0.25 * (
+                LoadSrc(src,               layer) +
+                LoadSrc(src + ivec2(1, 0), layer) +
+                LoadSrc(src + ivec2(0, 1), layer) +
+                LoadSrc(src + ivec2(1, 1), layer)
+            );
+            tile[dst.y][dst.x] = color;
+            StoreDst(1, group * 32 + dst, layer, color);
+        }
+    }
+
+    /* Reduce tile in shared memory for the remaining destination levels */
+    for (int level = 2, size = 16; level <= numLevels; ++level, size /= 2)
+    {
+        barrier();
+
+        bool active = all(lessThan(tid, ivec2(size)));
+        vec4 color = vec4(0.0);
+
+        if (active)
+        {
+            ivec2 src = tid * 2;
+            color = 0.25 * (
+                tile[src.y    ][src.x    ] +
+                tile[src.y    ][src.x + 1] +
+                tile[src.y + 1][src.x    ] +
+                tile[src.y + 1][src.x + 1]
+            );
+        }
+
+        barrier();
+
+        if (active)
+        {
+            tile[tid.y][tid.x] = color;
+            StoreDst(level, group * size + tid, layer, color);
+        }
+    }
+}
+)";
+
+GLMipGenerator::~GLMipGenerator()
+{
+    for (const auto& it : programs_)
+        glDeleteProgram(it.second);
+}
+
+bool GLMipGenerator::IsSupported()
+{
+    #if defined GL_ARB_compute_shader && defined GL_ARB_shader_image_load_store && defined GL_ARB_texture_view
+    return
+    (
+        HasExtension(GLExt::ARB_compute_shader)             &&
+        HasExtension(GLExt::ARB_shader_image_load_store)    &&
+        HasExtension(GLExt::ARB_texture_view)               &&
+        HasExtension(GLExt::ARB_texture_storage)
+    );
+    #else
+    return false;
+    #endif
+}
+
+#if defined GL_ARB_compute_shader && defined GL_ARB_shader_image_load_store && defined GL_ARB_texture_view
+
+bool GLMipGenerator::GenerateMips(const GLTexture& texture, GLuint baseMipLevel, GLuint numMipLevels, GLuint baseArrayLayer, GLuint numArrayLayers)
+{
+    /* Only textures that can be viewed as 2D array texture are supported */
+    switch (texture.GetType())
+    {
+        case TextureType::Texture2D:
+        case TextureType::Texture2DArray:
+        case TextureType::TextureCube:
+        case TextureType::TextureCubeArray:
+            break;
+        default:
+            return false;
+    }
+
+    if (numMipLevels < 2 || numArrayLayers == 0)
+        return true;
+
+    /* Find image format for texture */
+    const auto internalFormat = texture.QueryGLInternalFormat();
+
+    ImageFormat imageFormat;
+    if (!FindImageFormat(internalFormat, imageFormat))
+        return false;
+
+    auto program = GetOrCreateProgram(internalFormat, imageFormat);
+    if (!program)
+        return false;
+
+    /* Texture views can only be created for textures with immutable storage */
+    const auto texTarget = GLStateManager::GetTextureTarget(texture.GetType());
+    GLint immutableFormat = GL_FALSE;
+
+    GLStateManager::active->PushBoundTexture(texTarget);
+    {
+        GLStateManager::active->BindTexture(texTarget, texture.GetID());
+        glGetTexParameteriv(GLTypes::Map(texture.GetType()), GL_TEXTURE_IMMUTABLE_FORMAT, &immutableFormat);
+    }
+    GLStateManager::active->PopBoundTexture();
+
+    if (immutableFormat == GL_FALSE)
+        return false;
+
+    /* Create texture view of the MIP level range as 2D array texture; the view clamps the range to the texture storage */
+    GLuint texViewID = 0;
+    glGenTextures(1, &texViewID);
+    glTextureView(texViewID, GL_TEXTURE_2D_ARRAY, texture.GetID(), imageFormat.viewFormat, baseMipLevel, numMipLevels, baseArrayLayer, numArrayLayers);
+
+    /* Query effective range and extent of the texture view */
+    GLint viewNumLevels = 0, viewNumLayers = 0, width = 0, height = 0;
+
+    GLStateManager::active->PushBoundTexture(GLTextureTarget::TEXTURE_2D_ARRAY);
+    {
+        GLStateManager::active->BindTexture(GLTextureTarget::TEXTURE_2D_ARRAY, texViewID);
+        glGetTexParameteriv(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_VIEW_NUM_LEVELS, &viewNumLevels);
+        glGetTexParameteriv(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_VIEW_NUM_LAYERS, &viewNumLayers);
+        glGetTexLevelParameteriv(GL_TEXTURE_2D_ARRAY, 0, GL_TEXTURE_WIDTH, &width);
+        glGetTexLevelParameteriv(GL_TEXTURE_2D_ARRAY, 0, GL_TEXTURE_HEIGHT, &height);
+    }
+    GLStateManager::active->PopBoundTexture();
+
+    /* Generate MIP levels in batches, each batch reads the last level of the previous batch */
+    GLStateManager::active->PushShaderProgram();
+    {
+        GLStateManager::active->BindShaderProgram(program);
+
+        for (GLint srcLevel = 0; srcLevel + 1 < viewNumLevels;)
+        {
+            const auto numLevels = std::min(static_cast<GLint>(g_maxMipLevelsPerDispatch), viewNumLevels - 1 - srcLevel);
+
+            glBindImageTexture(0, texViewID, srcLevel, GL_TRUE, 0, GL_READ_ONLY, imageFormat.viewFormat);
+            for (GLint i = 1; i <= numLevels; ++i)
+                glBindImageTexture(static_cast<GLuint>(i), texViewID, srcLevel + i, GL_TRUE, 0, GL_WRITE_ONLY, imageFormat.viewFormat);
+
+            glUniform1i(0, numLevels);
+
+            glDispatchCompute(
+                (static_cast<GLuint>(width ) + g_tileSize - 1) / g_tileSize,
+                (static_cast<GLuint>(height) + g_tileSize - 1) / g_tileSize,
+                static_cast<GLuint>(viewNumLayers)
+            );
+
+            /* Make written levels visible to the next batch and to all subsequent texture accesses */
+            glMemoryBarrier(
+                GL_SHADER_IMAGE_ACCESS_BARRIER_BIT  |
+                GL_TEXTURE_FETCH_BARRIER_BIT        |
+                GL_TEXTURE_UPDATE_BARRIER_BIT       |
+                GL_FRAMEBUFFER_BARRIER_BIT
+            );
+
+            srcLevel    += numLevels;
+            width       = std::max(1, width  >> numLevels);
+            height      = std::max(1, height >> numLevels);
+        }
+    }
+    GLStateManager::active->PopShaderProgram();
+
+    /* Release temporary texture view; this also unbinds it from all image units */
+    glDeleteTextures(1, &texViewID);
+
+    return true;
+}
+
+#else
+
+bool GLMipGenerator::GenerateMips(const GLTexture& /*texture*/, GLuint /*baseMipLevel*/, GLuint /*numMipLevels*/, GLuint /*baseArrayLayer*/, GLuint /*numArrayLayers*/)
+{
+    return false;
+}
+
+#endif // /GL_ARB_compute_shader && GL_ARB_shader_image_load_store && GL_ARB_texture_view
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool GLMipGenerator::FindImageFormat(GLenum internalFormat, ImageFormat& imageFormat)
+{
+    switch (internalFormat)
+    {
+        case GL_R8:                 imageFormat = { GL_R8,              "r8",               false }; return true;
+        case GL_RG8:                imageFormat = { GL_RG8,             "rg8",              false }; return true;
+        case GL_RGBA8:              imageFormat = { GL_RGBA8,           "rgba8",            false }; return true;
+        case GL_SRGB8_ALPHA8:       imageFormat = { GL_RGBA8,           "rgba8",            true  }; return true;
+        case GL_R16:                imageFormat = { GL_R16,             "r16",              false }; return true;
+        case GL_RG16:               imageFormat = { GL_RG16,            "rg16",             false }; return true;
+        case GL_RGBA16:             imageFormat = { GL_RGBA16,          "rgba16",           false }; return true;
+        case GL_RGB10_A2:           imageFormat = { GL_RGB10_A2,        "rgb10_a2",         false }; return true;
+        case GL_R16F:               imageFormat = { GL_R16F,            "r16f",             false }; return true;
+        case GL_RG16F:              imageFormat = { GL_RG16F,           "rg16f",            false }; return true;
+        case GL_RGBA16F:            imageFormat = { GL_RGBA16F,         "rgba16f",          false }; return true;
+        case GL_R32F:               imageFormat = { GL_R32F,            "r32f",             false }; return true;
+        case GL_RG32F:              imageFormat = { GL_RG32F,           "rg32f",            false }; return true;
+        case GL_RGBA32F:            imageFormat = { GL_RGBA32F,         "rgba32f",          false }; return true;
+        case GL_R11F_G11F_B10F:     imageFormat = { GL_R11F_G11F_B10F,  "r11f_g11f_b10f",   false }; return true;
+        default:                    return false;
+    }
+}
+
+GLuint GLMipGenerator::GetOrCreateProgram(GLenum internalFormat, const ImageFormat& imageFormat)
+{
+    /* Return program that has already been created for this format; a null program is stored if compilation failed */
+    auto it = programs_.find(internalFormat);
+    if (it != programs_.end())
+        return it->second;
+
+    GLuint program = 0;
+
+    #ifdef GL_ARB_compute_shader
+
+    /* Compile compute shader with format specific definitions */
+    const std::string header =
+    (
+        std::string("#version 430\n") +
+        "#define FORMAT " + imageFormat.layoutQualifier + "\n" +
+        "#define SRGB " + (imageFormat.sRGB ? "1" : "0") + "\n"
+    );
+
+    const GLchar* sources[] = { header.c_str(), g_mipGenComputeShaderSource };
+
+    auto shader = glCreateShader(GL_COMPUTE_SHADER);
+    glShaderSource(shader, 2, sources, nullptr);
+    glCompileShader(shader);
+
+    GLint status = GL_FALSE;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &status);
+
+    if (status != GL_FALSE)
+    {
+        /* Link compute program */
+        program = glCreateProgram();
+        glAttachShader(program, shader);
+        glLinkProgram(program);
+        glDetachShader(program, shader);
+
+        glGetProgramiv(program, GL_LINK_STATUS, &status);
+        if (status == GL_FALSE)
+        {
+            glDeleteProgram(program);
+            program = 0;
+        }
+    }
+
+    glDeleteShader(shader);
+
+    if (!program)
+    {
+        Log::PostReport(
+            Log::ReportType::Error,
+            "failed to build compute shader for MIP-map generation; falling back to default MIP-map generation",
+            imageFormat.layoutQualifier
+        );
+    }
+
+    #endif // /GL_ARB_compute_shader
+
+    programs_[internalFormat] = program;
+
+    return program;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
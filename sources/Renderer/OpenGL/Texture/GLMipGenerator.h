@@ -0,0 +1,79 @@
+/*
+ * GLMipGenerator.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_MIP_GENERATOR_H
+#define LLGL_GL_MIP_GENERATOR_H
+
+
+#include "../OpenGL.h"
+#include <map>
+
+
+namespace LLGL
+{
+
+
+class GLTexture;
+
+/*
+Generates MIP-maps of 2D, 2D array, cube, and cube array textures with a compute shader.
+Each dispatch downsamples a 64x64 tile of the source level per work group and produces up to 6 MIP levels at once by reducing the tile in shared memory,
+so a texture with 12 MIP levels only requires 2 dispatches, and all array layers and cube faces are processed by the same dispatch.
+The texture is accessed through a temporary texture view with target GL_TEXTURE_2D_ARRAY, which requires immutable texture storage.
+sRGB textures are viewed with their linear format and filtered in linear color space.
+*/
+class GLMipGenerator
+{
+
+    public:
+
+        GLMipGenerator() = default;
+        ~GLMipGenerator();
+
+        GLMipGenerator(const GLMipGenerator&) = delete;
+        GLMipGenerator& operator = (const GLMipGenerator&) = delete;
+
+        // Returns true if the GL context supports compute shaders, image load/store, and texture views.
+        static bool IsSupported();
+
+        /*
+        Generates the specified MIP levels of the texture from its base MIP level. Array layers include all cube faces (i.e. 6 per cube).
+        The range is clamped to the texture storage. Returns false if the texture type or format is not supported, in which case nothing has been generated.
+        */
+        bool GenerateMips(const GLTexture& texture, GLuint baseMipLevel, GLuint numMipLevels, GLuint baseArrayLayer, GLuint numArrayLayers);
+
+    private:
+
+        // Image format for the texture view and the shader of a texture format.
+        struct ImageFormat
+        {
+            GLenum      viewFormat;
+            const char* layoutQualifier;
+            bool        sRGB;
+        };
+
+    private:
+
+        static bool FindImageFormat(GLenum internalFormat, ImageFormat& imageFormat);
+
+        GLuint GetOrCreateProgram(GLenum internalFormat, const ImageFormat& imageFormat);
+
+    private:
+
+        std::map<GLenum, GLuint> programs_; // Compute programs per internal texture format
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
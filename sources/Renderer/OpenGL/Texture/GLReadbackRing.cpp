@@ -0,0 +1,161 @@
+/*
+ * GLReadbackRing.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLReadbackRing.h"
+#include "GLTexture.h"
+#include "../RenderState/GLStateManager.h"
+#include "../Ext/GLExtensions.h"
+#include "../../GLCommon/GLTypes.h"
+#include "../../GLCommon/GLExtensionRegistry.h"
+
+
+namespace LLGL
+{
+
+
+GLReadbackRing::~GLReadbackRing()
+{
+    for (const auto& slot : slots_)
+    {
+        glDeleteBuffers(1, &(slot->pbo));
+        GLStateManager::active->NotifyBufferRelease(slot->pbo, GLBufferTarget::PIXEL_PACK_BUFFER);
+    }
+}
+
+std::uint64_t GLReadbackRing::ReadTexture(const GLTexture& texture, GLint mipLevel, GLenum format, GLenum type, GLsizeiptr dataSize)
+{
+    auto& slot = AllocSlot(dataSize);
+
+    /* Copy texture image into PBO (the data pointer is interpreted as offset into the pixel pack buffer) */
+    GLStateManager::active->BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, slot.pbo);
+
+    #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
+    if (HasExtension(GLExt::ARB_direct_state_access))
+    {
+        glGetTextureImage(texture.GetID(), mipLevel, format, type, static_cast<GLsizei>(dataSize), nullptr);
+    }
+    else
+    #endif
+    {
+        GLStateManager::active->BindGLTexture(texture);
+        glGetTexImage(GLTypes::Map(texture.GetType()), mipLevel, format, type, nullptr);
+    }
+
+    GLStateManager::active->BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, 0);
+
+    /* Submit fence to determine when the copy has been completed */
+    slot.fence.Submit();
+    slot.ticket     = nextTicket_++;
+    slot.size       = dataSize;
+    slot.signaled   = false;
+
+    return slot.ticket;
+}
+
+bool GLReadbackRing::Query(std::uint64_t ticket, bool wait)
+{
+    if (auto slot = FindSlot(ticket))
+    {
+        if (!slot->signaled)
+            slot->signaled = slot->fence.Wait(wait ? ~0ull : 0);
+        return slot->signaled;
+    }
+    return false;
+}
+
+const void* GLReadbackRing::Map(std::uint64_t ticket, std::size_t& dataSize)
+{
+    if (auto slot = FindSlot(ticket))
+    {
+        if (slot->mappedData == nullptr)
+        {
+            /* Wait for readback, then map PBO for read access */
+            Query(ticket, true);
+            GLStateManager::active->BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, slot->pbo);
+            slot->mappedData = glMapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY);
+            GLStateManager::active->BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, 0);
+        }
+        dataSize = static_cast<std::size_t>(slot->size);
+        return slot->mappedData;
+    }
+    return nullptr;
+}
+
+void GLReadbackRing::Release(std::uint64_t ticket)
+{
+    if (auto slot = FindSlot(ticket))
+    {
+        if (slot->mappedData != nullptr)
+        {
+            GLStateManager::active->BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, slot->pbo);
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+            GLStateManager::active->BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, 0);
+            slot->mappedData = nullptr;
+        }
+        slot->ticket = 0;
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+GLReadbackRing::Slot* GLReadbackRing::FindSlot(std::uint64_t ticket)
+{
+    if (ticket != 0)
+    {
+        for (const auto& slot : slots_)
+        {
+            if (slot->ticket == ticket)
+                return slot.get();
+        }
+    }
+    return nullptr;
+}
+
+GLReadbackRing::Slot& GLReadbackRing::AllocSlot(GLsizeiptr size)
+{
+    /* Find next released slot in ring order */
+    Slot* slot = nullptr;
+
+    for (std::size_t i = 0, n = slots_.size(); i < n; ++i)
+    {
+        auto index = (nextSlot_ + i) % n;
+        if (slots_[index]->ticket == 0)
+        {
+            slot = slots_[index].get();
+            nextSlot_ = (index + 1) % n;
+            break;
+        }
+    }
+
+    /* Allocate new slot if all PBOs are in use */
+    if (slot == nullptr)
+    {
+        slots_.emplace_back(new Slot{});
+        slot = slots_.back().get();
+        glGenBuffers(1, &(slot->pbo));
+    }
+
+    /* Grow PBO if necessary */
+    if (slot->capacity < size)
+    {
+        GLStateManager::active->BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, slot->pbo);
+        glBufferData(GL_PIXEL_PACK_BUFFER, size, nullptr, GL_STREAM_READ);
+        slot->capacity = size;
+    }
+
+    return *slot;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
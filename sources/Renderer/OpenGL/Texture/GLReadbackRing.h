@@ -0,0 +1,87 @@
+/*
+ * GLReadbackRing.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_READBACK_RING_H
+#define LLGL_GL_READBACK_RING_H
+
+
+#include "../RenderState/GLFence.h"
+#include "../OpenGL.h"
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class GLTexture;
+
+/*
+Ring of pixel pack buffers (PBO) for asynchronous texture readbacks.
+Each readback copies the texture image into a PBO and submits a fence, so the CPU only waits when the result is mapped before the GPU has finished the copy.
+Released PBOs are recycled in ring order to avoid reallocations for readbacks of the same size.
+*/
+class GLReadbackRing
+{
+
+    public:
+
+        GLReadbackRing() = default;
+        ~GLReadbackRing();
+
+        GLReadbackRing(const GLReadbackRing&) = delete;
+        GLReadbackRing& operator = (const GLReadbackRing&) = delete;
+
+        // Copies the specified MIP-map level of the texture into a PBO and returns the ticket for this readback.
+        std::uint64_t ReadTexture(const GLTexture& texture, GLint mipLevel, GLenum format, GLenum type, GLsizeiptr dataSize);
+
+        // Returns true if the readback of the specified ticket has been completed. If 'wait' is true, this function blocks until the readback is complete.
+        bool Query(std::uint64_t ticket, bool wait);
+
+        // Waits for the specified readback and maps its PBO into CPU memory space. Returns null if the ticket is invalid.
+        const void* Map(std::uint64_t ticket, std::size_t& dataSize);
+
+        // Unmaps the PBO of the specified readback and makes it available for the next readback.
+        void Release(std::uint64_t ticket);
+
+    private:
+
+        struct Slot
+        {
+            GLuint          pbo         = 0;
+            GLsizeiptr      capacity    = 0;
+            GLsizeiptr      size        = 0;
+            std::uint64_t   ticket      = 0;
+            GLFence         fence;
+            bool            signaled    = false;
+            const void*     mappedData  = nullptr;
+        };
+
+    private:
+
+        Slot* FindSlot(std::uint64_t ticket);
+        Slot& AllocSlot(GLsizeiptr size);
+
+    private:
+
+        std::vector<std::unique_ptr<Slot>>  slots_;
+        std::size_t                         nextSlot_   = 0;
+        std::uint64_t                       nextTicket_ = 1;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -6,8 +6,11 @@
  */
 
 #include "GLTexture.h"
+#include "../Command/GLRenderThread.h"
 #include "../RenderState/GLStateManager.h"
+#include "../Platform/GLContext.h"
 #include "../../GLCommon/GLTypes.h"
+#include "../../GLCommon/Texture/GLTexImage.h"
 #include "../../GLCommon/GLExtensionRegistry.h"
 #include "../Ext/GLExtensions.h"
 
@@ -37,6 +40,30 @@ GLTexture::~GLTexture()
 {
     glDeleteTextures(1, &id_);
     GLStateManager::active->NotifyTextureRelease(id_, GLStateManager::GetTextureTarget(GetType()));
+    GLContext::NotifyTextureRelease(id_);
+}
+
+static GLint GetGlTextureMinFilter(const TextureDescriptor& textureDesc)
+{
+    if (IsMipMappedTexture(textureDesc))
+        return GL_LINEAR_MIPMAP_LINEAR;
+    else
+        return GL_LINEAR;
+}
+
+void GLTexture::BuildStorage(GLStateManager& stateMngr, const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc)
+{
+    /* Bind texture */
+    stateMngr.BindGLTexture(*this);
+
+    /* Initialize texture parameters for the first time */
+    auto target = GLTypes::Map(textureDesc.type);
+
+    glTexParameteri(target, GL_TEXTURE_MIN_FILTER, GetGlTextureMinFilter(textureDesc));
+    glTexParameteri(target, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+    /* Build texture storage and upload image data */
+    GLTexImage(GetID(), textureDesc, imageDesc);
 }
 
 static GLenum GLGetTextureParamTarget(const TextureType type)
@@ -58,6 +85,8 @@ static GLenum GLGetTextureParamTarget(const TextureType type)
 
 Extent3D GLTexture::QueryMipExtent(std::uint32_t mipLevel) const
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(QueryMipExtent(mipLevel));
+
     GLint texSize[3] = { 0 };
     GLint level = static_cast<GLint>(mipLevel);
 
@@ -99,6 +128,8 @@ Extent3D GLTexture::QueryMipExtent(std::uint32_t mipLevel) const
 
 TextureDescriptor GLTexture::QueryDesc() const
 {
+    LLGL_GL_FORWARD_TO_RENDER_THREAD(QueryDesc());
+
     TextureDescriptor texDesc;
 
     texDesc.type            = GetType();
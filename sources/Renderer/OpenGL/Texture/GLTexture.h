@@ -10,6 +10,7 @@
 
 
 #include <LLGL/Texture.h>
+#include <LLGL/ImageFlags.h>
 #include "../OpenGL.h"
 
 
@@ -17,6 +18,8 @@ namespace LLGL
 {
 
 
+class GLStateManager;
+
 class GLTexture final : public Texture
 {
 
@@ -32,6 +35,12 @@ class GLTexture final : public Texture
         // Queries the GL_TEXTURE_INTERNAL_FORMAT parameter of this texture.
         GLenum QueryGLInternalFormat() const;
 
+        /*
+        Binds this texture, initializes its default filter parameters, and builds its storage with the optional initial image data.
+        This is used for the texture creation on both the render context and the loader context (see GLTextureLoader).
+        */
+        void BuildStorage(GLStateManager& stateMngr, const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc);
+
         // Returns the hardware texture ID.
         inline GLuint GetID() const
         {
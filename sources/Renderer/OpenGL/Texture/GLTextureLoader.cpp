@@ -0,0 +1,182 @@
+/*
+ * GLTextureLoader.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLTextureLoader.h"
+#include "GLTexture.h"
+#include "../Ext/GLExtensions.h"
+#include <LLGL/Log.h>
+#include <algorithm>
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+GLTextureLoader::GLTextureLoader(std::unique_ptr<GLContext>&& loaderContext) :
+    context_ { std::move(loaderContext) }
+{
+    thread_ = std::thread(&GLTextureLoader::Run, this);
+}
+
+GLTextureLoader::~GLTextureLoader()
+{
+    {
+        std::lock_guard<std::mutex> guard { mutex_ };
+
+        /* Cancel all uploads that have not been started yet */
+        jobs_.remove_if([](const Job& job) { return (job.state == JobState::Pending); });
+        quit_ = true;
+    }
+    wakeSignal_.notify_one();
+    thread_.join();
+
+    /* Release fences of completed uploads */
+    for (const auto& job : jobs_)
+        glDeleteSync(job.sync);
+}
+
+void GLTextureLoader::Upload(GLTexture& texture, const TextureDescriptor& textureDesc, const SrcImageDescriptor& imageDesc)
+{
+    /* Copy image data, since the upload happens after this function has returned */
+    auto extent = textureDesc.extent;
+    const auto dataSize = static_cast<std::size_t>(
+        ImageDataSize(imageDesc.format, imageDesc.dataType, extent.width * extent.height * extent.depth * textureDesc.arrayLayers)
+    );
+
+    Job job;
+    {
+        job.texture             = (&texture);
+        job.textureDesc         = textureDesc;
+        job.imageData           = ByteBuffer{ new char[dataSize] };
+        job.imageDesc           = imageDesc;
+        job.imageDesc.data      = job.imageData.get();
+        job.imageDesc.dataSize  = dataSize;
+        ::memcpy(job.imageData.get(), imageDesc.data, dataSize);
+    }
+
+    /* Enqueue upload and wake up loader thread */
+    {
+        std::lock_guard<std::mutex> guard { mutex_ };
+        jobs_.push_back(std::move(job));
+    }
+    wakeSignal_.notify_one();
+}
+
+bool GLTextureLoader::IsResident(const GLTexture& texture)
+{
+    std::lock_guard<std::mutex> guard { mutex_ };
+
+    auto it = FindJob(texture);
+    if (it == jobs_.end())
+        return true;
+
+    if (it->state == JobState::Uploaded)
+    {
+        /* Synchronize calling GL context with the completed upload */
+        glWaitSync(it->sync, 0, GL_TIMEOUT_IGNORED);
+        glDeleteSync(it->sync);
+        jobs_.erase(it);
+        return true;
+    }
+
+    return false;
+}
+
+void GLTextureLoader::Remove(const GLTexture& texture)
+{
+    std::unique_lock<std::mutex> lock { mutex_ };
+
+    auto it = FindJob(texture);
+    if (it != jobs_.end())
+    {
+        /* Wait until the loader thread has finished with the texture */
+        doneSignal_.wait(lock, [it]() { return (it->state != JobState::Uploading); });
+        glDeleteSync(it->sync);
+        jobs_.erase(it);
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void GLTextureLoader::Run()
+{
+    GLContext::MakeCurrent(context_.get());
+
+    /* Query the limits for the state manager of the loader context, which is not shared with the render context */
+    GLStateManager::active->DetermineExtensionsAndLimits();
+
+    std::unique_lock<std::mutex> lock { mutex_ };
+
+    while (true)
+    {
+        /* Find next pending upload */
+        auto it = std::find_if(
+            jobs_.begin(), jobs_.end(),
+            [](const Job& job) { return (job.state == JobState::Pending); }
+        );
+
+        if (it == jobs_.end())
+        {
+            if (quit_)
+                break;
+            wakeSignal_.wait(lock);
+            continue;
+        }
+
+        /* Upload texture without holding the lock (list iterators remain valid) */
+        it->state = JobState::Uploading;
+        lock.unlock();
+        {
+            UploadTexture(*it);
+        }
+        lock.lock();
+
+        it->state = JobState::Uploaded;
+        it->imageData.reset();
+        doneSignal_.notify_all();
+    }
+
+    lock.unlock();
+
+    GLContext::MakeCurrent(nullptr);
+}
+
+void GLTextureLoader::UploadTexture(Job& job)
+{
+    try
+    {
+        /* Build texture storage and upload image data the same way as on the render context */
+        job.texture->BuildStorage(*GLStateManager::active, job.textureDesc, &(job.imageDesc));
+    }
+    catch (const std::exception& e)
+    {
+        Log::PostReport(Log::ReportType::Error, std::string("asynchronous texture upload failed: ") + e.what());
+    }
+
+    /* Submit fence for the render context and flush it, so the fence will be signaled eventually */
+    job.sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    glFlush();
+}
+
+std::list<GLTextureLoader::Job>::iterator GLTextureLoader::FindJob(const GLTexture& texture)
+{
+    return std::find_if(
+        jobs_.begin(), jobs_.end(),
+        [&texture](const Job& job) { return (job.texture == &texture); }
+    );
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,104 @@
+/*
+ * GLTextureLoader.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_TEXTURE_LOADER_H
+#define LLGL_GL_TEXTURE_LOADER_H
+
+
+#include <LLGL/TextureFlags.h>
+#include <LLGL/ImageFlags.h>
+#include "../Platform/GLContext.h"
+#include "../OpenGL.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <list>
+#include <memory>
+
+
+namespace LLGL
+{
+
+
+class GLTexture;
+
+/*
+Worker thread with its own GL context (sharing all GL objects with the render context) for asynchronous texture uploads.
+Each upload submits a fence on the loader context; the texture becomes resident once the render context has waited on that fence.
+*/
+class GLTextureLoader
+{
+
+    public:
+
+        GLTextureLoader(const GLTextureLoader&) = delete;
+        GLTextureLoader& operator = (const GLTextureLoader&) = delete;
+
+        // Starts the loader thread and makes the specified loader context current on it.
+        GLTextureLoader(std::unique_ptr<GLContext>&& loaderContext);
+
+        // Cancels all pending uploads and stops the loader thread.
+        ~GLTextureLoader();
+
+        // Enqueues the texture storage allocation and upload of the specified image data. The image data is copied.
+        void Upload(GLTexture& texture, const TextureDescriptor& textureDesc, const SrcImageDescriptor& imageDesc);
+
+        // Returns true if the specified texture has no pending upload. Completed uploads are synchronized with the calling GL context.
+        bool IsResident(const GLTexture& texture);
+
+        // Removes the specified texture from the loader. Blocks if the texture is currently being uploaded.
+        void Remove(const GLTexture& texture);
+
+    private:
+
+        enum class JobState
+        {
+            Pending,
+            Uploading,
+            Uploaded,
+        };
+
+        struct Job
+        {
+            GLTexture*              texture     = nullptr;
+            TextureDescriptor       textureDesc;
+            SrcImageDescriptor      imageDesc;
+            ByteBuffer              imageData;
+            GLsync                  sync        = 0;
+            JobState                state       = JobState::Pending;
+        };
+
+    private:
+
+        void Run();
+        void UploadTexture(Job& job);
+
+        std::list<Job>::iterator FindJob(const GLTexture& texture);
+
+    private:
+
+        std::unique_ptr<GLContext>  context_;
+
+        std::list<Job>              jobs_;
+
+        std::thread                 thread_;
+        std::mutex                  mutex_;
+        std::condition_variable     wakeSignal_;
+        std::condition_variable     doneSignal_;
+        bool                        quit_           = false;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,57 @@
+/*
+ * QueryHeapRing.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/QueryHeapRing.h>
+#include <LLGL/RenderSystem.h>
+#include <LLGL/CommandQueue.h>
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+QueryHeapRing::QueryHeapRing(RenderSystem& renderSystem, const QueryHeapDescriptor& desc, std::uint32_t numFrames) :
+    renderSystem_ { renderSystem }
+{
+    /* Create one query heap for each frame */
+    queryHeaps_.resize(std::max(1u, numFrames), nullptr);
+    for (auto& queryHeap : queryHeaps_)
+        queryHeap = renderSystem_.CreateQueryHeap(desc);
+}
+
+QueryHeapRing::~QueryHeapRing()
+{
+    for (auto queryHeap : queryHeaps_)
+        renderSystem_.Release(*queryHeap);
+}
+
+QueryHeap& QueryHeapRing::NextFrame()
+{
+    ++frame_;
+    return GetCurrentQueryHeap();
+}
+
+bool QueryHeapRing::QueryResult(CommandQueue& commandQueue, std::uint32_t firstQuery, std::uint32_t numQueries, void* data, std::size_t dataSize)
+{
+    /* Results are only available once the current query heap has been recorded in a previous frame */
+    if (frame_ <= queryHeaps_.size())
+        return false;
+    return commandQueue.QueryResult(GetCurrentQueryHeap(), firstQuery, numQueries, data, dataSize);
+}
+
+QueryHeap& QueryHeapRing::GetCurrentQueryHeap() const
+{
+    return *queryHeaps_[GetFrame() % queryHeaps_.size()];
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -50,6 +50,18 @@ bool RenderContext::HasStencilAttachment() const
     return IsStencilFormat(QueryDepthStencilFormat());
 }
 
+/* ----- Back Buffer ----- */
+
+std::uint32_t RenderContext::GetCurrentFrame() const
+{
+    return 0;
+}
+
+bool RenderContext::QueryResourceBindingStatistics(ResourceBindingStatistics& /*stats*/) const
+{
+    return false;
+}
+
 /* ----- Configuration ----- */
 
 static bool IsVideoModeValid(const VideoModeDescriptor& videoModeDesc)
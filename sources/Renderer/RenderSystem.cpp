@@ -15,6 +15,7 @@
 #include <LLGL/RenderSystem.h>
 #include <array>
 #include <map>
+#include <vector>
 
 #ifdef LLGL_ENABLE_DEBUG_LAYER
 #   include "DebugLayer/DbgRenderSystem.h"
@@ -33,6 +34,15 @@ namespace LLGL
 
 static std::map<RenderSystem*, std::unique_ptr<Module>> g_renderSystemModules;
 
+// Completed texture readbacks of the default implementation, stored per render system.
+struct DefaultReadbackContainer
+{
+    std::uint64_t                                   nextTicket  = 1;
+    std::map<std::uint64_t, std::vector<char>>      readbacks;
+};
+
+static std::map<RenderSystem*, DefaultReadbackContainer> g_defaultReadbacks;
+
 std::vector<std::string> RenderSystem::FindModules()
 {
     /* Iterate over all known modules and return those that are available on the current platform */
@@ -208,6 +218,8 @@ std::unique_ptr<RenderSystem> RenderSystem::Load(
 
 void RenderSystem::Unload(std::unique_ptr<RenderSystem>&& renderSystem)
 {
+    g_defaultReadbacks.erase(renderSystem.get());
+
     auto it = g_renderSystemModules.find(renderSystem.get());
     if (it != g_renderSystemModules.end())
     {
@@ -221,6 +233,97 @@ void RenderSystem::SetConfiguration(const RenderSystemConfiguration& config)
     config_ = config;
 }
 
+static CPUAccess MapBufferFlagsToCPUAccess(long flags)
+{
+    if ((flags & MapBufferFlags::Read) != 0)
+        return ((flags & MapBufferFlags::Write) != 0 ? CPUAccess::ReadWrite : CPUAccess::ReadOnly);
+    else
+        return ((flags & MapBufferFlags::InvalidateBuffer) != 0 ? CPUAccess::WriteDiscard : CPUAccess::WriteOnly);
+}
+
+void* RenderSystem::MapBufferRange(Buffer& buffer, std::uint64_t offset, std::uint64_t /*size*/, long flags)
+{
+    /* Map entire buffer and return pointer to the beginning of the range */
+    if (auto data = MapBuffer(buffer, MapBufferFlagsToCPUAccess(flags)))
+        return (reinterpret_cast<std::int8_t*>(data) + offset);
+    else
+        return nullptr;
+}
+
+void RenderSystem::FlushMappedBufferRange(Buffer& /*buffer*/, std::uint64_t /*offset*/, std::uint64_t /*size*/)
+{
+    // dummy
+}
+
+/* ----- Textures ----- */
+
+bool RenderSystem::IsTextureResident(const Texture& /*texture*/)
+{
+    return true;
+}
+
+std::uint64_t RenderSystem::ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel, ImageFormat format, DataType dataType)
+{
+    /* Read texture synchronously into temporary buffer */
+    const auto extent   = texture.QueryMipExtent(mipLevel);
+    const auto dataSize = ImageDataSize(format, dataType, extent.width * extent.height * extent.depth);
+
+    std::vector<char> imageData(dataSize);
+    ReadTexture(texture, mipLevel, DstImageDescriptor{ format, dataType, imageData.data(), imageData.size() });
+
+    /* Store image data with new ticket */
+    auto& container = g_defaultReadbacks[this];
+    const auto ticket = container.nextTicket++;
+    container.readbacks[ticket] = std::move(imageData);
+
+    return ticket;
+}
+
+bool RenderSystem::QueryReadback(std::uint64_t ticket, bool /*wait*/)
+{
+    /* Default readbacks are always complete */
+    auto it = g_defaultReadbacks.find(this);
+    return (it != g_defaultReadbacks.end() && it->second.readbacks.find(ticket) != it->second.readbacks.end());
+}
+
+const void* RenderSystem::MapReadback(std::uint64_t ticket, std::size_t& dataSize)
+{
+    auto it = g_defaultReadbacks.find(this);
+    if (it != g_defaultReadbacks.end())
+    {
+        auto itReadback = it->second.readbacks.find(ticket);
+        if (itReadback != it->second.readbacks.end())
+        {
+            dataSize = itReadback->second.size();
+            return itReadback->second.data();
+        }
+    }
+    return nullptr;
+}
+
+void RenderSystem::ReleaseReadback(std::uint64_t ticket)
+{
+    /* Only erase the readback; the container keeps its ticket counter until the render system is unloaded */
+    auto it = g_defaultReadbacks.find(this);
+    if (it != g_defaultReadbacks.end())
+        it->second.readbacks.erase(ticket);
+}
+
+/* ----- Pipeline States ----- */
+
+bool RenderSystem::QueryPipelineStateCacheStatistics(PipelineStateCacheStatistics& /*stats*/) const
+{
+    return false;
+}
+
+/* ----- Shaders ----- */
+
+void RenderSystem::CreateShaderPrograms(std::uint32_t numShaderPrograms, const ShaderProgramDescriptor* descs, ShaderProgram** shaderPrograms)
+{
+    for (std::uint32_t i = 0; i < numShaderPrograms; ++i)
+        shaderPrograms[i] = CreateShaderProgram(descs[i]);
+}
+
 
 /*
  * ======= Protected: =======
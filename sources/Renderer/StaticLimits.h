@@ -18,6 +18,9 @@
 // Maximum number of viewports and scissors.
 #define LLGL_MAX_NUM_VIEWPORTS_AND_SCISSORS (16u)
 
+// Maximum number of vertex buffer binding points (minimum value of GL_MAX_VERTEX_ATTRIB_BINDINGS).
+#define LLGL_MAX_NUM_VERTEX_BUFFER_BINDINGS (16u)
+
 
 #endif
 
@@ -76,10 +76,34 @@ void VKBuffer::TakeStagingBuffer(VKDeviceBuffer&& deviceBuffer)
     bufferObjStaging_ = std::move(deviceBuffer);
 }
 
+static long CPUAccessToMapBufferFlags(const CPUAccess access)
+{
+    switch (access)
+    {
+        case CPUAccess::ReadOnly:       return MapBufferFlags::Read;
+        case CPUAccess::WriteOnly:      return MapBufferFlags::Write;
+        case CPUAccess::WriteDiscard:   return (MapBufferFlags::Write | MapBufferFlags::InvalidateBuffer);
+        case CPUAccess::ReadWrite:      return (MapBufferFlags::Read | MapBufferFlags::Write);
+    }
+    return 0;
+}
+
 void* VKBuffer::Map(VkDevice device, const CPUAccess access)
 {
-    mappedCPUAccess_ = access;
-    return bufferObjStaging_.Map(device);
+    return MapRange(device, 0, GetSize(), CPUAccessToMapBufferFlags(access));
+}
+
+void* VKBuffer::MapRange(VkDevice device, VkDeviceSize offset, VkDeviceSize size, long flags)
+{
+    mappedFlags_    = flags;
+    mappedOffset_   = offset;
+    mappedSize_     = size;
+
+    /* Map entire staging buffer and return pointer to the beginning of the range */
+    if (auto data = bufferObjStaging_.Map(device))
+        return (reinterpret_cast<std::int8_t*>(data) + offset);
+    else
+        return nullptr;
 }
 
 void VKBuffer::Unmap(VkDevice device)
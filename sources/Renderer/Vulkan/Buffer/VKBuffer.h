@@ -10,6 +10,7 @@
 
 
 #include <LLGL/Buffer.h>
+#include <LLGL/RenderSystemFlags.h>
 #include "VKDeviceBuffer.h"
 #include "../Memory/VKDeviceMemory.h"
 
@@ -29,6 +30,7 @@ class VKBuffer : public Buffer
         void TakeStagingBuffer(VKDeviceBuffer&& deviceBuffer);
 
         void* Map(VkDevice device, const CPUAccess access);
+        void* MapRange(VkDevice device, VkDeviceSize offset, VkDeviceSize size, long flags);
         void Unmap(VkDevice device);
 
         // Returns the device buffer object.
@@ -61,10 +63,22 @@ class VKBuffer : public Buffer
             return size_;
         }
 
-        // Returns the CPU access previously set when "Map" was called.
-        inline CPUAccess GetMappedCPUAccess() const
+        // Returns the map flags (see MapBufferFlags) previously set when "Map" or "MapRange" was called.
+        inline long GetMappedFlags() const
         {
-            return mappedCPUAccess_;
+            return mappedFlags_;
+        }
+
+        // Returns the offset of the range previously set when "Map" or "MapRange" was called.
+        inline VkDeviceSize GetMappedOffset() const
+        {
+            return mappedOffset_;
+        }
+
+        // Returns the size of the range previously set when "Map" or "MapRange" was called.
+        inline VkDeviceSize GetMappedSize() const
+        {
+            return mappedSize_;
         }
 
         // Returns the VkIndexType specified at creation time.
@@ -79,7 +93,9 @@ class VKBuffer : public Buffer
         VKDeviceBuffer  bufferObjStaging_;
 
         VkDeviceSize    size_               = 0;
-        CPUAccess       mappedCPUAccess_    = CPUAccess::ReadOnly;
+        long            mappedFlags_        = 0;
+        VkDeviceSize    mappedOffset_       = 0;
+        VkDeviceSize    mappedSize_         = 0;
 
         VkIndexType     indexType_          = VK_INDEX_TYPE_UINT32;
 
@@ -0,0 +1,287 @@
+/*
+ * VKReadbackRing.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "VKReadbackRing.h"
+#include "VKTexture.h"
+#include "../VKDevice.h"
+#include "../VKCore.h"
+#include "../VKInitializers.h"
+#include "../Memory/VKDeviceMemoryManager.h"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+VKReadbackRing::Slot::Slot(const VKPtr<VkDevice>& device) :
+    stagingBuffer { device },
+    fence         { device }
+{
+}
+
+VKReadbackRing::VKReadbackRing(VKDevice& device, VKDeviceMemoryManager& deviceMemoryMngr) :
+    device_           { device           },
+    deviceMemoryMngr_ { deviceMemoryMngr }
+{
+}
+
+VKReadbackRing::~VKReadbackRing()
+{
+    for (const auto& slot : slots_)
+    {
+        FreeCommandBuffer(*slot);
+        slot->stagingBuffer.ReleaseMemoryRegion(deviceMemoryMngr_);
+    }
+}
+
+std::uint64_t VKReadbackRing::ReadTexture(const VKTexture& texture, std::uint32_t mipLevel, ImageFormat format, DataType dataType)
+{
+    /* Determine image format of the texture data as it is copied by the GPU */
+    ImageFormat srcFormat   = ImageFormat::RGBA;
+    DataType    srcDataType = DataType::UInt8;
+
+    if (!FindSuitableImageFormat(texture.QueryDesc().format, srcFormat, srcDataType))
+        throw std::runtime_error("cannot read texture asynchronously, because its hardware format has no suitable image format");
+
+    const auto extent       = texture.QueryMipExtent(mipLevel);
+    const auto numPixels    = extent.width * extent.height * extent.depth;
+    const auto srcDataSize  = static_cast<VkDeviceSize>(ImageDataSize(srcFormat, srcDataType, numPixels));
+
+    auto& slot = AllocSlot(srcDataSize);
+
+    /* Record commands to copy the MIP-map level into the staging buffer */
+    const auto& imageExtent = texture.GetVkExtent();
+    const VkExtent3D mipExtent
+    {
+        std::max(1u, imageExtent.width  >> mipLevel),
+        std::max(1u, imageExtent.height >> mipLevel),
+        std::max(1u, imageExtent.depth  >> mipLevel)
+    };
+
+    auto image          = texture.GetVkImage();
+    auto formatVK       = texture.GetVkFormat();
+    auto mipLevels      = texture.GetNumMipLevels();
+    auto arrayLayers    = texture.GetNumArrayLayers();
+
+    slot.commandBuffer = device_.AllocCommandBuffer();
+    {
+        device_.TransitionImageLayout(
+            slot.commandBuffer,
+            image,
+            formatVK,
+            VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+            VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+            mipLevels,
+            arrayLayers
+        );
+
+        device_.CopyImageToBuffer(
+            slot.commandBuffer,
+            image,
+            slot.stagingBuffer.GetVkBuffer(),
+            mipExtent,
+            arrayLayers,
+            mipLevel
+        );
+
+        device_.TransitionImageLayout(
+            slot.commandBuffer,
+            image,
+            formatVK,
+            VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+            VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+            mipLevels,
+            arrayLayers
+        );
+
+        /* Make the copied data visible to the host */
+        VkMemoryBarrier barrier;
+        {
+            barrier.sType           = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+            barrier.pNext           = nullptr;
+            barrier.srcAccessMask   = VK_ACCESS_TRANSFER_WRITE_BIT;
+            barrier.dstAccessMask   = VK_ACCESS_HOST_READ_BIT;
+        }
+        vkCmdPipelineBarrier(slot.commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+    }
+    auto result = vkEndCommandBuffer(slot.commandBuffer);
+    VKThrowIfFailed(result, "failed to end recording Vulkan command buffer");
+
+    /* Submit command buffer without waiting for its completion */
+    slot.fence.Reset(device_);
+
+    VkSubmitInfo submitInfo = {};
+    {
+        submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.commandBufferCount   = 1;
+        submitInfo.pCommandBuffers      = (&slot.commandBuffer);
+    }
+    result = vkQueueSubmit(device_.GetVkQueue(), 1, &submitInfo, slot.fence.GetVkFence());
+    VKThrowIfFailed(result, "failed to submit Vulkan command buffer for texture readback");
+
+    /* Store readback attributes */
+    slot.ticket         = nextTicket_++;
+    slot.size           = srcDataSize;
+    slot.signaled       = false;
+    slot.srcFormat      = srcFormat;
+    slot.srcDataType    = srcDataType;
+    slot.dstFormat      = format;
+    slot.dstDataType    = dataType;
+    slot.numPixels      = numPixels;
+
+    return slot.ticket;
+}
+
+bool VKReadbackRing::Query(std::uint64_t ticket, bool wait)
+{
+    if (auto slot = FindSlot(ticket))
+    {
+        if (!slot->signaled)
+        {
+            slot->signaled = slot->fence.Wait(device_, (wait ? std::numeric_limits<std::uint64_t>::max() : 0));
+            if (slot->signaled)
+                FreeCommandBuffer(*slot);
+        }
+        return slot->signaled;
+    }
+    return false;
+}
+
+const void* VKReadbackRing::Map(std::uint64_t ticket, std::size_t& dataSize)
+{
+    if (auto slot = FindSlot(ticket))
+    {
+        if (!slot->hostData)
+        {
+            /* Wait for readback, then copy staging buffer into CPU memory */
+            Query(ticket, true);
+
+            if (auto data = slot->stagingBuffer.Map(device_))
+            {
+                const auto srcDataSize = static_cast<std::size_t>(slot->size);
+
+                if (slot->srcFormat != slot->dstFormat || slot->srcDataType != slot->dstDataType)
+                {
+                    /* Convert image data into requested format */
+                    slot->hostData = ConvertImageBuffer(
+                        SrcImageDescriptor{ slot->srcFormat, slot->srcDataType, data, srcDataSize },
+                        slot->dstFormat,
+                        slot->dstDataType
+                    );
+                    slot->hostDataSize = ImageDataSize(slot->dstFormat, slot->dstDataType, static_cast<std::uint32_t>(slot->numPixels));
+                }
+                else
+                {
+                    slot->hostData = ByteBuffer{ new char[srcDataSize] };
+                    ::memcpy(slot->hostData.get(), data, srcDataSize);
+                    slot->hostDataSize = srcDataSize;
+                }
+
+                slot->stagingBuffer.Unmap(device_);
+            }
+        }
+        dataSize = slot->hostDataSize;
+        return slot->hostData.get();
+    }
+    return nullptr;
+}
+
+void VKReadbackRing::Release(std::uint64_t ticket)
+{
+    if (auto slot = FindSlot(ticket))
+    {
+        /* Staging buffer must not be reused while the GPU is still writing into it */
+        Query(ticket, true);
+        slot->hostData.reset();
+        slot->hostDataSize  = 0;
+        slot->ticket        = 0;
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+VKReadbackRing::Slot* VKReadbackRing::FindSlot(std::uint64_t ticket)
+{
+    if (ticket != 0)
+    {
+        for (const auto& slot : slots_)
+        {
+            if (slot->ticket == ticket)
+                return slot.get();
+        }
+    }
+    return nullptr;
+}
+
+VKReadbackRing::Slot& VKReadbackRing::AllocSlot(VkDeviceSize size)
+{
+    /* Find next released slot in ring order */
+    Slot* slot = nullptr;
+
+    for (std::size_t i = 0, n = slots_.size(); i < n; ++i)
+    {
+        auto index = (nextSlot_ + i) % n;
+        if (slots_[index]->ticket == 0)
+        {
+            slot = slots_[index].get();
+            nextSlot_ = (index + 1) % n;
+            break;
+        }
+    }
+
+    /* Allocate new slot if all staging buffers are in use */
+    if (slot == nullptr)
+    {
+        slots_.emplace_back(new Slot{ device_.GetVkDevice() });
+        slot = slots_.back().get();
+    }
+
+    /* Grow staging buffer if necessary */
+    if (slot->capacity < size)
+    {
+        slot->stagingBuffer.ReleaseMemoryRegion(deviceMemoryMngr_);
+
+        VkBufferCreateInfo createInfo;
+        BuildVkBufferCreateInfo(createInfo, size, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+
+        slot->stagingBuffer = VKDeviceBuffer
+        {
+            device_.GetVkDevice(),
+            createInfo,
+            deviceMemoryMngr_,
+            (VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)
+        };
+        slot->capacity = size;
+    }
+
+    return *slot;
+}
+
+void VKReadbackRing::FreeCommandBuffer(Slot& slot)
+{
+    if (slot.commandBuffer != VK_NULL_HANDLE)
+    {
+        if (!slot.signaled)
+            slot.fence.Wait(device_, std::numeric_limits<std::uint64_t>::max());
+        vkFreeCommandBuffers(device_, device_.GetVkCommandPool(), 1, &(slot.commandBuffer));
+        slot.commandBuffer = VK_NULL_HANDLE;
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
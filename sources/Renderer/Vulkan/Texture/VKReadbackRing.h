@@ -0,0 +1,108 @@
+/*
+ * VKReadbackRing.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_VK_READBACK_RING_H
+#define LLGL_VK_READBACK_RING_H
+
+
+#include <LLGL/ImageFlags.h>
+#include "../Buffer/VKDeviceBuffer.h"
+#include "../RenderState/VKFence.h"
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class VKDevice;
+class VKDeviceMemoryManager;
+class VKTexture;
+
+/*
+Ring of host-visible staging buffers for asynchronous texture readbacks.
+Each readback records an image-to-buffer copy into its own command buffer and submits it with a fence,
+so the CPU only waits when the result is mapped before the GPU has finished the copy.
+When the result is mapped, it is copied (and converted if the requested image format differs from the texture format) into CPU memory,
+because staging buffers share their device memory chunks, which must not be mapped more than once at a time.
+*/
+class VKReadbackRing
+{
+
+    public:
+
+        VKReadbackRing(VKDevice& device, VKDeviceMemoryManager& deviceMemoryMngr);
+        ~VKReadbackRing();
+
+        VKReadbackRing(const VKReadbackRing&) = delete;
+        VKReadbackRing& operator = (const VKReadbackRing&) = delete;
+
+        // Copies the specified MIP-map level of the texture into a staging buffer and returns the ticket for this readback.
+        std::uint64_t ReadTexture(const VKTexture& texture, std::uint32_t mipLevel, ImageFormat format, DataType dataType);
+
+        // Returns true if the readback of the specified ticket has been completed. If 'wait' is true, this function blocks until the readback is complete.
+        bool Query(std::uint64_t ticket, bool wait);
+
+        // Waits for the specified readback and returns its image data in CPU memory space. Returns null if the ticket is invalid.
+        const void* Map(std::uint64_t ticket, std::size_t& dataSize);
+
+        // Releases the image data of the specified readback and makes its staging buffer available for the next readback.
+        void Release(std::uint64_t ticket);
+
+    private:
+
+        struct Slot
+        {
+            Slot(const VKPtr<VkDevice>& device);
+
+            VKDeviceBuffer  stagingBuffer;
+            VkDeviceSize    capacity        = 0;
+            VkDeviceSize    size            = 0;
+            VKFence         fence;
+            VkCommandBuffer commandBuffer   = VK_NULL_HANDLE;
+            std::uint64_t   ticket          = 0;
+            bool            signaled        = false;
+
+            ImageFormat     srcFormat       = ImageFormat::RGBA;
+            DataType        srcDataType     = DataType::UInt8;
+            ImageFormat     dstFormat       = ImageFormat::RGBA;
+            DataType        dstDataType     = DataType::UInt8;
+            std::size_t     numPixels       = 0;
+
+            ByteBuffer      hostData;
+            std::size_t     hostDataSize    = 0;
+        };
+
+    private:
+
+        Slot* FindSlot(std::uint64_t ticket);
+        Slot& AllocSlot(VkDeviceSize size);
+
+        void FreeCommandBuffer(Slot& slot);
+
+    private:
+
+        VKDevice&                           device_;
+        VKDeviceMemoryManager&              deviceMemoryMngr_;
+
+        std::vector<std::unique_ptr<Slot>>  slots_;
+        std::size_t                         nextSlot_   = 0;
+        std::uint64_t                       nextTicket_ = 1;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
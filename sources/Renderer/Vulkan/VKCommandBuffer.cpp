@@ -637,6 +637,26 @@ void VKCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t query)
     AppendQueryPoolInFlight(queryHeapVK.GetVkQueryPool());
 }
 
+void VKCommandBuffer::ResolveQueries(QueryHeap& queryHeap, std::uint32_t firstQuery, std::uint32_t numQueries, Buffer& dstBuffer, std::uint64_t dstOffset)
+{
+    auto& queryHeapVK = LLGL_CAST(VKQueryHeap&, queryHeap);
+    auto& dstBufferVK = LLGL_CAST(VKBuffer&, dstBuffer);
+
+    /* Copy 64-bit results into destination buffer; the wait flag only makes the GPU wait for the results */
+    const auto stride = static_cast<VkDeviceSize>(sizeof(std::uint64_t) * queryHeapVK.GetGroupSize());
+    const auto flags  = static_cast<VkQueryResultFlags>(VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT);
+
+    /* Query results can only be copied outside of a render pass */
+    if (IsInsideRenderPass())
+    {
+        PauseRenderPass();
+        vkCmdCopyQueryPoolResults(commandBuffer_, queryHeapVK.GetVkQueryPool(), firstQuery, numQueries, dstBufferVK.GetVkBuffer(), dstOffset, stride, flags);
+        ResumeRenderPass();
+    }
+    else
+        vkCmdCopyQueryPoolResults(commandBuffer_, queryHeapVK.GetVkQueryPool(), firstQuery, numQueries, dstBufferVK.GetVkBuffer(), dstOffset, stride, flags);
+}
+
 void VKCommandBuffer::BeginRenderCondition(QueryHeap& queryHeap, std::uint32_t query, const RenderConditionMode mode)
 {
     /*#ifdef LLGL_VK_ENABLE_EXT
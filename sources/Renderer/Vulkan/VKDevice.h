@@ -82,6 +82,15 @@ class VKDevice
             std::uint32_t       numLayers
         );
 
+        void CopyImageToBuffer(
+            VkCommandBuffer     commandBuffer,
+            VkImage             srcImage,
+            VkBuffer            dstBuffer,
+            const VkExtent3D&   extent,
+            std::uint32_t       numLayers,
+            std::uint32_t       mipLevel    = 0
+        );
+
         void GenerateMips(
             VkCommandBuffer     commandBuffer,
             VkImage             image,
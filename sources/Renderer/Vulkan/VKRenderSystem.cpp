@@ -260,9 +260,42 @@ void VKRenderSystem::UnmapBuffer(Buffer& buffer)
         /* Unmap staging buffer */
         bufferVK.Unmap(device_);
 
-        /* Copy staging buffer into GPU local buffer for write access */
-        if (bufferVK.GetMappedCPUAccess() != CPUAccess::ReadOnly)
-            device_.CopyBuffer(stagingBuffer, bufferVK.GetVkBuffer(), bufferVK.GetSize());
+        /* Copy mapped range of staging buffer into GPU local buffer for write access (unless ranges are flushed explicitly) */
+        const auto flags = bufferVK.GetMappedFlags();
+        if ((flags & MapBufferFlags::Write) != 0 && (flags & MapBufferFlags::FlushExplicit) == 0)
+        {
+            const auto offset = bufferVK.GetMappedOffset();
+            device_.CopyBuffer(stagingBuffer, bufferVK.GetVkBuffer(), bufferVK.GetMappedSize(), offset, offset);
+        }
+    }
+}
+
+void* VKRenderSystem::MapBufferRange(Buffer& buffer, std::uint64_t offset, std::uint64_t size, long flags)
+{
+    auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+
+    if (auto stagingBuffer = bufferVK.GetStagingVkBuffer())
+    {
+        /* Copy range of GPU local buffer into staging buffer for read access (the staging buffer is never in use by the GPU, so 'Unsynchronized' is ignored) */
+        if ((flags & MapBufferFlags::Read) != 0)
+            device_.CopyBuffer(bufferVK.GetVkBuffer(), stagingBuffer, size, offset, offset);
+
+        /* Map staging buffer */
+        return bufferVK.MapRange(device_, offset, size, flags);
+    }
+
+    return nullptr;
+}
+
+void VKRenderSystem::FlushMappedBufferRange(Buffer& buffer, std::uint64_t offset, std::uint64_t size)
+{
+    auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+
+    if (auto stagingBuffer = bufferVK.GetStagingVkBuffer())
+    {
+        /* Copy flushed range (relative to the mapped range) of staging buffer into GPU local buffer */
+        const auto flushOffset = bufferVK.GetMappedOffset() + offset;
+        device_.CopyBuffer(stagingBuffer, bufferVK.GetVkBuffer(), size, flushOffset, flushOffset);
     }
 }
 
@@ -477,6 +510,33 @@ void VKRenderSystem::GenerateMips(Texture& texture, std::uint32_t baseMipLevel,
     }
 }
 
+std::uint64_t VKRenderSystem::ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel, ImageFormat format, DataType dataType)
+{
+    auto& textureVK = LLGL_CAST(const VKTexture&, texture);
+
+    /* Copy texture image into the next available host-visible staging buffer */
+    if (!readbackRing_)
+        readbackRing_ = MakeUnique<VKReadbackRing>(device_, *deviceMemoryMngr_);
+
+    return readbackRing_->ReadTexture(textureVK, mipLevel, format, dataType);
+}
+
+bool VKRenderSystem::QueryReadback(std::uint64_t ticket, bool wait)
+{
+    return (readbackRing_ ? readbackRing_->Query(ticket, wait) : false);
+}
+
+const void* VKRenderSystem::MapReadback(std::uint64_t ticket, std::size_t& dataSize)
+{
+    return (readbackRing_ ? readbackRing_->Map(ticket, dataSize) : nullptr);
+}
+
+void VKRenderSystem::ReleaseReadback(std::uint64_t ticket)
+{
+    if (readbackRing_)
+        readbackRing_->Release(ticket);
+}
+
 /* ----- Sampler States ---- */
 
 Sampler* VKRenderSystem::CreateSampler(const SamplerDescriptor& desc)
@@ -28,6 +28,7 @@
 #include "Texture/VKTexture.h"
 #include "Texture/VKSampler.h"
 #include "Texture/VKRenderTarget.h"
+#include "Texture/VKReadbackRing.h"
 
 #include "RenderState/VKQueryHeap.h"
 #include "RenderState/VKFence.h"
@@ -88,6 +89,9 @@ class VKRenderSystem final : public RenderSystem
         void* MapBuffer(Buffer& buffer, const CPUAccess access) override;
         void UnmapBuffer(Buffer& buffer) override;
 
+        void* MapBufferRange(Buffer& buffer, std::uint64_t offset, std::uint64_t size, long flags) override;
+        void FlushMappedBufferRange(Buffer& buffer, std::uint64_t offset, std::uint64_t size) override;
+
         /* ----- Textures ----- */
 
         Texture* CreateTexture(const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc = nullptr) override;
@@ -100,6 +104,11 @@ class VKRenderSystem final : public RenderSystem
         void GenerateMips(Texture& texture) override;
         void GenerateMips(Texture& texture, std::uint32_t baseMipLevel, std::uint32_t numMipLevels, std::uint32_t baseArrayLayer = 0, std::uint32_t numArrayLayers = 1) override;
 
+        std::uint64_t ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel, ImageFormat format, DataType dataType) override;
+        bool QueryReadback(std::uint64_t ticket, bool wait = false) override;
+        const void* MapReadback(std::uint64_t ticket, std::size_t& dataSize) override;
+        void ReleaseReadback(std::uint64_t ticket) override;
+
         /* ----- Sampler States ---- */
 
         Sampler* CreateSampler(const SamplerDescriptor& desc) override;
@@ -191,6 +200,7 @@ class VKRenderSystem final : public RenderSystem
         bool                                    debugLayerEnabled_      = false;
 
         std::unique_ptr<VKDeviceMemoryManager>  deviceMemoryMngr_;
+        std::unique_ptr<VKReadbackRing>         readbackRing_;
 
         VKGraphicsPipelineLimits                gfxPipelineLimits_;
 
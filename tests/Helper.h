@@ -12,6 +12,11 @@
 #include <LLGL/LLGL.h>
 #include <Gauss/Gauss.h>
 #include <fstream>
+#include <iostream>
+#include <functional>
+#include <stdexcept>
+#include <cstdint>
+#include <cstdlib>
 
 
 inline std::string ReadFileContent(const std::string& filename)
@@ -28,6 +33,118 @@ inline std::string ReadFileContent(const std::string& filename)
     };
 }
 
+// Runs the specified test function and returns the exit code for 'main'. Exceptions are reported as failure.
+inline int RunTest(const std::function<bool()>& test)
+{
+    try
+    {
+        if (test())
+        {
+            std::cout << "test passed" << std::endl;
+            return EXIT_SUCCESS;
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+    }
+    return EXIT_FAILURE;
+}
+
+// White triangle with the shader program from "BlendTest.vert" and "BlendTest.frag".
+struct TestTriangle
+{
+    LLGL::VertexFormat      vertexFormat;
+    LLGL::Buffer*           vertexBuffer    = nullptr;
+    LLGL::ShaderProgram*    shaderProgram   = nullptr;
+};
+
+// Creates a white triangle with its corners at (-extent, -extent), (-extent, +extent), and (+extent, -extent).
+inline TestTriangle CreateTestTriangle(LLGL::RenderSystem& renderer, float extent)
+{
+    TestTriangle triangle;
+
+    // Create vertex buffer
+    struct Vertex
+    {
+        Gs::Vector2f        coord;
+        LLGL::ColorRGBAub   color;
+    }
+    vertices[] =
+    {
+        { { -extent, -extent }, { 255, 255, 255, 255 } },
+        { { -extent,  extent }, { 255, 255, 255, 255 } },
+        { {  extent, -extent }, { 255, 255, 255, 255 } },
+    };
+
+    triangle.vertexFormat.AppendAttribute({ "coord", LLGL::Format::RG32Float });
+    triangle.vertexFormat.AppendAttribute({ "color", LLGL::Format::RGBA8UNorm });
+    triangle.vertexFormat.stride = sizeof(Vertex);
+
+    LLGL::BufferDescriptor vertexBufferDesc;
+    {
+        vertexBufferDesc.size                   = sizeof(vertices);
+        vertexBufferDesc.bindFlags              = LLGL::BindFlags::VertexBuffer;
+        vertexBufferDesc.vertexBuffer.format    = triangle.vertexFormat;
+    }
+    triangle.vertexBuffer = renderer.CreateBuffer(vertexBufferDesc, vertices);
+
+    // Create shader program
+    LLGL::ShaderProgramDescriptor shaderProgramDesc;
+    {
+        shaderProgramDesc.vertexFormats     = { triangle.vertexFormat };
+        shaderProgramDesc.vertexShader      = renderer.CreateShader({ LLGL::ShaderType::Vertex,   "BlendTest.vert" });
+        shaderProgramDesc.fragmentShader    = renderer.CreateShader({ LLGL::ShaderType::Fragment, "BlendTest.frag" });
+    }
+    triangle.shaderProgram = renderer.CreateShaderProgram(shaderProgramDesc);
+
+    if (triangle.shaderProgram->HasErrors())
+        throw std::runtime_error(triangle.shaderProgram->QueryInfoLog());
+
+    return triangle;
+}
+
+// Draws the triangle into the render context with the specified pipeline and returns the number of samples that passed.
+inline std::uint64_t DrawAndCountSamples(
+    LLGL::RenderSystem&         renderer,
+    LLGL::RenderContext&        context,
+    LLGL::CommandBuffer&        commands,
+    LLGL::GraphicsPipeline&     pipeline,
+    const TestTriangle&         triangle,
+    LLGL::QueryHeap&            queryHeap)
+{
+    auto commandQueue = renderer.GetCommandQueue();
+
+    commands.Begin();
+    {
+        commands.SetVertexBuffer(*triangle.vertexBuffer);
+        commands.BeginRenderPass(context);
+        {
+            commands.SetViewport(context.GetVideoMode().resolution);
+            commands.Clear(LLGL::ClearFlags::ColorDepth);
+            commands.SetGraphicsPipeline(pipeline);
+            commands.BeginQuery(queryHeap);
+            {
+                commands.Draw(3, 0);
+            }
+            commands.EndQuery(queryHeap);
+        }
+        commands.EndRenderPass();
+    }
+    commands.End();
+    commandQueue->Submit(commands);
+
+    std::uint64_t numSamples = 0;
+    while (!commandQueue->QueryResult(queryHeap, 0, 1, &numSamples, sizeof(numSamples)))
+    {
+        /* wait until the result is available */
+    }
+
+    context.Present();
+
+    return numSamples;
+}
+
 
 #endif
 
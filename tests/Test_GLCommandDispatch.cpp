@@ -0,0 +1,358 @@
+/*
+ * Test_GLCommandDispatch.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+/*
+Benchmark for the dispatch strategies of the GL command interpreter.
+A synthetic stream of 100k commands with the same encoding as GLDeferredCommandBuffer is replayed against a stub state manager,
+so only the interpreter overhead is measured (no GL context is required).
+*/
+
+#include "../sources/Renderer/OpenGL/Command/GLCommand.h"
+#include "../sources/Renderer/OpenGL/Command/GLCommandOpcode.h"
+#include <vector>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <string.h>
+
+
+using namespace LLGL;
+
+// Stub state manager that only accumulates the values it receives.
+struct StubStateManager
+{
+    std::uint64_t checksum = 0;
+
+    void Accumulate(std::uint64_t value)
+    {
+        checksum = checksum * 31 + value;
+    }
+};
+
+static const std::size_t g_numCommands  = 100000;
+static const int         g_numReplays   = 100;
+
+
+/*
+ * Command handlers
+ */
+
+static std::size_t StubUpdateBuffer(const void* pc, StubStateManager& stateMngr)
+{
+    auto cmd = reinterpret_cast<const GLCmdUpdateBuffer*>(pc);
+    stateMngr.Accumulate(static_cast<std::uint64_t>(cmd->offset + cmd->size));
+    return (sizeof(*cmd) + cmd->size);
+}
+
+static std::size_t StubViewport(const void* pc, StubStateManager& stateMngr)
+{
+    auto cmd = reinterpret_cast<const GLCmdViewport*>(pc);
+    stateMngr.Accumulate(static_cast<std::uint64_t>(cmd->viewport.width));
+    return sizeof(*cmd);
+}
+
+static std::size_t StubBindVertexArray(const void* pc, StubStateManager& stateMngr)
+{
+    auto cmd = reinterpret_cast<const GLCmdBindVertexArray*>(pc);
+    stateMngr.Accumulate(cmd->vao);
+    return sizeof(*cmd);
+}
+
+static std::size_t StubBindBufferBase(const void* pc, StubStateManager& stateMngr)
+{
+    auto cmd = reinterpret_cast<const GLCmdBindBufferBase*>(pc);
+    stateMngr.Accumulate(cmd->index ^ cmd->id);
+    return sizeof(*cmd);
+}
+
+static std::size_t StubBindSampler(const void* pc, StubStateManager& stateMngr)
+{
+    auto cmd = reinterpret_cast<const GLCmdBindSampler*>(pc);
+    stateMngr.Accumulate(cmd->slot ^ cmd->sampler);
+    return sizeof(*cmd);
+}
+
+static std::size_t StubDrawArrays(const void* pc, StubStateManager& stateMngr)
+{
+    auto cmd = reinterpret_cast<const GLCmdDrawArrays*>(pc);
+    stateMngr.Accumulate(static_cast<std::uint64_t>(cmd->first + cmd->count));
+    return sizeof(*cmd);
+}
+
+static std::size_t StubDrawElements(const void* pc, StubStateManager& stateMngr)
+{
+    auto cmd = reinterpret_cast<const GLCmdDrawElements*>(pc);
+    stateMngr.Accumulate(static_cast<std::uint64_t>(cmd->count));
+    return sizeof(*cmd);
+}
+
+static std::size_t StubNull(const void* /*pc*/, StubStateManager& /*stateMngr*/)
+{
+    return 0;
+}
+
+using StubHandler = std::size_t (*)(const void* pc, StubStateManager& stateMngr);
+
+static StubHandler GetStubHandler(int opcode)
+{
+    switch (opcode)
+    {
+        case GLOpcodeUpdateBuffer:      return StubUpdateBuffer;
+        case GLOpcodeViewport:          return StubViewport;
+        case GLOpcodeBindVertexArray:   return StubBindVertexArray;
+        case GLOpcodeBindBufferBase:    return StubBindBufferBase;
+        case GLOpcodeBindSampler:       return StubBindSampler;
+        case GLOpcodeDrawArrays:        return StubDrawArrays;
+        case GLOpcodeDrawElements:      return StubDrawElements;
+        default:                        return StubNull;
+    }
+}
+
+
+/*
+ * Synthetic command stream
+ */
+
+template <typename T>
+T* AllocCommand(std::vector<std::uint8_t>& stream, GLOpcode opcode, std::size_t extraSize = 0)
+{
+    auto offset = stream.size();
+    stream.resize(offset + sizeof(GLOpcode) + sizeof(T) + extraSize);
+    stream[offset] = opcode;
+    return reinterpret_cast<T*>(&stream[offset + sizeof(GLOpcode)]);
+}
+
+static std::vector<std::uint8_t> GenerateCommandStream()
+{
+    std::vector<std::uint8_t> stream;
+    unsigned seed = 1;
+
+    for (std::size_t i = 0; i < g_numCommands; ++i)
+    {
+        seed = (214013 * seed + 2531011);
+        switch ((seed >> 16) % 8)
+        {
+            case 0:
+            {
+                auto cmd = AllocCommand<GLCmdUpdateBuffer>(stream, GLOpcodeUpdateBuffer, 16);
+                cmd->buffer = nullptr;
+                cmd->offset = static_cast<GLintptr>(i % 256);
+                cmd->size   = 16;
+                ::memset(cmd + 1, 0, 16);
+            }
+            break;
+            case 1:
+            {
+                auto cmd = AllocCommand<GLCmdViewport>(stream, GLOpcodeViewport);
+                cmd->viewport   = GLViewport{ 0.0f, 0.0f, 800.0f, 600.0f };
+                cmd->depthRange = GLDepthRange{ 0.0, 1.0 };
+            }
+            break;
+            case 2:
+                AllocCommand<GLCmdBindVertexArray>(stream, GLOpcodeBindVertexArray)->vao = static_cast<GLuint>(i % 8);
+                break;
+            case 3:
+            {
+                auto cmd = AllocCommand<GLCmdBindBufferBase>(stream, GLOpcodeBindBufferBase);
+                cmd->target = GLBufferTarget::UNIFORM_BUFFER;
+                cmd->index  = static_cast<GLuint>(i % 4);
+                cmd->id     = static_cast<GLuint>(i % 16);
+            }
+            break;
+            case 4:
+            {
+                auto cmd = AllocCommand<GLCmdBindSampler>(stream, GLOpcodeBindSampler);
+                cmd->slot       = static_cast<std::uint32_t>(i % 4);
+                cmd->sampler    = static_cast<GLuint>(i % 3);
+            }
+            break;
+            case 5:
+            {
+                auto cmd = AllocCommand<GLCmdDrawArrays>(stream, GLOpcodeDrawArrays);
+                cmd->mode   = GL_TRIANGLES;
+                cmd->first  = 0;
+                cmd->count  = 36;
+            }
+            break;
+            default:
+            {
+                auto cmd = AllocCommand<GLCmdDrawElements>(stream, GLOpcodeDrawElements);
+                cmd->mode       = GL_TRIANGLES;
+                cmd->count      = 36;
+                cmd->type       = GL_UNSIGNED_INT;
+                cmd->indices    = nullptr;
+            }
+            break;
+        }
+    }
+
+    return stream;
+}
+
+
+/*
+ * Interpreters
+ */
+
+// Switch-based dispatch (previous implementation of the GL command executor).
+static std::size_t ExecuteSwitch(GLOpcode opcode, const void* pc, StubStateManager& stateMngr)
+{
+    switch (opcode)
+    {
+        case GLOpcodeUpdateBuffer:      return StubUpdateBuffer(pc, stateMngr);
+        case GLOpcodeViewport:          return StubViewport(pc, stateMngr);
+        case GLOpcodeBindVertexArray:   return StubBindVertexArray(pc, stateMngr);
+        case GLOpcodeBindBufferBase:    return StubBindBufferBase(pc, stateMngr);
+        case GLOpcodeBindSampler:       return StubBindSampler(pc, stateMngr);
+        case GLOpcodeDrawArrays:        return StubDrawArrays(pc, stateMngr);
+        case GLOpcodeDrawElements:      return StubDrawElements(pc, stateMngr);
+        default:                        return 0;
+    }
+}
+
+static void ReplaySwitch(const std::vector<std::uint8_t>& stream, StubStateManager& stateMngr)
+{
+    auto pc = stream.data(), pcEnd = stream.data() + stream.size();
+    while (pc < pcEnd)
+    {
+        auto opcode = static_cast<GLOpcode>(*pc++);
+        pc += ExecuteSwitch(opcode, pc, stateMngr);
+    }
+}
+
+// Handler table dispatch (emulated execution of the GL command executor).
+static void ReplayHandlerTable(const std::vector<std::uint8_t>& stream, const StubHandler* handlers, StubStateManager& stateMngr)
+{
+    auto pc = stream.data(), pcEnd = stream.data() + stream.size();
+    while (pc < pcEnd)
+    {
+        auto opcode = *pc++;
+        pc += handlers[opcode](pc, stateMngr);
+    }
+}
+
+struct StubDecodedCommand
+{
+    StubHandler handler;
+    const void* pc;
+};
+
+// Pre-decoded handler array (execution of multi-submit command buffers without JIT compiler).
+static void ReplayDecoded(const std::vector<StubDecodedCommand>& decodedCommands, StubStateManager& stateMngr)
+{
+    for (const auto& cmd : decodedCommands)
+        cmd.handler(cmd.pc, stateMngr);
+}
+
+#ifdef __GNUC__
+
+// Computed-goto threaded dispatch (GCC and Clang only).
+static void ReplayComputedGoto(const std::vector<std::uint8_t>& stream, StubStateManager& stateMngr)
+{
+    static void* labels[256];
+    static bool labelsInitialized = false;
+
+    if (!labelsInitialized)
+    {
+        for (auto& label : labels)
+            label = &&L_Null;
+        labels[GLOpcodeUpdateBuffer]    = &&L_UpdateBuffer;
+        labels[GLOpcodeViewport]        = &&L_Viewport;
+        labels[GLOpcodeBindVertexArray] = &&L_BindVertexArray;
+        labels[GLOpcodeBindBufferBase]  = &&L_BindBufferBase;
+        labels[GLOpcodeBindSampler]     = &&L_BindSampler;
+        labels[GLOpcodeDrawArrays]      = &&L_DrawArrays;
+        labels[GLOpcodeDrawElements]    = &&L_DrawElements;
+        labelsInitialized = true;
+    }
+
+    auto pc = stream.data(), pcEnd = stream.data() + stream.size();
+
+    #define LLGL_DISPATCH_NEXT          \
+        if (pc >= pcEnd)                \
+            return;                     \
+        goto *labels[*pc++]
+
+    LLGL_DISPATCH_NEXT;
+
+    L_UpdateBuffer:
+        pc += StubUpdateBuffer(pc, stateMngr);
+        LLGL_DISPATCH_NEXT;
+    L_Viewport:
+        pc += StubViewport(pc, stateMngr);
+        LLGL_DISPATCH_NEXT;
+    L_BindVertexArray:
+        pc += StubBindVertexArray(pc, stateMngr);
+        LLGL_DISPATCH_NEXT;
+    L_BindBufferBase:
+        pc += StubBindBufferBase(pc, stateMngr);
+        LLGL_DISPATCH_NEXT;
+    L_BindSampler:
+        pc += StubBindSampler(pc, stateMngr);
+        LLGL_DISPATCH_NEXT;
+    L_DrawArrays:
+        pc += StubDrawArrays(pc, stateMngr);
+        LLGL_DISPATCH_NEXT;
+    L_DrawElements:
+        pc += StubDrawElements(pc, stateMngr);
+        LLGL_DISPATCH_NEXT;
+    L_Null:
+        LLGL_DISPATCH_NEXT;
+
+    #undef LLGL_DISPATCH_NEXT
+}
+
+#endif // /__GNUC__
+
+template <typename TFunc>
+void MeasureReplay(const char* title, TFunc replay)
+{
+    StubStateManager stateMngr;
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < g_numReplays; ++i)
+        replay(stateMngr);
+    auto endTime = std::chrono::high_resolution_clock::now();
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
+    auto nsPerCmd = static_cast<double>(elapsed) / static_cast<double>(g_numCommands * g_numReplays);
+
+    std::cout << std::left << std::setw(24) << title << ": ";
+    std::cout << std::fixed << std::setprecision(2) << nsPerCmd << " ns/command (checksum = " << stateMngr.checksum << ")" << std::endl;
+}
+
+int main()
+{
+    auto stream = GenerateCommandStream();
+
+    /* Initialize handler table */
+    StubHandler handlers[256];
+    for (int i = 0; i < 256; ++i)
+        handlers[i] = GetStubHandler(i);
+
+    /* Pre-decode command stream */
+    std::vector<StubDecodedCommand> decodedCommands;
+    decodedCommands.reserve(g_numCommands);
+
+    for (auto pc = stream.data(), pcEnd = stream.data() + stream.size(); pc < pcEnd;)
+    {
+        auto opcode = static_cast<GLOpcode>(*pc++);
+        decodedCommands.push_back({ handlers[opcode], pc });
+        pc += GetGLCommandSize(opcode, pc);
+    }
+
+    std::cout << "replay " << g_numCommands << " commands (" << stream.size() << " bytes) " << g_numReplays << " times" << std::endl;
+
+    MeasureReplay("switch",         [&](StubStateManager& s) { ReplaySwitch(stream, s); });
+    MeasureReplay("handler table",  [&](StubStateManager& s) { ReplayHandlerTable(stream, handlers, s); });
+    MeasureReplay("pre-decoded",    [&](StubStateManager& s) { ReplayDecoded(decodedCommands, s); });
+    #ifdef __GNUC__
+    MeasureReplay("computed goto",  [&](StubStateManager& s) { ReplayComputedGoto(stream, s); });
+    #endif
+
+    return 0;
+}
@@ -0,0 +1,121 @@
+/*
+ * Test_GLCommandRing.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+/*
+Stress test for the lock-free command ring of the dedicated GL render thread.
+A producer thread writes records of varying size (including wrap-arounds) and a consumer thread validates their contents,
+so the throughput of the ring can be measured without a GL context.
+*/
+
+#include "../sources/Renderer/OpenGL/Command/GLCommandRing.h"
+#include <thread>
+#include <chrono>
+#include <iostream>
+#include <string.h>
+
+
+using namespace LLGL;
+
+static const std::size_t    g_ringSize      = (64u << 10);
+static const std::uint32_t  g_numRecords    = 1000000;
+
+// Returns the payload size of the specified record (between 4 and 1024 bytes).
+static std::size_t GetRecordSize(std::uint32_t index)
+{
+    return 4 + (index * 2654435761u) % 1021;
+}
+
+static void Produce(GLCommandRing& ring)
+{
+    for (std::uint32_t i = 0; i < g_numRecords; ++i)
+    {
+        /* Write record header (non-zero tag, index, size) and payload */
+        const auto size = GetRecordSize(i);
+        auto dst = ring.BeginWrite(1 + sizeof(i) + size);
+        {
+            dst[0] = 0xAB;
+            ::memcpy(dst + 1, &i, sizeof(i));
+            ::memset(dst + 1 + sizeof(i), static_cast<int>(i & 0xFF), size);
+        }
+        ring.EndWrite();
+    }
+}
+
+static bool Consume(GLCommandRing& ring)
+{
+    std::uint32_t expected = 0;
+
+    while (expected < g_numRecords)
+    {
+        std::size_t size = 0;
+        auto data = ring.BeginRead(size);
+        if (!data)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        for (auto pc = data, pcEnd = data + size; pc < pcEnd;)
+        {
+            /* Skip remaining bytes on wrap marker */
+            if (*pc == GLCommandRing::g_wrapMarker)
+                break;
+
+            /* Validate record header and payload */
+            std::uint32_t index = 0;
+            ::memcpy(&index, pc + 1, sizeof(index));
+            if (index != expected)
+            {
+                std::cerr << "record mismatch: expected " << expected << ", but got " << index << std::endl;
+                return false;
+            }
+
+            const auto recordSize = GetRecordSize(index);
+            for (std::size_t i = 0; i < recordSize; ++i)
+            {
+                if (pc[1 + sizeof(index) + i] != static_cast<std::uint8_t>(index & 0xFF))
+                {
+                    std::cerr << "payload mismatch in record " << index << std::endl;
+                    return false;
+                }
+            }
+
+            pc += 1 + sizeof(index) + recordSize;
+            ++expected;
+        }
+
+        ring.EndRead(size);
+    }
+
+    return ring.IsEmpty();
+}
+
+int main()
+{
+    GLCommandRing ring { g_ringSize };
+
+    bool succeeded = false;
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+    {
+        std::thread consumer([&]() { succeeded = Consume(ring); });
+        Produce(ring);
+        consumer.join();
+    }
+    auto endTime = std::chrono::high_resolution_clock::now();
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime).count();
+
+    std::cout << "transferred " << g_numRecords << " records through " << (g_ringSize >> 10) << " KiB ring in " << elapsed << " us" << std::endl;
+    std::cout << (succeeded ? "Test_GLCommandRing: passed" : "Test_GLCommandRing: failed") << std::endl;
+
+    return (succeeded ? 0 : 1);
+}
+
+
+
+// ================================================================================
@@ -0,0 +1,102 @@
+/*
+ * Test_GLFramesInFlight.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "Helper.h"
+
+
+/*
+Checks the frame index of RenderContext::GetCurrentFrame with a limited number of frames in flight (see RenderContextDescriptor::maxFramesInFlight),
+with and without a dedicated render thread. The index must cycle through [0, maxFramesInFlight) with each call to Present,
+or remain 0 if the frames in flight cannot be limited (i.e. without GL_ARB_sync).
+Run from the "tests" directory: ./Test_GLFramesInFlight
+*/
+
+static const std::uint32_t g_maxFramesInFlight  = 3;
+static const std::uint32_t g_numFrames          = 10;
+
+// Presents a number of frames and checks the frame index after each call to Present.
+static bool TestFramesInFlight(bool dedicatedRenderThread)
+{
+    std::cout << "dedicated render thread: " << (dedicatedRenderThread ? "yes" : "no") << std::endl;
+
+    auto renderer = LLGL::RenderSystem::Load("OpenGL");
+
+    LLGL::RenderSystemConfiguration config = renderer->GetConfiguration();
+    config.dedicatedRenderThread = dedicatedRenderThread;
+    renderer->SetConfiguration(config);
+
+    // Create render context with limited frames in flight
+    LLGL::RenderContextDescriptor contextDesc;
+
+    contextDesc.videoMode.resolution    = { 64, 64 };
+    contextDesc.vsync.enabled           = false;
+    contextDesc.maxFramesInFlight       = g_maxFramesInFlight;
+
+    auto context = renderer->CreateRenderContext(contextDesc);
+
+    auto commandQueue = renderer->GetCommandQueue();
+    auto commands = renderer->CreateCommandBuffer();
+
+    // Fixed frame index means the frames in flight are not limited
+    bool frameIndexCycles = false;
+    bool succeeded = (context->GetCurrentFrame() == 0);
+
+    for (std::uint32_t frame = 1; frame <= g_numFrames; ++frame)
+    {
+        commands->Begin();
+        {
+            commands->BeginRenderPass(*context);
+            {
+                commands->Clear(LLGL::ClearFlags::Color);
+            }
+            commands->EndRenderPass();
+        }
+        commands->End();
+        commandQueue->Submit(*commands);
+
+        context->Present();
+
+        auto currentFrame = context->GetCurrentFrame();
+        std::cout << "frame " << frame << ": current frame index = " << currentFrame << std::endl;
+
+        if (frame == 1)
+            frameIndexCycles = (currentFrame != 0);
+
+        auto expectedFrame = (frameIndexCycles ? frame % g_maxFramesInFlight : 0u);
+        if (currentFrame != expectedFrame)
+        {
+            std::cerr << "test failed: expected frame index " << expectedFrame << std::endl;
+            succeeded = false;
+        }
+    }
+
+    if (!frameIndexCycles)
+        std::cout << "frames in flight not limited (GL_ARB_sync not supported)" << std::endl;
+
+    commandQueue->WaitIdle();
+
+    LLGL::RenderSystem::Unload(std::move(renderer));
+
+    return succeeded;
+}
+
+int main()
+{
+    return RunTest(
+        []() -> bool
+        {
+            bool succeeded = true;
+
+            if (!TestFramesInFlight(false))
+                succeeded = false;
+            if (!TestFramesInFlight(true))
+                succeeded = false;
+
+            return succeeded;
+        }
+    );
+}
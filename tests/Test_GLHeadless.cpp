@@ -0,0 +1,73 @@
+/*
+ * Test_GLHeadless.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "Helper.h"
+
+
+/*
+Creates a headless OpenGL render context via EGL (see RenderSystemConfiguration::headlessRenderContexts),
+and checks that its default framebuffer can be rendered into, before and after it has been resized.
+Samples are counted with an occlusion query, since a context without a default framebuffer would not pass any samples.
+Run from the "tests" directory without a display server, e.g.: env -u DISPLAY ./Test_GLHeadless
+*/
+
+int main()
+{
+    return RunTest(
+        []() -> bool
+        {
+            // Load render system module and enable headless render contexts
+            auto renderer = LLGL::RenderSystem::Load("OpenGL");
+
+            LLGL::RenderSystemConfiguration config = renderer->GetConfiguration();
+            config.headlessRenderContexts = true;
+            renderer->SetConfiguration(config);
+
+            // Create headless render context
+            LLGL::RenderContextDescriptor contextDesc;
+
+            contextDesc.videoMode.resolution    = { 64, 64 };
+            contextDesc.vsync.enabled           = false;
+
+            auto context = renderer->CreateRenderContext(contextDesc);
+
+            std::cout << "renderer: " << renderer->GetRendererInfo().rendererName << std::endl;
+
+            // Create triangle that covers half of the viewport, graphics pipeline, and occlusion query
+            auto triangle = CreateTestTriangle(*renderer, 1.0f);
+
+            LLGL::GraphicsPipelineDescriptor pipelineDesc;
+            {
+                pipelineDesc.shaderProgram = triangle.shaderProgram;
+            }
+            auto pipeline = renderer->CreateGraphicsPipeline(pipelineDesc);
+
+            auto queryHeap = renderer->CreateQueryHeap(LLGL::QueryHeapDescriptor{});
+            auto commands = renderer->CreateCommandBuffer();
+
+            // Render into default framebuffer with the initial resolution
+            auto numSamples = DrawAndCountSamples(*renderer, *context, *commands, *pipeline, triangle, *queryHeap);
+            std::cout << "samples passed (64x64): " << numSamples << std::endl;
+
+            // Resize the off-screen surface and render again
+            auto videoMode = context->GetVideoMode();
+            videoMode.resolution = { 128, 128 };
+            context->SetVideoMode(videoMode);
+
+            auto numSamplesResized = DrawAndCountSamples(*renderer, *context, *commands, *pipeline, triangle, *queryHeap);
+            std::cout << "samples passed (128x128): " << numSamplesResized << std::endl;
+
+            if (numSamples == 0 || numSamplesResized <= numSamples)
+            {
+                std::cerr << "test failed: default framebuffer of headless render context did not pass any samples" << std::endl;
+                return false;
+            }
+
+            return true;
+        }
+    );
+}
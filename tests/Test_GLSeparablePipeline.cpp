@@ -0,0 +1,199 @@
+/*
+ * Test_GLSeparablePipeline.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "Helper.h"
+#include <algorithm>
+
+
+/*
+Builds a vertex and fragment shader program as program pipeline of separable programs (see RenderSystemConfiguration::separableShaderPrograms),
+and checks that the pipeline links and that its reflection is merged over both stages.
+Run from the "tests" directory: ./Test_GLSeparablePipeline
+*/
+
+static const LLGL::ShaderReflectionDescriptor::ResourceView* FindResourceView(
+    const LLGL::ShaderReflectionDescriptor& reflection,
+    const std::string&                      name)
+{
+    auto it = std::find_if(
+        reflection.resourceViews.begin(),
+        reflection.resourceViews.end(),
+        [&name](const LLGL::ShaderReflectionDescriptor::ResourceView& entry)
+        {
+            return (entry.name == name);
+        }
+    );
+    return (it != reflection.resourceViews.end() ? &(*it) : nullptr);
+}
+
+static bool HasVertexAttribute(const LLGL::ShaderReflectionDescriptor& reflection, const std::string& name)
+{
+    for (const auto& attrib : reflection.vertexAttributes)
+    {
+        if (attrib.name == name)
+            return true;
+    }
+    return false;
+}
+
+int main()
+{
+    return RunTest(
+        []() -> bool
+        {
+            // Load render system module and enable separable shader programs
+            auto renderer = LLGL::RenderSystem::Load("OpenGL");
+
+            LLGL::RenderSystemConfiguration config = renderer->GetConfiguration();
+            config.separableShaderPrograms = true;
+            renderer->SetConfiguration(config);
+
+            // Create render context
+            LLGL::RenderContextDescriptor contextDesc;
+
+            contextDesc.videoMode.resolution    = { 64, 64 };
+            contextDesc.vsync.enabled           = false;
+
+            renderer->CreateRenderContext(contextDesc);
+
+            std::cout << "renderer: " << renderer->GetRendererInfo().rendererName << std::endl;
+
+            // Separable programs and program pipelines are core features since OpenGL 4.1
+            const auto& shadingLanguages = renderer->GetRenderingCaps().shadingLanguages;
+            if (std::find(shadingLanguages.begin(), shadingLanguages.end(), LLGL::ShadingLanguage::GLSL_410) == shadingLanguages.end())
+            {
+                std::cout << "test skipped: separable shader programs not supported (requires OpenGL 4.1)" << std::endl;
+                return true;
+            }
+
+            // Create vertex format
+            LLGL::VertexFormat vertexFormat;
+            vertexFormat.AppendAttribute({ "coord", LLGL::Format::RG32Float });
+            vertexFormat.AppendAttribute({ "color", LLGL::Format::RGBA8UNorm });
+
+            // Create shaders for separable programs, i.e. the vertex shader must redeclare gl_PerVertex
+            auto vertShaderSource =
+            (
+                "#version 330 core\n"
+                "#extension GL_ARB_separate_shader_objects : enable\n"
+                "layout(std140) uniform Scene {\n"
+                "    vec4 offset;\n"
+                "    vec4 tint;\n"
+                "};\n"
+                "in vec2 coord;\n"
+                "in vec4 color;\n"
+                "out gl_PerVertex {\n"
+                "    vec4 gl_Position;\n"
+                "};\n"
+                "out vec4 vColor;\n"
+                "void main() {\n"
+                "    gl_Position = vec4(coord, 0, 1) + offset;\n"
+                "    vColor = color;\n"
+                "}\n"
+            );
+
+            auto fragShaderSource =
+            (
+                "#version 330 core\n"
+                "#extension GL_ARB_separate_shader_objects : enable\n"
+                "layout(std140) uniform Scene {\n"
+                "    vec4 offset;\n"
+                "    vec4 tint;\n"
+                "};\n"
+                "uniform sampler2D colorMap;\n"
+                "in vec4 vColor;\n"
+                "out vec4 fColor;\n"
+                "void main() {\n"
+                "    fColor = vColor * tint * texture(colorMap, vec2(0.5));\n"
+                "}\n"
+            );
+
+            LLGL::ShaderDescriptor vertShaderDesc;
+            {
+                vertShaderDesc.type         = LLGL::ShaderType::Vertex;
+                vertShaderDesc.source       = vertShaderSource;
+                vertShaderDesc.sourceType   = LLGL::ShaderSourceType::CodeString;
+            }
+            auto vertShader = renderer->CreateShader(vertShaderDesc);
+
+            LLGL::ShaderDescriptor fragShaderDesc;
+            {
+                fragShaderDesc.type         = LLGL::ShaderType::Fragment;
+                fragShaderDesc.source       = fragShaderSource;
+                fragShaderDesc.sourceType   = LLGL::ShaderSourceType::CodeString;
+            }
+            auto fragShader = renderer->CreateShader(fragShaderDesc);
+
+            if (vertShader->HasErrors())
+                throw std::runtime_error(vertShader->QueryInfoLog());
+            if (fragShader->HasErrors())
+                throw std::runtime_error(fragShader->QueryInfoLog());
+
+            // Create shader program, which must link as program pipeline
+            LLGL::ShaderProgramDescriptor shaderProgramDesc;
+            {
+                shaderProgramDesc.vertexFormats     = { vertexFormat };
+                shaderProgramDesc.vertexShader      = vertShader;
+                shaderProgramDesc.fragmentShader    = fragShader;
+            }
+            auto shaderProgram = renderer->CreateShaderProgram(shaderProgramDesc);
+
+            if (shaderProgram->HasErrors())
+                throw std::runtime_error(shaderProgram->QueryInfoLog());
+
+            // Check reflection of both stages
+            auto reflection = shaderProgram->QueryReflectionDesc();
+
+            bool succeeded = true;
+
+            if (!HasVertexAttribute(reflection, "coord") || !HasVertexAttribute(reflection, "color"))
+            {
+                std::cerr << "test failed: missing vertex attributes in reflection of program pipeline" << std::endl;
+                succeeded = false;
+            }
+
+            // Uniform block "Scene" is used in both stages, so it must be reflected only once for both stages
+            auto sceneBuffer = FindResourceView(reflection, "Scene");
+            const long graphicsStages = (LLGL::StageFlags::VertexStage | LLGL::StageFlags::FragmentStage);
+
+            if (sceneBuffer == nullptr || (sceneBuffer->stageFlags & graphicsStages) != graphicsStages)
+            {
+                std::cerr << "test failed: uniform block \"Scene\" not reflected for vertex and fragment stage" << std::endl;
+                succeeded = false;
+            }
+            else if (sceneBuffer->constantBufferSize != 32)
+            {
+                std::cerr << "test failed: uniform block \"Scene\" reflected with size " << sceneBuffer->constantBufferSize << " (expected 32)" << std::endl;
+                succeeded = false;
+            }
+
+            auto numSceneBuffers = std::count_if(
+                reflection.resourceViews.begin(),
+                reflection.resourceViews.end(),
+                [](const LLGL::ShaderReflectionDescriptor::ResourceView& entry)
+                {
+                    return (entry.name == "Scene");
+                }
+            );
+            if (numSceneBuffers != 1)
+            {
+                std::cerr << "test failed: uniform block \"Scene\" reflected " << numSceneBuffers << " times" << std::endl;
+                succeeded = false;
+            }
+
+            // Sampler "colorMap" is only used in the fragment stage
+            auto colorMap = FindResourceView(reflection, "colorMap");
+            if (colorMap == nullptr || (colorMap->stageFlags & LLGL::StageFlags::FragmentStage) == 0)
+            {
+                std::cerr << "test failed: sampler \"colorMap\" not reflected for fragment stage" << std::endl;
+                succeeded = false;
+            }
+
+            return succeeded;
+        }
+    );
+}
@@ -0,0 +1,111 @@
+/*
+ * Test_GLStartup.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/LLGL.h>
+#include <LLGL/Timer.h>
+#include <iostream>
+#include <algorithm>
+#include <cstdlib>
+
+
+/*
+Microbenchmark for the startup time of the OpenGL renderer, i.e. from RenderSystem::Load up to the first presented frame.
+Each iteration loads the render system module, creates a render context, clears and presents it once, and unloads the module again.
+Run from the "tests" directory: ./Test_GLStartup [ITERATIONS]
+*/
+
+int main(int argc, char* argv[])
+{
+    try
+    {
+        // Parse benchmark parameters
+        const int numIterations = (argc > 1 ? std::max(1, std::atoi(argv[1])) : 20);
+
+        auto timer = LLGL::Timer::Create();
+        const auto ticksToMs = 1000.0 / static_cast<double>(timer->GetFrequency());
+
+        double totalLoadTime = 0.0, totalContextTime = 0.0, totalFrameTime = 0.0;
+        double minTotalTime = 0.0, maxTotalTime = 0.0;
+
+        for (int i = 0; i < numIterations; ++i)
+        {
+            // Load render system module
+            timer->Start();
+            auto renderer = LLGL::RenderSystem::Load("OpenGL");
+            const auto loadTime = static_cast<double>(timer->Stop()) * ticksToMs;
+
+            // Create render context, which creates the GL context and loads all extensions
+            LLGL::RenderContextDescriptor contextDesc;
+            {
+                contextDesc.videoMode.resolution            = { 64, 64 };
+                contextDesc.vsync.enabled                   = false;
+                contextDesc.profileOpenGL.contextProfile    = LLGL::OpenGLContextProfile::CoreProfile;
+            }
+            timer->Start();
+            auto context = renderer->CreateRenderContext(contextDesc);
+            const auto contextTime = static_cast<double>(timer->Stop()) * ticksToMs;
+
+            // Clear and present the first frame
+            timer->Start();
+            {
+                auto commandQueue = renderer->GetCommandQueue();
+                auto commands = renderer->CreateCommandBuffer();
+
+                commands->Begin();
+                {
+                    commands->BeginRenderPass(*context);
+                    commands->Clear(LLGL::ClearFlags::Color);
+                    commands->EndRenderPass();
+                }
+                commands->End();
+                commandQueue->Submit(*commands);
+                context->Present();
+                commandQueue->WaitIdle();
+            }
+            const auto frameTime = static_cast<double>(timer->Stop()) * ticksToMs;
+
+            LLGL::RenderSystem::Unload(std::move(renderer));
+
+            // Accumulate results
+            const auto totalTime = loadTime + contextTime + frameTime;
+
+            if (i == 0)
+            {
+                minTotalTime = totalTime;
+                maxTotalTime = totalTime;
+            }
+            else
+            {
+                minTotalTime = std::min(minTotalTime, totalTime);
+                maxTotalTime = std::max(maxTotalTime, totalTime);
+            }
+
+            totalLoadTime       += loadTime;
+            totalContextTime    += contextTime;
+            totalFrameTime      += frameTime;
+        }
+
+        // Print results
+        const auto n = static_cast<double>(numIterations);
+
+        std::cout << "iterations: " << numIterations << std::endl;
+        std::cout << "\tRenderSystem::Load:   " << (totalLoadTime / n) << "ms" << std::endl;
+        std::cout << "\tCreateRenderContext:  " << (totalContextTime / n) << "ms" << std::endl;
+        std::cout << "\tfirst frame:          " << (totalFrameTime / n) << "ms" << std::endl;
+        std::cout << "\ttotal: " << ((totalLoadTime + totalContextTime + totalFrameTime) / n) << "ms average, "
+                  << minTotalTime << "ms min, " << maxTotalTime << "ms max" << std::endl;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        #ifdef _WIN32
+        system("pause");
+        #endif
+    }
+
+    return 0;
+}
@@ -0,0 +1,127 @@
+/*
+ * Test_GLStatePool.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "Helper.h"
+
+
+/*
+Checks that the OpenGL state pool shares equal pipeline states, but keeps pipeline states apart that only differ in a single field.
+The pipelines only differ in RasterizerDescriptor::discardEnabled, so the hash and the comparison of the rasterizer states must agree on that field,
+otherwise the second pipeline would reuse the rasterizer state of the first one and pass samples as well.
+Run from the "tests" directory: ./Test_GLStatePool
+*/
+
+static void PrintStatistics(const char* label, const LLGL::PipelineStateCacheStatistics& stats)
+{
+    std::cout << label << ": ";
+    std::cout << "depth-stencil states = " << stats.numDepthStencilStates;
+    std::cout << ", rasterizer states = " << stats.numRasterizerStates;
+    std::cout << ", blend states = " << stats.numBlendStates;
+    std::cout << ", lookups = " << stats.numLookups;
+    std::cout << ", hits = " << stats.numHits;
+    std::cout << ", hash collisions = " << stats.numHashCollisions << std::endl;
+}
+
+int main()
+{
+    return RunTest(
+        []() -> bool
+        {
+            // Load render system module
+            auto renderer = LLGL::RenderSystem::Load("OpenGL");
+
+            // Create render context
+            LLGL::RenderContextDescriptor contextDesc;
+
+            contextDesc.videoMode.resolution    = { 64, 64 };
+            contextDesc.vsync.enabled           = false;
+
+            auto context = renderer->CreateRenderContext(contextDesc);
+
+            std::cout << "renderer: " << renderer->GetRendererInfo().rendererName << std::endl;
+
+            // Create triangle that covers half of the viewport
+            auto triangle = CreateTestTriangle(*renderer, 1.0f);
+
+            // Create pipeline A and an equal pipeline, which must share all states with pipeline A
+            LLGL::PipelineStateCacheStatistics statsInitial, statsEqual, statsDiscard;
+
+            if (!renderer->QueryPipelineStateCacheStatistics(statsInitial))
+                throw std::runtime_error("failed to query pipeline state cache statistics");
+
+            LLGL::GraphicsPipelineDescriptor pipelineDesc;
+            {
+                pipelineDesc.shaderProgram = triangle.shaderProgram;
+            }
+            auto pipeline = renderer->CreateGraphicsPipeline(pipelineDesc);
+            auto pipelineEqual = renderer->CreateGraphicsPipeline(pipelineDesc);
+
+            renderer->QueryPipelineStateCacheStatistics(statsEqual);
+
+            // Create pipeline B that only differs in the rasterizer discard
+            pipelineDesc.rasterizer.discardEnabled = true;
+            auto pipelineDiscard = renderer->CreateGraphicsPipeline(pipelineDesc);
+
+            renderer->QueryPipelineStateCacheStatistics(statsDiscard);
+
+            PrintStatistics("initial", statsInitial);
+            PrintStatistics("equal pipelines", statsEqual);
+            PrintStatistics("discard pipeline", statsDiscard);
+
+            bool succeeded = true;
+
+            // Pipeline A' must hit all three states of pipeline A
+            if (statsEqual.numHits - statsInitial.numHits != 3 ||
+                statsEqual.numRasterizerStates - statsInitial.numRasterizerStates != 1 ||
+                statsEqual.numDepthStencilStates - statsInitial.numDepthStencilStates != 1 ||
+                statsEqual.numBlendStates - statsInitial.numBlendStates != 1)
+            {
+                std::cerr << "test failed: equal pipelines do not share their states" << std::endl;
+                succeeded = false;
+            }
+
+            // Pipeline B must only hit the depth-stencil and blend states of pipeline A
+            if (statsDiscard.numHits - statsEqual.numHits != 2 ||
+                statsDiscard.numRasterizerStates - statsEqual.numRasterizerStates != 1 ||
+                statsDiscard.numDepthStencilStates != statsEqual.numDepthStencilStates ||
+                statsDiscard.numBlendStates != statsEqual.numBlendStates)
+            {
+                std::cerr << "test failed: rasterizer state with discard was merged with another rasterizer state" << std::endl;
+                succeeded = false;
+            }
+
+            // Render with both pipelines: only pipeline A must pass samples
+            auto queryHeap = renderer->CreateQueryHeap(LLGL::QueryHeapDescriptor{});
+            auto commands = renderer->CreateCommandBuffer();
+
+            auto numSamples = DrawAndCountSamples(*renderer, *context, *commands, *pipelineEqual, triangle, *queryHeap);
+            auto numSamplesDiscard = DrawAndCountSamples(*renderer, *context, *commands, *pipelineDiscard, triangle, *queryHeap);
+
+            std::cout << "samples passed: " << numSamples << ", with discard: " << numSamplesDiscard << std::endl;
+
+            if (numSamples == 0 || numSamplesDiscard != 0)
+            {
+                std::cerr << "test failed: rasterizer discard was not applied correctly" << std::endl;
+                succeeded = false;
+            }
+
+            // Release pipeline B while its rasterizer state is bound, then render with pipeline A again
+            renderer->Release(*pipelineDiscard);
+
+            auto numSamplesAfterRelease = DrawAndCountSamples(*renderer, *context, *commands, *pipeline, triangle, *queryHeap);
+            std::cout << "samples passed after release: " << numSamplesAfterRelease << std::endl;
+
+            if (numSamplesAfterRelease != numSamples)
+            {
+                std::cerr << "test failed: released rasterizer state is still in use" << std::endl;
+                succeeded = false;
+            }
+
+            return succeeded;
+        }
+    );
+}
@@ -0,0 +1,162 @@
+/*
+ * Test_PipelineSwitch.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "Helper.h"
+#include <LLGL/Timer.h>
+#include <vector>
+#include <iostream>
+#include <string>
+#include <algorithm>
+#include <cstdlib>
+
+
+/*
+Microbenchmark for switching between graphics pipelines with the OpenGL renderer.
+All pipelines share the same shader program, depth-stencil, and rasterizer states, and only differ in their blend states.
+Run from the "tests" directory, e.g. with Mesa's software rasterizer: LIBGL_ALWAYS_SOFTWARE=1 GALLIUM_DRIVER=llvmpipe ./Test_PipelineSwitch [N] [FRAMES]
+*/
+
+static const LLGL::BlendOp g_blendOps[] =
+{
+    LLGL::BlendOp::One,
+    LLGL::BlendOp::SrcAlpha,
+    LLGL::BlendOp::InvSrcAlpha,
+    LLGL::BlendOp::DstColor,
+};
+
+int main(int argc, char* argv[])
+{
+    try
+    {
+        // Parse benchmark parameters
+        const std::size_t numPipelines          = (argc > 1 ? std::max(1, std::atoi(argv[1])) : 16);
+        const std::size_t numFrames             = (argc > 2 ? std::max(1, std::atoi(argv[2])) : 100);
+        const std::size_t numSwitchesPerFrame   = 1000;
+
+        // Load render system module
+        auto renderer = LLGL::RenderSystem::Load("OpenGL");
+
+        // Create render context
+        LLGL::RenderContextDescriptor contextDesc;
+
+        contextDesc.videoMode.resolution            = { 256, 256 };
+        contextDesc.vsync.enabled                   = false;
+        contextDesc.profileOpenGL.contextProfile    = LLGL::OpenGLContextProfile::CoreProfile;
+
+        auto context = renderer->CreateRenderContext(contextDesc);
+
+        std::cout << "renderer: " << renderer->GetRendererInfo().rendererName << std::endl;
+
+        // Create vertex buffer
+        struct Vertex
+        {
+            Gs::Vector2f        coord;
+            LLGL::ColorRGBAub   color;
+        }
+        vertices[] =
+        {
+            { { -0.5f, -0.5f }, { 255,   0,   0, 255 } },
+            { { -0.5f,  0.5f }, {   0, 255,   0, 160 } },
+            { {  0.5f, -0.5f }, { 255,   0, 255,  80 } },
+        };
+
+        LLGL::VertexFormat vertexFormat;
+        vertexFormat.AppendAttribute({ "coord", LLGL::Format::RG32Float });
+        vertexFormat.AppendAttribute({ "color", LLGL::Format::RGBA8UNorm });
+        vertexFormat.stride = sizeof(Vertex);
+
+        LLGL::BufferDescriptor vertexBufferDesc;
+        {
+            vertexBufferDesc.size                   = sizeof(vertices);
+            vertexBufferDesc.bindFlags              = LLGL::BindFlags::VertexBuffer;
+            vertexBufferDesc.vertexBuffer.format    = vertexFormat;
+        }
+        auto vertexBuffer = renderer->CreateBuffer(vertexBufferDesc, vertices);
+
+        // Create shader program
+        LLGL::ShaderProgramDescriptor shaderProgramDesc;
+        {
+            shaderProgramDesc.vertexFormats     = { vertexFormat };
+            shaderProgramDesc.vertexShader      = renderer->CreateShader({ LLGL::ShaderType::Vertex,   "BlendTest.vert" });
+            shaderProgramDesc.fragmentShader    = renderer->CreateShader({ LLGL::ShaderType::Fragment, "BlendTest.frag" });
+        }
+        auto shaderProgram = renderer->CreateShaderProgram(shaderProgramDesc);
+
+        if (shaderProgram->HasErrors())
+            throw std::runtime_error(shaderProgram->QueryInfoLog());
+
+        // Create graphics pipelines that only differ in their blend states
+        std::vector<LLGL::GraphicsPipeline*> pipelines(numPipelines);
+
+        for (std::size_t i = 0; i < numPipelines; ++i)
+        {
+            LLGL::GraphicsPipelineDescriptor pipelineDesc;
+            {
+                pipelineDesc.shaderProgram                  = shaderProgram;
+                pipelineDesc.depth.testEnabled              = true;
+                pipelineDesc.depth.writeEnabled             = true;
+                pipelineDesc.rasterizer.cullMode            = LLGL::CullMode::Back;
+                pipelineDesc.blend.targets[0].blendEnabled  = (i > 0);
+                pipelineDesc.blend.targets[0].srcColor      = g_blendOps[i % 4];
+                pipelineDesc.blend.targets[0].dstColor      = g_blendOps[(i / 4) % 4];
+                pipelineDesc.blend.blendFactor              = { 0.0f, 0.0f, 0.0f, static_cast<float>(i) / static_cast<float>(numPipelines) };
+            }
+            pipelines[i] = renderer->CreateGraphicsPipeline(pipelineDesc);
+        }
+
+        // Create command buffer
+        auto commandQueue = renderer->GetCommandQueue();
+        auto commands = renderer->CreateCommandBuffer();
+
+        // Measure time to record and submit pipeline switches
+        auto timer = LLGL::Timer::Create();
+
+        std::uint64_t elapsedTicks = 0;
+
+        for (std::size_t frame = 0; frame < numFrames; ++frame)
+        {
+            timer->Start();
+            {
+                commands->Begin();
+                {
+                    commands->SetVertexBuffer(*vertexBuffer);
+                    commands->BeginRenderPass(*context);
+                    {
+                        for (std::size_t i = 0; i < numSwitchesPerFrame; ++i)
+                        {
+                            commands->SetGraphicsPipeline(*pipelines[i % numPipelines]);
+                            commands->Draw(3, 0);
+                        }
+                    }
+                    commands->EndRenderPass();
+                }
+                commands->End();
+                commandQueue->Submit(*commands);
+                commandQueue->WaitIdle();
+            }
+            elapsedTicks += timer->Stop();
+
+            context->Present();
+        }
+
+        // Print results
+        const auto numSwitches  = static_cast<double>(numFrames * numSwitchesPerFrame);
+        const auto elapsedTime  = static_cast<double>(elapsedTicks) / static_cast<double>(timer->GetFrequency());
+
+        std::cout << "pipelines: " << numPipelines << ", frames: " << numFrames << ", switches: " << static_cast<std::uint64_t>(numSwitches) << std::endl;
+        std::cout << "\tduration: " << (elapsedTime * 1000.0) << "ms (" << (elapsedTime * 1.0e9 / numSwitches) << "ns per switch and draw)" << std::endl;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        #ifdef _WIN32
+        system("pause");
+        #endif
+    }
+
+    return 0;
+}
@@ -0,0 +1,130 @@
+/*
+ * Test_ResolveQueries.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "Helper.h"
+#include <vector>
+#include <string>
+
+
+/*
+Resolves an occlusion query heap into a buffer with CommandBuffer::ResolveQueries and compares the buffer contents
+against the results of CommandQueue::QueryResult. The queries alternate between drawing a triangle and drawing nothing.
+Run from the "tests" directory with an optional renderer module name, e.g.: ./Test_ResolveQueries Direct3D11
+*/
+
+int main(int argc, char* argv[])
+{
+    return RunTest(
+        [&]() -> bool
+        {
+            // Load render system module
+            auto renderer = LLGL::RenderSystem::Load(argc > 1 ? argv[1] : "OpenGL");
+
+            // Create render context
+            LLGL::RenderContextDescriptor contextDesc;
+
+            contextDesc.videoMode.resolution    = { 256, 256 };
+            contextDesc.vsync.enabled           = false;
+
+            auto context = renderer->CreateRenderContext(contextDesc);
+
+            std::cout << "renderer: " << renderer->GetRendererInfo().rendererName << std::endl;
+
+            // Create triangle and graphics pipeline
+            auto triangle = CreateTestTriangle(*renderer, 0.5f);
+
+            LLGL::GraphicsPipelineDescriptor pipelineDesc;
+            {
+                pipelineDesc.shaderProgram = triangle.shaderProgram;
+            }
+            auto pipeline = renderer->CreateGraphicsPipeline(pipelineDesc);
+
+            // Create occlusion query heap
+            static const std::uint32_t numQueries = 4;
+
+            LLGL::QueryHeapDescriptor queryHeapDesc;
+            {
+                queryHeapDesc.type          = LLGL::QueryType::SamplesPassed;
+                queryHeapDesc.numQueries    = numQueries;
+            }
+            auto queryHeap = renderer->CreateQueryHeap(queryHeapDesc);
+
+            // Create result buffer with one sentinel value in front of and behind the resolved range
+            static const std::uint64_t sentinel = 0xDEADBEEFDEADBEEFull;
+
+            std::vector<std::uint64_t> initialResults(numQueries + 2, sentinel);
+
+            LLGL::BufferDescriptor resultBufferDesc;
+            {
+                resultBufferDesc.size           = initialResults.size() * sizeof(std::uint64_t);
+                resultBufferDesc.cpuAccessFlags = LLGL::CPUAccessFlags::Read;
+            }
+            auto resultBuffer = renderer->CreateBuffer(resultBufferDesc, initialResults.data());
+
+            // Record queries: even queries draw the triangle, odd queries draw nothing
+            auto commandQueue = renderer->GetCommandQueue();
+            auto commands = renderer->CreateCommandBuffer();
+
+            commands->Begin();
+            {
+                commands->SetVertexBuffer(*triangle.vertexBuffer);
+                commands->BeginRenderPass(*context);
+                {
+                    commands->Clear(LLGL::ClearFlags::ColorDepth);
+                    commands->SetGraphicsPipeline(*pipeline);
+                    for (std::uint32_t i = 0; i < numQueries; ++i)
+                    {
+                        commands->BeginQuery(*queryHeap, i);
+                        {
+                            if (i % 2 == 0)
+                                commands->Draw(3, 0);
+                        }
+                        commands->EndQuery(*queryHeap, i);
+                    }
+                }
+                commands->EndRenderPass();
+                commands->ResolveQueries(*queryHeap, 0, numQueries, *resultBuffer, sizeof(std::uint64_t));
+            }
+            commands->End();
+            commandQueue->Submit(*commands);
+
+            // Read reference results on the CPU
+            std::uint64_t expectedResults[numQueries] = {};
+            while (!commandQueue->QueryResult(*queryHeap, 0, numQueries, expectedResults, sizeof(expectedResults)))
+            {
+                /* wait until the results are available */
+            }
+
+            commandQueue->WaitIdle();
+
+            // Compare resolved results with reference results
+            std::vector<std::uint64_t> results(initialResults.size(), 0);
+            if (auto mappedBuffer = renderer->MapBuffer(*resultBuffer, LLGL::CPUAccess::ReadOnly))
+            {
+                auto data = reinterpret_cast<const std::uint64_t*>(mappedBuffer);
+                results.assign(data, data + results.size());
+            }
+            renderer->UnmapBuffer(*resultBuffer);
+
+            bool succeeded = (results.front() == sentinel && results.back() == sentinel);
+
+            for (std::uint32_t i = 0; i < numQueries; ++i)
+            {
+                std::cout << "query " << i << ": resolved = " << results[i + 1] << ", expected = " << expectedResults[i] << std::endl;
+                if (results[i + 1] != expectedResults[i])
+                    succeeded = false;
+                if ((i % 2 == 0) != (expectedResults[i] > 0))
+                    succeeded = false;
+            }
+
+            if (!succeeded)
+                std::cerr << "test failed: resolved query results do not match" << std::endl;
+
+            return succeeded;
+        }
+    );
+}